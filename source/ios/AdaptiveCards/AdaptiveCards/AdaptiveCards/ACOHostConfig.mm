@@ -10,6 +10,7 @@
 #import "ACOHostConfigPrivate.h"
 #import "ACRErrors.h"
 #import "TextBlock.h"
+#import "TextProcessingCache.h"
 #import "ACOBaseCardElement.h"
 #import "Enums.h"
 
@@ -264,7 +265,7 @@ using namespace AdaptiveCards;
 + (std::string)getLocalizedDate:(std::string const &)text language:(std::string const &)language
 {
     std::string dateParsedString;
-    std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparsedTokens =  DateTimePreparser(text).GetTextTokens();
+    std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparsedTokens =  TextProcessingCache::GetDefault().GetDateTimePreparser(text)->GetTextTokens();
     for(auto section : DateTimePreparsedTokens){
         if(section->GetFormat() != DateTimePreparsedTokenFormat::RegularString) {
             NSDateFormatter *formatter = [[NSDateFormatter alloc] init];
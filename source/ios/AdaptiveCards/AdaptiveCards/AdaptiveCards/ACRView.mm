@@ -28,6 +28,7 @@
 #import "RichTextBlock.h"
 #import "ACRTextBlockRenderer.h"
 #import "MarkDownParser.h"
+#import "TextProcessingCache.h"
 #import "ImageSet.h"
 #import "ACRUILabel.h"
 #import "ACRUIImageView.h"
@@ -418,10 +419,10 @@ typedef UIImage* (^ImageLoadBlock)(NSURL *url);
     /// dispatch to concurrent queue
     dispatch_group_async(_async_tasks_group, _global_queue,
         ^{
-            std::shared_ptr<MarkDownParser> markDownParser = std::make_shared<MarkDownParser>([ACOHostConfig getLocalizedDate:textProp.GetText() language:textProp.GetLanguage()]);
+            // MarkDownParser transforms text with MarkDown to a html string, the default cache shares the result of repeated text
+            std::shared_ptr<const ProcessedMarkDown> markDownParser = TextProcessingCache::GetDefault().GetMarkDown([ACOHostConfig getLocalizedDate:textProp.GetText() language:textProp.GetLanguage()], textProp.GetLanguage());
 
-            // MarkDownParser transforms text with MarkDown to a html string
-            NSString* parsedString = [NSString stringWithCString:markDownParser->TransformToHtml().c_str() encoding:NSUTF8StringEncoding];
+            NSString* parsedString = [NSString stringWithCString:markDownParser->GetHtml().c_str() encoding:NSUTF8StringEncoding];
             NSDictionary *data = nil;
 
             // use Apple's html rendering only if the string has markdowns
@@ -529,10 +530,13 @@ typedef UIImage* (^ImageLoadBlock)(NSURL *url);
             UIImage *img = nil;
             if([url.scheme isEqualToString: @"data"]) {
                 NSString *absoluteUri = url.absoluteString;
-                std::string dataUri = AdaptiveCards::AdaptiveBase64Util::ExtractDataFromUri(std::string([absoluteUri UTF8String]));
-                std::vector<char> decodedDataUri = AdaptiveCards::AdaptiveBase64Util::Decode(dataUri);
-                NSData *decodedBase64 = [NSData dataWithBytes:decodedDataUri.data() length:decodedDataUri.size()];
-                img = [UIImage imageWithData:decodedBase64];
+                const char *dataUri = [absoluteUri UTF8String];
+                const size_t dataUriLength = strlen(dataUri);
+                NSMutableData *decodedBase64 = [NSMutableData dataWithLength:AdaptiveCards::AdaptiveBase64Util::DecodedDataUriLength(dataUri, dataUriLength)];
+                // data that isn't base64 leaves img nil, as a url that fails to load does
+                if(AdaptiveCards::AdaptiveBase64Util::DecodeDataUri(dataUri, dataUriLength, static_cast<char *>(decodedBase64.mutableBytes))) {
+                    img = [UIImage imageWithData:decodedBase64];
+                }
             } else {
                 img = [UIImage imageWithData:[NSData dataWithContentsOfURL:url]];
             }
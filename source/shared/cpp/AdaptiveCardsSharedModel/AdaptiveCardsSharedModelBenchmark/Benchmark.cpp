@@ -0,0 +1,478 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Benchmarks of the shared object model: parsing, validating, serializing, traversing and enumerating the resources of
+// every sample card and of synthetic large cards, parsing every sample host config, and processing MarkDown, dates and
+// base64. The slow inputs the fuzz targets found are timed too, so that they stay fast.
+//
+// Each benchmark runs its operation until it has run for the minimum time, and reports the time, the bytes allocated
+// and the allocations per operation as JSON, so that results can be tracked from commit to commit:
+//
+//   {"benchmarks": [{"name": "Parse", "input": "v1.0/Scenarios/ActivityUpdate.json", "iterations": 2048,
+//                    "nsPerOp": 48210.5, "bytesPerOp": 31650, "allocationsPerOp": 421}, ...]}
+//
+// Usage: AdaptiveCardsSharedModelBenchmark [--samples <dir>] [--slow-inputs <dir>] [--filter <text>] [--min-time <ms>]
+//                                          [--output <file>]
+//   --samples      the samples directory of the repository, which holds the cards and the host configs
+//   --slow-inputs  the SlowInputs directory of the fuzz targets
+//   --filter       runs only the benchmarks whose name/input contains the text
+//   --min-time     milliseconds each benchmark runs for, 200 by default. With 0, each benchmark runs once.
+//   --output       file the results are written to, instead of the standard output
+
+#include "pch.h"
+#include "AdaptiveBase64Util.h"
+#include "AdaptiveCardParseException.h"
+#include "AllocationCounter.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateTimePreparser.h"
+#include "FlattenedCard.h"
+#include "HostConfig.h"
+#include "MarkDownParser.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+
+using namespace AdaptiveCards;
+using AdaptiveCardsSharedModelUnitTest::AllocationCounter;
+
+namespace
+{
+    // Results of operations are added to it, so that the compiler can't drop the operations
+    volatile size_t g_sink = 0;
+
+    struct Benchmark
+    {
+        std::string name;
+        std::string input;
+        std::function<size_t()> operation;
+    };
+
+    struct Options
+    {
+        std::filesystem::path samples = ADAPTIVE_CARDS_SAMPLES_DIR;
+        std::filesystem::path slowInputs = ADAPTIVE_CARDS_SLOW_INPUTS_DIR;
+        std::string filter;
+        std::chrono::milliseconds minTime{200};
+        std::string output;
+    };
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream stream(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    }
+
+    // Json files under directory, by path relative to the samples directory
+    std::vector<std::pair<std::string, std::string>> LoadJsonFiles(const Options& options, const std::filesystem::path& directory)
+    {
+        std::vector<std::pair<std::string, std::string>> files;
+        for (const auto& file : std::filesystem::recursive_directory_iterator(directory))
+        {
+            if (file.path().extension() == ".json")
+            {
+                files.emplace_back(file.path().lexically_relative(options.samples).generic_string(), ReadFile(file.path()));
+            }
+        }
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    std::vector<std::pair<std::string, std::string>> LoadSampleCards(const Options& options)
+    {
+        auto files = LoadJsonFiles(options, options.samples);
+        files.erase(std::remove_if(files.begin(),
+                                   files.end(),
+                                   [](const std::pair<std::string, std::string>& file) {
+                                       return file.first.find("HostConfig") != std::string::npos ||
+                                              file.first.find("Templates") != std::string::npos;
+                                   }),
+                    files.end());
+        return files;
+    }
+
+    // Inputs the fuzz target found slow, by path relative to the slow inputs directory
+    std::vector<std::pair<std::string, std::string>> LoadSlowInputs(const Options& options, const std::string& target)
+    {
+        std::vector<std::pair<std::string, std::string>> files;
+        if (!std::filesystem::is_directory(options.slowInputs / target))
+        {
+            return files;
+        }
+
+        for (const auto& file : std::filesystem::directory_iterator(options.slowInputs / target))
+        {
+            files.emplace_back(file.path().lexically_relative(options.slowInputs).generic_string(), ReadFile(file.path()));
+        }
+        std::sort(files.begin(), files.end());
+        return files;
+    }
+
+    std::string MakeCard(const std::string& body)
+    {
+        return R"({"type": "AdaptiveCard", "version": "1.2", "body": [)" + body + "]}";
+    }
+
+    std::string Repeat(const std::string& item, size_t count)
+    {
+        std::string items;
+        for (size_t i = 0; i < count; ++i)
+        {
+            items += (i == 0 ? "" : ",") + item;
+        }
+        return items;
+    }
+
+    // Visible TextBlocks under elements, through the collection accessors of each container type, the way renderers walk
+    // a card
+    size_t CountVisibleTextBlocks(const std::vector<std::shared_ptr<BaseCardElement>>& elements)
+    {
+        size_t count = 0;
+        for (const auto& element : elements)
+        {
+            switch (element->GetElementType())
+            {
+            case CardElementType::TextBlock:
+                count += element->GetIsVisible() ? 1 : 0;
+                break;
+            case CardElementType::Container:
+                count += CountVisibleTextBlocks(std::static_pointer_cast<Container>(element)->GetItems());
+                break;
+            case CardElementType::ColumnSet:
+                for (const auto& column : std::static_pointer_cast<ColumnSet>(element)->GetColumns())
+                {
+                    count += CountVisibleTextBlocks(column->GetItems());
+                }
+                break;
+            default:
+                break;
+            }
+        }
+        return count;
+    }
+
+    // The same count, through the preorder records of a FlattenedCard
+    size_t CountVisibleTextBlocks(const FlattenedCard& flattened)
+    {
+        size_t count = 0;
+        for (const auto& record : flattened.GetElements())
+        {
+            if (record.elementType == CardElementType::TextBlock && static_cast<BaseCardElement*>(record.element)->GetIsVisible())
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    std::vector<std::pair<std::string, std::string>> MakeSyntheticCards()
+    {
+        std::string nested = R"({"type": "TextBlock", "text": "Innermost"})";
+        for (int i = 0; i < 100; ++i)
+        {
+            nested = R"({"type": "Container", "items": [)" + nested + "]}";
+        }
+
+        const std::string column =
+            R"({"type": "Column", "items": [{"type": "Image", "url": "https://adaptivecards.io/content/cats/1.png", "size": "small"}]})";
+
+        const std::string textBlock = R"({"type": "TextBlock", "text": "Hello"})";
+        const std::string textColumn = R"({"type": "Column", "items": [)" + textBlock +
+                                       R"(, {"type": "TextBlock", "text": "Hidden", "isVisible": false}, )" + textBlock + "]}";
+        const std::string columnSet = R"({"type": "ColumnSet", "columns": [)" + Repeat(textColumn, 3) + "]}";
+        const std::string container = R"({"type": "Container", "items": [)" + textBlock + "," + Repeat(columnSet, 2) + "]}";
+
+        return {
+            {"synthetic/1000TextBlocks",
+             MakeCard(Repeat(R"({"type": "TextBlock", "text": "Hello **world**, it's {{DATE(2017-02-14T06:08:39Z, SHORT)}}", "wrap": true})", 1000))},
+            {"synthetic/100NestedContainers", MakeCard(nested)},
+            {"synthetic/1000Facts",
+             MakeCard(R"({"type": "FactSet", "facts": [)" + Repeat(R"({"title": "Title", "value": "Value"})", 1000) + "]}")},
+            {"synthetic/500ColumnsOfImages", MakeCard(R"({"type": "ColumnSet", "columns": [)" + Repeat(column, 500) + "]}")},
+            {"synthetic/1MBText", MakeCard(R"({"type": "TextBlock", "text": ")" + std::string(1 << 20, 'a') + R"("})")},
+            {"synthetic/1000Inputs",
+             MakeCard(Repeat(R"({"type": "Input.Text", "id": "input", "placeholder": "Placeholder", "isRequired": true, "errorMessage": "Required"})",
+                             1000))},
+            {"synthetic/2000ContainersOfColumnSets", MakeCard(Repeat(container, 2000))}};
+    }
+
+    std::vector<std::pair<std::string, std::string>> MakeMarkDownTexts()
+    {
+        std::string paragraph;
+        std::string emphasis;
+        std::string list;
+        for (int i = 0; i < 1000; ++i)
+        {
+            paragraph += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+            emphasis += "**bold** _italic_ ***both*** [link](https://adaptivecards.io) ";
+            list += "- item " + std::to_string(i) + "\n";
+        }
+
+        return {{"markdown/chatMessage", "Hi **there**, the build is _green_ again: see [the results](https://adaptivecards.io)"},
+                {"markdown/longParagraph", paragraph},
+                {"markdown/emphasisAndLinks", emphasis},
+                {"markdown/list", list},
+                {"markdown/unmatchedDelimiters", std::string(10000, '*') + "text" + std::string(10000, '_')}};
+    }
+
+    std::vector<std::pair<std::string, std::string>> MakeDateTimeTexts()
+    {
+        std::string dates;
+        for (int i = 0; i < 100; ++i)
+        {
+            dates += "Due {{DATE(2017-02-14T06:08:39Z, LONG)}} at {{TIME(2017-02-14T06:08:39Z)}}. ";
+        }
+
+        return {{"dates/noDates", "A text with braces {{ but no date or time in it }}"},
+                {"dates/oneDate", "Sent {{DATE(2017-02-14T06:08:39Z, SHORT)}}"},
+                {"dates/100DatesAndTimes", dates}};
+    }
+
+    std::vector<Benchmark> MakeBenchmarks(const Options& options)
+    {
+        std::vector<Benchmark> benchmarks;
+
+        auto cards = LoadSampleCards(options);
+        const auto synthetic = MakeSyntheticCards();
+        cards.insert(cards.end(), synthetic.begin(), synthetic.end());
+        for (const auto& card : cards)
+        {
+            std::shared_ptr<AdaptiveCard> parsed;
+            try
+            {
+                parsed = AdaptiveCard::DeserializeFromString(card.second, c_sharedModelVersion)->GetAdaptiveCard();
+            }
+            catch (const AdaptiveCardParseException&)
+            {
+                // not all samples are cards of this version
+                continue;
+            }
+
+            const auto json = std::make_shared<std::string>(card.second);
+            benchmarks.push_back({"Parse", card.first, [json]() {
+                                      return AdaptiveCard::DeserializeFromString(*json, c_sharedModelVersion)->GetWarnings().size();
+                                  }});
+            benchmarks.push_back({"Validate", card.first, [json]() {
+                                      return AdaptiveCard::ValidateFromString(*json, c_sharedModelVersion).size();
+                                  }});
+            benchmarks.push_back({"Serialize", card.first, [parsed]() { return parsed->Serialize().size(); }});
+            benchmarks.push_back({"GetResourceInformation", card.first, [parsed]() { return parsed->GetResourceInformation().size(); }});
+            benchmarks.push_back({"Traverse", card.first, [parsed]() { return CountVisibleTextBlocks(parsed->GetBody()); }});
+
+            const auto flattened = std::make_shared<FlattenedCard>(parsed);
+            benchmarks.push_back({"TraverseFlattened", card.first, [flattened]() { return CountVisibleTextBlocks(*flattened); }});
+        }
+
+        for (const auto& hostConfig : LoadJsonFiles(options, options.samples / "HostConfig"))
+        {
+            const auto json = std::make_shared<std::string>(hostConfig.second);
+            benchmarks.push_back({"HostConfigParse", hostConfig.first, [json]() {
+                                      return HostConfig::DeserializeFromString(*json).GetFontFamily(FontType::Default).size();
+                                  }});
+        }
+
+        for (const auto& text : MakeMarkDownTexts())
+        {
+            const auto markDown = std::make_shared<std::string>(text.second);
+            benchmarks.push_back({"MarkDownToHtml", text.first, [markDown]() { return MarkDownParser(*markDown).TransformToHtml().size(); }});
+        }
+
+        for (const auto& text : MakeDateTimeTexts())
+        {
+            const auto dateTime = std::make_shared<std::string>(text.second);
+            benchmarks.push_back({"DateTimePreparser", text.first, [dateTime]() {
+                                      return DateTimePreparser(*dateTime).GetTextTokens().size();
+                                  }});
+        }
+
+        for (const auto& input : LoadSlowInputs(options, "CardParse"))
+        {
+            const auto json = std::make_shared<std::string>(input.second);
+            benchmarks.push_back({"Parse", "SlowInputs/" + input.first, [json]() -> size_t {
+                                      try
+                                      {
+                                          return AdaptiveCard::DeserializeFromString(*json, c_sharedModelVersion)->GetWarnings().size();
+                                      }
+                                      catch (const AdaptiveCardParseException&)
+                                      {
+                                          // some of the inputs are invalid cards
+                                          return 0;
+                                      }
+                                  }});
+            benchmarks.push_back({"Validate", "SlowInputs/" + input.first, [json]() -> size_t {
+                                      try
+                                      {
+                                          return AdaptiveCard::ValidateFromString(*json, c_sharedModelVersion).size();
+                                      }
+                                      catch (const AdaptiveCardParseException&)
+                                      {
+                                          return 0;
+                                      }
+                                  }});
+        }
+
+        for (const auto& input : LoadSlowInputs(options, "MarkDown"))
+        {
+            const auto markDown = std::make_shared<std::string>(input.second);
+            benchmarks.push_back({"MarkDownToHtml", "SlowInputs/" + input.first, [markDown]() {
+                                      return MarkDownParser(*markDown).TransformToHtml().size();
+                                  }});
+        }
+
+        for (const auto& input : LoadSlowInputs(options, "DateTimePreparser"))
+        {
+            const auto dateTime = std::make_shared<std::string>(input.second);
+            benchmarks.push_back({"DateTimePreparser", "SlowInputs/" + input.first, [dateTime]() {
+                                      return DateTimePreparser(*dateTime).GetTextTokens().size();
+                                  }});
+        }
+
+        for (const size_t size : {size_t{1} << 10, size_t{1} << 20})
+        {
+            std::vector<char> data(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                data[i] = static_cast<char>(i * 7919);
+            }
+            const auto encoded = std::make_shared<std::string>(AdaptiveBase64Util::Encode(data));
+            const auto dataUri = std::make_shared<std::string>("data:image/png;base64," + *encoded);
+            const auto decoded = std::make_shared<std::vector<char>>(std::move(data));
+            const auto input = "base64/" + std::to_string(size) + "Bytes";
+
+            benchmarks.push_back({"Base64Encode", input, [decoded]() { return AdaptiveBase64Util::Encode(*decoded).size(); }});
+            benchmarks.push_back({"Base64Decode", input, [encoded]() { return AdaptiveBase64Util::Decode(*encoded).size(); }});
+            benchmarks.push_back({"Base64DecodeDataUri", input, [dataUri]() {
+                                      std::vector<char> out(AdaptiveBase64Util::DecodedDataUriLength(dataUri->data(), dataUri->size()));
+                                      AdaptiveBase64Util::DecodeDataUri(dataUri->data(), dataUri->size(), out.data());
+                                      return out.size();
+                                  }});
+        }
+
+        return benchmarks;
+    }
+
+    Json::Value Run(const Benchmark& benchmark, std::chrono::milliseconds minTime)
+    {
+        // a first run, so that caches and statics are warm
+        g_sink = g_sink + benchmark.operation();
+
+        const AllocationCounter counter;
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::steady_clock::duration::zero();
+        unsigned long long iterations = 0;
+        do
+        {
+            g_sink = g_sink + benchmark.operation();
+            ++iterations;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < minTime);
+
+        Json::Value result;
+        result["name"] = benchmark.name;
+        result["input"] = benchmark.input;
+        result["iterations"] = static_cast<Json::UInt64>(iterations);
+        result["nsPerOp"] = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+        result["bytesPerOp"] = static_cast<double>(counter.GetBytes()) / iterations;
+        result["allocationsPerOp"] = static_cast<double>(counter.GetAllocations()) / iterations;
+        return result;
+    }
+
+    bool ParseOptions(int argc, char* argv[], Options& options)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string option = argv[i];
+            if (i + 1 == argc)
+            {
+                return false;
+            }
+
+            const std::string value = argv[++i];
+            if (option == "--samples")
+            {
+                options.samples = value;
+            }
+            else if (option == "--slow-inputs")
+            {
+                options.slowInputs = value;
+            }
+            else if (option == "--filter")
+            {
+                options.filter = value;
+            }
+            else if (option == "--min-time")
+            {
+                options.minTime = std::chrono::milliseconds(std::stoi(value));
+            }
+            else if (option == "--output")
+            {
+                options.output = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--samples <dir>] [--slow-inputs <dir>] [--filter <text>] [--min-time <ms>] [--output <file>]" << std::endl;
+        return 2;
+    }
+
+    std::vector<Benchmark> benchmarks;
+    try
+    {
+        benchmarks = MakeBenchmarks(options);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Couldn't load the samples from " << options.samples << ": " << e.what() << std::endl;
+        return 1;
+    }
+
+    Json::Value results(Json::arrayValue);
+    for (const auto& benchmark : benchmarks)
+    {
+        if ((benchmark.name + "/" + benchmark.input).find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        results.append(Run(benchmark, options.minTime));
+        const auto& result = results[results.size() - 1];
+        std::cerr << benchmark.name << " " << benchmark.input << ": " << result["nsPerOp"].asDouble() << " ns/op, "
+                  << result["bytesPerOp"].asDouble() << " bytes/op, " << result["allocationsPerOp"].asDouble()
+                  << " allocations/op" << std::endl;
+    }
+
+    Json::Value root;
+    root["benchmarks"] = std::move(results);
+    Json::StreamWriterBuilder writerBuilder;
+    writerBuilder["indentation"] = " ";
+    if (options.output.empty())
+    {
+        std::cout << Json::writeString(writerBuilder, root) << std::endl;
+    }
+    else
+    {
+        std::ofstream output(options.output);
+        output << Json::writeString(writerBuilder, root) << std::endl;
+        if (!output)
+        {
+            std::cerr << "Couldn't write " << options.output << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
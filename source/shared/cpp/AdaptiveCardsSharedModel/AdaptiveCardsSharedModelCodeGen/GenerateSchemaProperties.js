@@ -0,0 +1,314 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generates SchemaProperties.h and SchemaProperties.cpp in the shared object model from the typed schema in schemas/src:
+// the properties of each element, action and inline type, including the ones it inherits, and a perfect hash of the
+// property names. Parsing uses them to tell the properties a type knows from the ones it keeps as additional properties.
+//
+// Only these tables are generated. The property walks that read each type (see ParsePolicy.h in the object model) and
+// the serializers that write it are still written by hand: the schema doesn't say which member or setter holds each
+// property, nor the warnings, version checks and fallback rules some of them parse with.
+//
+// The object model parses a few properties the schema doesn't describe yet; UnpublishedProperties.json lists them, by
+// the schema type that gets them. Remove them from there once the schema has them. It also lists the few properties
+// the object model keeps as additional properties even though it parses them, so that they round-trip as they did
+// before these tables were generated.
+//
+// Run it with node after changing either, and commit the generated files:
+//
+//   node GenerateSchemaProperties.js
+//
+// With --check, it writes nothing and fails if the generated files are out of date.
+
+"use strict";
+
+const fs = require("fs");
+const path = require("path");
+
+const schemaDir = path.join(__dirname, "../../../../../schemas/src");
+const objectModelDir = path.join(__dirname, "../../ObjectModel");
+const unpublishedPropertiesFile = path.join(__dirname, "UnpublishedProperties.json");
+
+// The object model enum value of each schema type. Custom and unknown types get the properties of the abstract type
+// they derive from.
+const objectModelTypes = [
+    {enumType: "CardElementType", abstractType: "Element", types: {
+        "ActionSet": "ActionSet",
+        "AdaptiveCard": "AdaptiveCard",
+        "Input.Choice": "ChoiceInput",
+        "Input.ChoiceSet": "ChoiceSetInput",
+        "Column": "Column",
+        "ColumnSet": "ColumnSet",
+        "Container": "Container",
+        "Input.Date": "DateInput",
+        "Fact": "Fact",
+        "FactSet": "FactSet",
+        "Image": "Image",
+        "ImageSet": "ImageSet",
+        "Media": "Media",
+        "Input.Number": "NumberInput",
+        "RichTextBlock": "RichTextBlock",
+        "TextBlock": "TextBlock",
+        "Input.Text": "TextInput",
+        "Input.Time": "TimeInput",
+        "Input.Toggle": "ToggleInput",
+    }},
+    {enumType: "ActionType", abstractType: "Action", types: {
+        "Action.ShowCard": "ShowCard",
+        "Action.Submit": "Submit",
+        "Action.OpenUrl": "OpenUrl",
+        "Action.ToggleVisibility": "ToggleVisibility",
+    }},
+    {enumType: "InlineElementType", abstractType: "Inline", types: {
+        "TextRun": "TextRun",
+    }},
+];
+
+function loadSchemaTypes(dir, types) {
+    for (const entry of fs.readdirSync(dir, {withFileTypes: true})) {
+        const file = path.join(dir, entry.name);
+        if (entry.isDirectory()) {
+            loadSchemaTypes(file, types);
+        } else if (entry.name.endsWith(".json")) {
+            const type = JSON.parse(fs.readFileSync(file, "utf8"));
+            if (type.classType !== "Enum") {
+                types.set(path.basename(entry.name, ".json"), type);
+            }
+        }
+    }
+    return types;
+}
+
+// The names of the properties of typeName, including the ones it inherits and the "type" every typed object has
+function getPropertyNames(schemaTypes, propertyLists, typeName) {
+    const type = schemaTypes.get(typeName);
+    if (!type) {
+        throw new Error(`The schema has no type ${typeName}`);
+    }
+
+    const names = new Set(["type"]);
+    for (const baseTypeName of (type.extends || "").split(",").map(name => name.trim()).filter(name => name)) {
+        getPropertyNames(schemaTypes, propertyLists, baseTypeName).forEach(name => names.add(name));
+    }
+    Object.keys(type.properties || {}).forEach(name => names.add(name));
+    (propertyLists.properties[typeName] || []).forEach(name => names.add(name));
+    (propertyLists.additionalProperties[typeName] || []).forEach(name => names.delete(name));
+    return names;
+}
+
+function fnv1a(name, basis) {
+    let hash = basis;
+    for (const c of Buffer.from(name, "utf8")) {
+        hash = Math.imul(hash ^ c, 16777619) >>> 0;
+    }
+    return hash;
+}
+
+// Finds the first hash basis under which the names hash to different slots of a table four times their number, rounded
+// up to a power of two, which takes a few thousand tries. The top bits of the hash pick the slot, since the bottom ones
+// of FNV-1a only depend on the bottom ones of the basis.
+function makePerfectHash(names) {
+    let slotBits = 0;
+    while ((1 << slotBits) < 4 * names.length) {
+        slotBits++;
+    }
+    const size = 1 << slotBits;
+
+    for (let basis = 2166136261; ; basis = (basis + 1) >>> 0) {
+        const slots = new Array(size).fill(-1);
+        const collides = names.some((name, index) => {
+            const slot = fnv1a(name, basis) >>> (32 - slotBits);
+            if (slots[slot] !== -1) {
+                return true;
+            }
+            slots[slot] = index;
+            return false;
+        });
+        if (!collides) {
+            return {basis, slotBits, slots};
+        }
+    }
+}
+
+function hex(value) {
+    return "0x" + value.toString(16).toUpperCase();
+}
+
+// The words of a SchemaPropertySet of names, a bit for each name in propertyNames
+function toSet(propertyNames, names) {
+    const words = new Array(Math.ceil(propertyNames.length / 64)).fill(0n);
+    for (const name of names) {
+        const property = propertyNames.indexOf(name);
+        words[Math.floor(property / 64)] |= 1n << BigInt(property % 64);
+    }
+    return "{" + words.map(word => "0x" + word.toString(16).toUpperCase().padStart(16, "0") + "ull").join(", ") + "}";
+}
+
+const header = `// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generated from schemas/src by AdaptiveCardsSharedModel/AdaptiveCardsSharedModelCodeGen/GenerateSchemaProperties.js,
+// do not edit.
+`;
+
+function generateHeader(propertyCount) {
+    return `${header}#pragma once
+
+#include "pch.h"
+#include <cstdint>
+
+namespace AdaptiveSharedNamespace
+{
+    // A set of the properties of the schema, a bit for each
+    struct SchemaPropertySet
+    {
+        std::uint64_t words[${Math.ceil(propertyCount / 64)}];
+
+        bool Contains(unsigned int property) const { return ((words[property / 64] >> (property % 64)) & 1) != 0; }
+    };
+
+    // The properties the schema describes for a type, including the ones it inherits. Custom and unknown types get the
+    // properties every element, action or inline has.
+    SchemaPropertySet GetSchemaProperties(CardElementType type);
+    SchemaPropertySet GetSchemaProperties(ActionType type);
+    SchemaPropertySet GetSchemaProperties(InlineElementType type);
+
+    // Whether the property named [name, end) is one of properties
+    bool IsSchemaProperty(SchemaPropertySet properties, const char* name, const char* end);
+}
+`;
+}
+
+// The names of the properties of every type with an object model enum value, sorted
+function getAllPropertyNames(schemaTypes, propertyLists) {
+    const names = new Set();
+    for (const objectModelType of objectModelTypes) {
+        getPropertyNames(schemaTypes, propertyLists, objectModelType.abstractType).forEach(name => names.add(name));
+        for (const typeName of Object.keys(objectModelType.types)) {
+            getPropertyNames(schemaTypes, propertyLists, typeName).forEach(name => names.add(name));
+        }
+    }
+    return [...names].sort();
+}
+
+function generateSource(schemaTypes, propertyLists, propertyNames) {
+    const typeProperties = objectModelTypes.map(objectModelType => ({
+        enumType: objectModelType.enumType,
+        abstractProperties: getPropertyNames(schemaTypes, propertyLists, objectModelType.abstractType),
+        types: Object.keys(objectModelType.types).map(typeName => ({
+            enumValue: objectModelType.types[typeName],
+            properties: getPropertyNames(schemaTypes, propertyLists, typeName),
+        })),
+    }));
+
+    const perfectHash = makePerfectHash(propertyNames);
+    const slotRows = [];
+    for (let i = 0; i < perfectHash.slots.length; i += 16) {
+        slotRows.push(perfectHash.slots.slice(i, i + 16).map(slot => (slot === -1 ? "255" : String(slot))).join(", "));
+    }
+
+    const getters = typeProperties.map(objectModelType => {
+        const cases = objectModelType.types.map(type => `        case ${objectModelType.enumType}::${type.enumValue}:
+            // ${[...type.properties].sort().join(", ")}
+            return ${toSet(propertyNames, type.properties)};`);
+        return `    SchemaPropertySet GetSchemaProperties(${objectModelType.enumType} type)
+    {
+        switch (type)
+        {
+${cases.join("\n")}
+        default:
+            // ${[...objectModelType.abstractProperties].sort().join(", ")}
+            return ${toSet(propertyNames, objectModelType.abstractProperties)};
+        }
+    }
+`;
+    });
+
+    return `${header}#include "pch.h"
+#include "SchemaProperties.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        struct SchemaProperty
+        {
+            const char* name;
+            std::size_t length;
+        };
+
+        // The properties in the order of their bits
+        constexpr SchemaProperty c_properties[] = {
+${propertyNames.map(name => `            {"${name}", ${Buffer.byteLength(name, "utf8")}},`).join("\n")}
+        };
+
+        // The property each hash of a name goes to, by the top bits of the hash, or c_none. The names hash with FNV-1a
+        // from a basis under which no two of the properties go to the same slot.
+        constexpr std::uint32_t c_hashBasis = ${hex(perfectHash.basis)}u;
+        constexpr unsigned int c_slotBits = ${perfectHash.slotBits};
+        constexpr std::uint8_t c_none = 255;
+        constexpr std::uint8_t c_propertiesByHash[] = {
+${slotRows.map(row => `            ${row},`).join("\n")}
+        };
+
+        std::uint32_t HashPropertyName(const char* name, const char* end)
+        {
+            std::uint32_t hash = c_hashBasis;
+            for (; name != end; ++name)
+            {
+                hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+            }
+            return hash;
+        }
+    }
+
+${getters.join("\n")}
+    bool IsSchemaProperty(SchemaPropertySet properties, const char* name, const char* end)
+    {
+        const auto slot = HashPropertyName(name, end) >> (32 - c_slotBits);
+        const auto property = c_propertiesByHash[slot];
+        if (property == c_none || !properties.Contains(property))
+        {
+            return false;
+        }
+
+        const auto length = static_cast<std::size_t>(end - name);
+        return c_properties[property].length == length && std::equal(name, end, c_properties[property].name);
+    }
+}
+`;
+}
+
+function main() {
+    const check = process.argv.includes("--check");
+    const schemaTypes = loadSchemaTypes(schemaDir, new Map());
+    const propertyLists = JSON.parse(fs.readFileSync(unpublishedPropertiesFile, "utf8"));
+
+    const propertyNames = getAllPropertyNames(schemaTypes, propertyLists);
+
+    const outputs = [
+        {file: path.join(objectModelDir, "SchemaProperties.h"), contents: generateHeader(propertyNames.length)},
+        {
+            file: path.join(objectModelDir, "SchemaProperties.cpp"),
+            contents: generateSource(schemaTypes, propertyLists, propertyNames),
+        },
+    ];
+
+    let outOfDate = false;
+    for (const output of outputs) {
+        const current = fs.existsSync(output.file) ? fs.readFileSync(output.file, "utf8") : "";
+        if (current === output.contents) {
+            continue;
+        }
+        if (check) {
+            console.error(`${path.basename(output.file)} is out of date, run node GenerateSchemaProperties.js`);
+            outOfDate = true;
+        } else {
+            fs.writeFileSync(output.file, output.contents);
+            console.log(`Generated ${path.basename(output.file)}`);
+        }
+    }
+    process.exitCode = outOfDate ? 1 : 0;
+}
+
+main();
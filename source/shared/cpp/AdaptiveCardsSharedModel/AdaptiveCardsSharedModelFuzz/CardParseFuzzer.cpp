@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Parses the input as a card, such as deeply nested containers or columns
+#include "pch.h"
+#include "AdaptiveCardParseException.h"
+#include "FuzzBudget.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace AdaptiveCards;
+
+extern "C" int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)
+{
+    const std::string json(reinterpret_cast<const char*>(data), size);
+    AdaptiveCardsSharedModelFuzz::RunWithinBudget("CardParse", size, AdaptiveCardsSharedModelFuzz::GetDefaultBudget(), [&json]() {
+        try
+        {
+            AdaptiveCard::DeserializeFromString(json, c_sharedModelVersion);
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+            // invalid cards are expected; any other exception is a finding
+        }
+    });
+    return 0;
+}
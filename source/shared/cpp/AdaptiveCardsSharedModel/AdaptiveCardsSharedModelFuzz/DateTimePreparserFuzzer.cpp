@@ -0,0 +1,18 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Finds the dates and times of the input, such as a text full of unterminated {{DATE( fragments
+#include "pch.h"
+#include "DateTimePreparser.h"
+#include "FuzzBudget.h"
+
+using namespace AdaptiveCards;
+
+extern "C" int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)
+{
+    const std::string text(reinterpret_cast<const char*>(data), size);
+    AdaptiveCardsSharedModelFuzz::RunWithinBudget("DateTimePreparser", size, AdaptiveCardsSharedModelFuzz::GetDefaultBudget(), [&text]() {
+        DateTimePreparser(text).GetTextTokens();
+    });
+    return 0;
+}
@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace AdaptiveCardsSharedModelFuzz
+{
+    // Worst case cost of an operation on an input: a fixed cost plus a cost per byte of the input. An operation that's
+    // linear in the size of its input stays within the budget whatever the input, while one that's super-linear
+    // exceeds it once the input is large enough, which is what the fuzz targets look for.
+    struct FuzzBudget
+    {
+        double fixedNanoseconds;
+        double nanosecondsPerByte;
+        // Peak of the bytes allocated and not yet freed while the operation runs
+        unsigned long long fixedPeakBytes;
+        unsigned long long peakBytesPerByte;
+        unsigned long long fixedAllocations;
+        unsigned long long allocationsPerByte;
+    };
+
+    // Default budget, multiplied by the ADAPTIVE_CARDS_FUZZ_BUDGET_SCALE environment variable if it's set, such as 4
+    // for a slow machine or a build with sanitizers
+    FuzzBudget GetDefaultBudget();
+
+    // Runs operation on an input of the given size. If it exceeds the budget, it's run again, so that first-use
+    // initialization and a busy machine aren't findings, and if it still exceeds it, what it took is reported on the
+    // standard error and the process aborts, which libFuzzer reports as a crash and saves the input of.
+    void RunWithinBudget(const char* target, size_t size, const FuzzBudget& budget, const std::function<void()>& operation);
+}
+
+// Entry point of every fuzz target, called by libFuzzer or by StandaloneFuzzMain.cpp for each input
+extern "C" int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size);
@@ -0,0 +1,19 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Transforms the input as MarkDown to html and to inline runs, such as runs of emphasis delimiters and nested links
+#include "pch.h"
+#include "FuzzBudget.h"
+#include "MarkDownParser.h"
+
+using namespace AdaptiveCards;
+
+extern "C" int LLVMFuzzerTestOneInput(const unsigned char* data, size_t size)
+{
+    const std::string text(reinterpret_cast<const char*>(data), size);
+    AdaptiveCardsSharedModelFuzz::RunWithinBudget("MarkDown", size, AdaptiveCardsSharedModelFuzz::GetDefaultBudget(), [&text]() {
+        MarkDownParser(text).TransformToHtml();
+        MarkDownParser(text).TransformToInlineRuns();
+    });
+    return 0;
+}
@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Runs a fuzz target once on each input, without libFuzzer, so that the targets and their corpus of slow inputs are
+// regression tests on any compiler. It takes files and directories of inputs, like libFuzzer does, and ignores
+// libFuzzer's options, such as -runs=0.
+#include "FuzzBudget.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::filesystem::path> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::filesystem::path path = argv[i];
+        if (argv[i][0] == '-')
+        {
+            continue;
+        }
+
+        if (std::filesystem::is_directory(path))
+        {
+            for (const auto& file : std::filesystem::recursive_directory_iterator(path))
+            {
+                if (file.is_regular_file())
+                {
+                    inputs.push_back(file.path());
+                }
+            }
+        }
+        else
+        {
+            inputs.push_back(path);
+        }
+    }
+    std::sort(inputs.begin(), inputs.end());
+
+    for (const auto& input : inputs)
+    {
+        std::ifstream stream(input, std::ios::binary);
+        if (!stream)
+        {
+            std::cerr << "Couldn't read " << input << std::endl;
+            return 1;
+        }
+
+        const std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        std::cerr << "Running " << input.generic_string() << " (" << data.size() << " bytes)" << std::endl;
+        LLVMFuzzerTestOneInput(reinterpret_cast<const unsigned char*>(data.data()), data.size());
+    }
+
+    std::cerr << "Ran " << inputs.size() << " inputs" << std::endl;
+    return 0;
+}
@@ -0,0 +1,262 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AllocationCounter.h"
+#include "HostConfig.h"
+#include "MarkDownParser.h"
+#include "ParseUtil.h"
+#include "SampleCards.h"
+#include "SharedAdaptiveCard.h"
+#include <cstdlib>
+#include <filesystem>
+#include <map>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Checks that parsing, serializing and transforming the samples doesn't allocate more than it did when the budgets
+    // in AllocationBudgets.json were recorded. The number of allocations depends on the standard library, so there are
+    // budgets for each standard library and configuration the tests are built with, and the test fails without budgets
+    // for the one it runs with, or for one of the samples.
+    //
+    // To record the budgets after a change that's meant to allocate more or less, or after adding a sample, run the
+    // tests with the ADAPTIVE_CARDS_RECORD_ALLOCATION_BUDGETS environment variable set, and check in
+    // AllocationBudgets.json. The msvc budgets weren't measured but estimated from the libstdc++ ones, at twice them for
+    // release builds and four times them for debug builds, whose checked iterators allocate for every container; record
+    // them with the compiler to tighten them.
+    TEST_CLASS(AllocationBudgetTests)
+    {
+    private:
+        struct Usage
+        {
+            unsigned long long allocations;
+            unsigned long long bytes;
+        };
+
+        // Usage of each scenario, such as "Parse", of each sample, such as "v1.0/Scenarios/ActivityUpdate.json"
+        using Usages = std::map<std::string, std::map<std::string, Usage>>;
+
+        static std::filesystem::path GetBudgetsPath()
+        {
+            return std::filesystem::path(__FILE__).parent_path() / "AllocationBudgets.json";
+        }
+
+        static std::string GetStandardLibrary()
+        {
+#if defined(_MSC_VER) && defined(_ITERATOR_DEBUG_LEVEL) && _ITERATOR_DEBUG_LEVEL > 0
+            std::string library = "msvc debug";
+#elif defined(_MSC_VER)
+            std::string library = "msvc";
+#elif defined(_LIBCPP_VERSION)
+            std::string library = "libc++";
+#elif defined(__GLIBCXX__)
+            std::string library = "libstdc++";
+#else
+            std::string library = "unknown";
+#endif
+            return library + " " + std::to_string(sizeof(void*) * 8) + "-bit";
+        }
+
+        static std::string ReadFile(const std::filesystem::path& path)
+        {
+            std::ifstream stream(path);
+            return std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+        }
+
+        static void CollectTexts(const Json::Value& json, std::vector<std::string>& texts)
+        {
+            if (json.isObject())
+            {
+                for (const auto& name : json.getMemberNames())
+                {
+                    const auto& member = json[name];
+                    if (member.isString() && name == "text")
+                    {
+                        texts.push_back(member.asString());
+                    }
+                    else
+                    {
+                        CollectTexts(member, texts);
+                    }
+                }
+            }
+            else if (json.isArray())
+            {
+                for (const auto& item : json)
+                {
+                    CollectTexts(item, texts);
+                }
+            }
+        }
+
+        // Runs scenario once so that statics it initializes on first use aren't counted, then counts a second run
+        template<typename TScenario> static Usage Measure(TScenario&& scenario)
+        {
+            scenario();
+            AllocationCounter counter;
+            scenario();
+            return {counter.GetAllocations(), counter.GetBytes()};
+        }
+
+        static Usages MeasureSamples()
+        {
+            Usages usages;
+            ForEachSampleHostConfig([&usages](const std::string& path, const std::string& json) {
+                usages[path]["HostConfig"] = Measure([&]() { HostConfig::DeserializeFromString(json); });
+            });
+
+            ForEachSampleCard([&usages](const std::string& path, const std::string& json) {
+                std::shared_ptr<AdaptiveCard> card;
+                try
+                {
+                    card = AdaptiveCard::DeserializeFromString(json, "1.2")->GetAdaptiveCard();
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // not all samples are cards of this version
+                    return;
+                }
+
+                auto& usage = usages[path];
+                usage["Parse"] = Measure([&]() { AdaptiveCard::DeserializeFromString(json, "1.2"); });
+                usage["Serialize"] = Measure([&]() { card->Serialize(); });
+
+                std::vector<std::string> texts;
+                CollectTexts(ParseUtil::GetJsonValueFromString(json), texts);
+                if (!texts.empty())
+                {
+                    usage["MarkDownToHtml"] = Measure([&]() {
+                        for (const auto& text : texts)
+                        {
+                            MarkDownParser(text).TransformToHtml();
+                        }
+                    });
+                }
+            });
+            return usages;
+        }
+
+        static Usages ReadBudgets(const Json::Value& root, const std::string& library)
+        {
+            Usages budgets;
+            const auto& section = root[library];
+            for (const auto& sample : section.getMemberNames())
+            {
+                for (const auto& scenario : section[sample].getMemberNames())
+                {
+                    const auto& budget = section[sample][scenario];
+                    budgets[sample][scenario] = {budget[0].asUInt64(), budget[1].asUInt64()};
+                }
+            }
+            return budgets;
+        }
+
+        // Writes one line per sample, so that changes to the budgets read well in a diff
+        static void WriteBudgets(const Json::Value& root, const std::string& library, const Usages& usages)
+        {
+            std::map<std::string, Usages> sections;
+            for (const auto& name : root.getMemberNames())
+            {
+                sections[name] = ReadBudgets(root, name);
+            }
+            sections[library] = usages;
+
+            std::ofstream stream(GetBudgetsPath(), std::ios::binary);
+            stream << "{";
+            for (auto section = sections.begin(); section != sections.end(); ++section)
+            {
+                stream << (section == sections.begin() ? "\n" : ",\n") << "    \"" << section->first << "\": {";
+                for (auto sample = section->second.begin(); sample != section->second.end(); ++sample)
+                {
+                    stream << (sample == section->second.begin() ? "\n" : ",\n") << "        \"" << sample->first << "\": { ";
+                    for (auto scenario = sample->second.begin(); scenario != sample->second.end(); ++scenario)
+                    {
+                        stream << (scenario == sample->second.begin() ? "" : ", ") << "\"" << scenario->first << "\": ["
+                               << scenario->second.allocations << ", " << scenario->second.bytes << "]";
+                    }
+                    stream << " }";
+                }
+                stream << "\n    }";
+            }
+            stream << "\n}\n";
+        }
+
+        // Such as "12 allocations (budget 10, +2)"
+        static std::string Describe(unsigned long long used, unsigned long long budget, const std::string& unit)
+        {
+            const auto difference = static_cast<long long>(used - budget);
+            return std::to_string(used) + " " + unit + " (budget " + std::to_string(budget) + ", " +
+                   (difference > 0 ? "+" : "") + std::to_string(difference) + ")";
+        }
+
+    public:
+        TEST_METHOD(SamplesStayWithinAllocationBudgets)
+        {
+            const auto usages = MeasureSamples();
+            Assert::IsFalse(usages.empty());
+
+            const auto library = GetStandardLibrary();
+            const auto root = ParseUtil::GetJsonValueFromString(ReadFile(GetBudgetsPath()));
+            if (std::getenv("ADAPTIVE_CARDS_RECORD_ALLOCATION_BUDGETS") != nullptr)
+            {
+                WriteBudgets(root, library, usages);
+                Logger::WriteMessage(("Recorded the allocation budgets of " + library).c_str());
+                return;
+            }
+
+            if (!root.isMember(library))
+            {
+                const auto message = "No allocation budgets for " + library + "; record them";
+                Logger::WriteMessage(message.c_str());
+                Assert::Fail(std::wstring(message.begin(), message.end()).c_str());
+            }
+
+            const auto budgets = ReadBudgets(root, library);
+            std::string overBudget;
+            std::string unbudgeted;
+            unsigned int underBudget = 0;
+            for (const auto& sample : usages)
+            {
+                for (const auto& scenario : sample.second)
+                {
+                    const auto budgetSample = budgets.find(sample.first);
+                    if (budgetSample == budgets.end() || budgetSample->second.count(scenario.first) == 0)
+                    {
+                        unbudgeted += "\n" + scenario.first + " " + sample.first;
+                        continue;
+                    }
+
+                    const auto& budget = budgetSample->second.at(scenario.first);
+                    const auto& usage = scenario.second;
+                    if (usage.allocations > budget.allocations || usage.bytes > budget.bytes)
+                    {
+                        overBudget += "\n" + scenario.first + " " + sample.first + ": " +
+                                      Describe(usage.allocations, budget.allocations, "allocations") + ", " +
+                                      Describe(usage.bytes, budget.bytes, "bytes");
+                    }
+                    else if (usage.allocations < budget.allocations || usage.bytes < budget.bytes)
+                    {
+                        ++underBudget;
+                    }
+                }
+            }
+
+            if (underBudget > 0)
+            {
+                Logger::WriteMessage((std::to_string(underBudget) +
+                                      " scenarios are under their allocation budget; record the budgets to tighten them")
+                                         .c_str());
+            }
+
+            if (!overBudget.empty() || !unbudgeted.empty())
+            {
+                const auto message = (overBudget.empty() ? "" : "Over allocation budget:" + overBudget + "\n") +
+                                     (unbudgeted.empty() ? "" : "No allocation budget, record the budgets:" + unbudgeted);
+                Logger::WriteMessage(message.c_str());
+                Assert::Fail(std::wstring(message.begin(), message.end()).c_str());
+            }
+        }
+    };
+}
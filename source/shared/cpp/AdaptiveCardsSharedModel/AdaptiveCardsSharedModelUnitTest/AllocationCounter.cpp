@@ -0,0 +1,125 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "AllocationCounter.h"
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local unsigned long long t_allocations = 0;
+    thread_local unsigned long long t_bytes = 0;
+    thread_local long long t_liveBytes = 0;
+    thread_local long long t_peakLiveBytes = 0;
+
+    // Allocations are prefixed with their size, so that frees can be counted too
+    constexpr size_t c_headerSize = alignof(std::max_align_t);
+
+    void* CountedAllocate(size_t size) noexcept
+    {
+        void* block = std::malloc(c_headerSize + size);
+        if (!block)
+        {
+            return nullptr;
+        }
+
+        ++t_allocations;
+        t_bytes += size;
+        t_liveBytes += size;
+        if (t_liveBytes > t_peakLiveBytes)
+        {
+            t_peakLiveBytes = t_liveBytes;
+        }
+        *static_cast<size_t*>(block) = size;
+        return static_cast<char*>(block) + c_headerSize;
+    }
+
+    void CountedFree(void* allocation) noexcept
+    {
+        if (allocation)
+        {
+            void* block = static_cast<char*>(allocation) - c_headerSize;
+            t_liveBytes -= *static_cast<size_t*>(block);
+            std::free(block);
+        }
+    }
+}
+
+void* operator new(size_t size)
+{
+    if (void* allocation = CountedAllocate(size))
+    {
+        return allocation;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return CountedAllocate(size);
+}
+
+void operator delete(void* allocation) noexcept
+{
+    CountedFree(allocation);
+}
+
+void operator delete[](void* allocation) noexcept
+{
+    CountedFree(allocation);
+}
+
+void operator delete(void* allocation, size_t) noexcept
+{
+    CountedFree(allocation);
+}
+
+void operator delete[](void* allocation, size_t) noexcept
+{
+    CountedFree(allocation);
+}
+
+void operator delete(void* allocation, const std::nothrow_t&) noexcept
+{
+    CountedFree(allocation);
+}
+
+void operator delete[](void* allocation, const std::nothrow_t&) noexcept
+{
+    CountedFree(allocation);
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    AllocationCounter::AllocationCounter() :
+        m_startAllocations(t_allocations), m_startBytes(t_bytes), m_startLiveBytes(t_liveBytes)
+    {
+        t_peakLiveBytes = t_liveBytes;
+    }
+
+    unsigned long long AllocationCounter::GetAllocations() const { return t_allocations - m_startAllocations; }
+
+    unsigned long long AllocationCounter::GetBytes() const { return t_bytes - m_startBytes; }
+
+    long long AllocationCounter::GetLiveBytes() const { return t_liveBytes - m_startLiveBytes; }
+
+    long long AllocationCounter::GetPeakLiveBytes() const { return t_peakLiveBytes - m_startLiveBytes; }
+
+    void AllocationCounter::Reset()
+    {
+        m_startAllocations = t_allocations;
+        m_startBytes = t_bytes;
+        m_startLiveBytes = t_liveBytes;
+        t_peakLiveBytes = t_liveBytes;
+    }
+}
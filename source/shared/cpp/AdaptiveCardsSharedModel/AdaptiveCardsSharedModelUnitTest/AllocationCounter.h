@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Counts the heap allocations the current thread makes while the counter is alive. AllocationCounter.cpp replaces
+    // the global operator new to do the counting, so allocations of the object model are counted too; the unit tests,
+    // the benchmarks and the fuzz targets all link it. It doesn't use the precompiled header of the unit tests, so that
+    // the others can build it.
+    class AllocationCounter
+    {
+    public:
+        AllocationCounter();
+        AllocationCounter(const AllocationCounter&) = delete;
+        AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+        unsigned long long GetAllocations() const;
+        unsigned long long GetBytes() const;
+        // Bytes allocated less bytes freed, which is negative if more was freed than allocated
+        long long GetLiveBytes() const;
+        // Highest the live bytes have been. The thread's counters share the peak, so it's that of the counter that was
+        // created or reset last.
+        long long GetPeakLiveBytes() const;
+
+        // Starts counting again from zero
+        void Reset();
+
+    private:
+        unsigned long long m_startAllocations;
+        unsigned long long m_startBytes;
+        long long m_startLiveBytes;
+    };
+}
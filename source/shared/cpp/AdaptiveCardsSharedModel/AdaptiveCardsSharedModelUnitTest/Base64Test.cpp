@@ -2,9 +2,12 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "AdaptiveBase64Util.h"
+#include <chrono>
+#include <random>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
+using namespace std::string_literals;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
@@ -32,6 +35,42 @@ namespace AdaptiveCardsSharedModelUnitTest
             return true;
         }
 
+        // Decodes a char at a time, to check the table and vectorized decoders against
+        static std::vector<char> ReferenceDecode(const std::string& encoded, bool& valid)
+        {
+            const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            const std::string data = encoded.substr(0, encoded.find('='));
+            std::vector<char> decoded;
+            unsigned int bits = 0;
+            int bitCount = 0;
+            valid = (data.size() % 4 != 1);
+            for (const char ch : data)
+            {
+                const size_t value = alphabet.find(ch);
+                valid = valid && (value != std::string::npos);
+                bits = (bits << 6) | ((value == std::string::npos) ? 0 : static_cast<unsigned int>(value));
+                bitCount += 6;
+                if (bitCount >= 8)
+                {
+                    bitCount -= 8;
+                    decoded.push_back(static_cast<char>((bits >> bitCount) & 0xff));
+                }
+            }
+            return decoded;
+        }
+
+        static std::string RandomBase64(std::mt19937& random, size_t length)
+        {
+            const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+            std::uniform_int_distribution<size_t> index(0, alphabet.size() - 1);
+            std::string encoded;
+            for (size_t i = 0; i < length; ++i)
+            {
+                encoded += alphabet[index(random)];
+            }
+            return encoded;
+        }
+
         TEST_METHOD(EncodingTest)
         {
             std::vector<std::string> decodedData{ "", "f", "fo", "foo", "foob", "fooba", "foobar" };
@@ -71,5 +110,104 @@ namespace AdaptiveCardsSharedModelUnitTest
             }
 
         }
+
+        TEST_METHOD(DecodeMatchesReferenceTest)
+        {
+            std::mt19937 random(39);
+            for (size_t length = 0; length < 300; ++length)
+            {
+                std::string encoded = RandomBase64(random, length);
+
+                // invalid chars anywhere, including the blocks decoded together
+                if (length && length % 3 == 0)
+                {
+                    encoded[random() % length] = "-_*\0\x80 ="[length % 8];
+                }
+
+                bool expectedValid;
+                const auto expected = ReferenceDecode(encoded, expectedValid);
+                Assert::AreEqual(expected.size(), AdaptiveBase64Util::DecodedLength(encoded.data(), encoded.size()));
+
+                std::vector<char> decoded(expected.size());
+                Assert::AreEqual(expectedValid, AdaptiveBase64Util::Decode(encoded.data(), encoded.size(), decoded.data()));
+                Assert::IsTrue(expected == decoded);
+                Assert::IsTrue(expected == AdaptiveBase64Util::Decode(encoded));
+            }
+        }
+
+        TEST_METHOD(DecodeStaysInExactSizeBuffer)
+        {
+            // the vectorized decoder stores more than it decodes, which mustn't reach past the decoded length
+            const size_t guardLength = 32;
+            const char guard = '\x5a';
+            std::mt19937 random(16);
+            for (size_t length = 0; length <= 80; ++length)
+            {
+                for (const auto& encoded : {std::string(length, 'Q'), RandomBase64(random, length)})
+                {
+                    bool expectedValid;
+                    const auto expected = ReferenceDecode(encoded, expectedValid);
+                    const size_t decodedLength = AdaptiveBase64Util::DecodedLength(encoded.data(), encoded.size());
+                    Assert::AreEqual(expected.size(), decodedLength);
+
+                    std::vector<char> buffer(decodedLength + guardLength, guard);
+                    Assert::AreEqual(expectedValid, AdaptiveBase64Util::Decode(encoded.data(), encoded.size(), buffer.data()));
+                    Assert::IsTrue(std::equal(expected.begin(), expected.end(), buffer.begin()));
+                    Assert::IsTrue(std::all_of(buffer.begin() + decodedLength, buffer.end(), [guard](char ch) { return ch == guard; }));
+                }
+            }
+        }
+
+        TEST_METHOD(DecodeDataUriTest)
+        {
+            const std::string dataUri = "data:image/png;base64,Zm9vYmFy";
+            Assert::AreEqual(6U, static_cast<unsigned int>(AdaptiveBase64Util::DecodedDataUriLength(dataUri.data(), dataUri.size())));
+
+            char decoded[6];
+            Assert::IsTrue(AdaptiveBase64Util::DecodeDataUri(dataUri.data(), dataUri.size(), decoded));
+            Assert::AreEqual("foobar"s, std::string(decoded, sizeof(decoded)));
+            Assert::AreEqual("Zm9vYmFy"s, AdaptiveBase64Util::ExtractDataFromUri(dataUri));
+
+            // uris without a comma are all data
+            Assert::IsTrue(AdaptiveBase64Util::DecodeDataUri("Zm9v", 4, decoded));
+            Assert::AreEqual("foo"s, std::string(decoded, 3));
+            Assert::IsFalse(AdaptiveBase64Util::DecodeDataUri("data:,Zm9!", 10, decoded));
+        }
+
+        TEST_METHOD(ThroughputBenchmark)
+        {
+            std::mt19937 random(39);
+            std::vector<char> data(8 * 1024 * 1024);
+            for (auto& byte : data)
+            {
+                byte = static_cast<char>(random());
+            }
+            const int iterations = 10;
+
+            std::string encoded;
+            const auto encodeStart = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                encoded = AdaptiveBase64Util::Encode(data);
+            }
+            const auto encodeElapsed = std::chrono::steady_clock::now() - encodeStart;
+
+            std::vector<char> decoded(AdaptiveBase64Util::DecodedLength(encoded.data(), encoded.size()));
+            const auto decodeStart = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                Assert::IsTrue(AdaptiveBase64Util::Decode(encoded.data(), encoded.size(), decoded.data()));
+            }
+            const auto decodeElapsed = std::chrono::steady_clock::now() - decodeStart;
+            Assert::IsTrue(data == decoded);
+
+            const auto megabytesPerSecond = [&](auto elapsed) {
+                const double seconds = std::chrono::duration<double>(elapsed).count();
+                return std::to_string(static_cast<long long>(iterations * data.size() / (1024.0 * 1024.0) / seconds));
+            };
+            Logger::WriteMessage(("Base64 of 8MB: encode "s + megabytesPerSecond(encodeElapsed) + "MB/s, decode " +
+                                  megabytesPerSecond(decodeElapsed) + "MB/s")
+                                     .c_str());
+        }
     };
 }
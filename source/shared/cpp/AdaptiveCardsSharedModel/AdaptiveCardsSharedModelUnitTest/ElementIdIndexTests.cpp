@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Container.h"
+#include "ParseContext.h"
+#include "ShowCardAction.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ElementIdIndexTests)
+    {
+    public:
+        TEST_METHOD(ElementsAreFoundById)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "id": "container",
+                        "items": [
+                            {
+                                "type": "ColumnSet",
+                                "columns": [ { "type": "Column", "id": "column", "items": [ { "type": "Image", "id": "image", "url": "a.png" } ] } ]
+                            }
+                        ]
+                    },
+                    {
+                        "type": "ActionSet",
+                        "actions": [ { "type": "Action.Submit", "id": "submit" } ]
+                    }
+                ],
+                "actions": [
+                    {
+                        "type": "Action.ShowCard",
+                        "id": "showCard",
+                        "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "id": "nested", "text": "nested" } ] }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+
+            const auto container = card->GetElementById("container");
+            Assert::IsTrue(container == card->GetBody()[0]);
+            for (const auto& id : {"column"s, "image"s, "submit"s, "showCard"s, "nested"s})
+            {
+                const auto element = card->GetElementById(id);
+                Assert::IsNotNull(element.get());
+                Assert::AreEqual(id, element->GetId());
+            }
+            Assert::IsNull(card->GetElementById("missing").get());
+            Assert::IsNull(card->GetElementById("").get());
+
+            // The show card's own index only covers its own elements
+            const auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0])->GetCard();
+            Assert::IsTrue(showCard->GetElementById("nested") == card->GetElementById("nested"));
+            Assert::IsNull(showCard->GetElementById("container").get());
+        }
+
+        TEST_METHOD(FallbackDoesNotShadowElement)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "id": "shared",
+                        "items": [ { "type": "TextBlock", "text": "primary" } ],
+                        "fallback": { "type": "TextBlock", "id": "shared", "text": "fallback" }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            Assert::IsTrue(card->GetElementById("shared") == card->GetBody()[0]);
+        }
+
+        TEST_METHOD(ToggleTargetsAreResolved)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "id": "self",
+                        "items": [ { "type": "TextBlock", "text": "toggle me" } ],
+                        "selectAction": { "type": "Action.ToggleVisibility", "targetElements": [ "self" ] }
+                    }
+                ],
+                "actions": [
+                    { "type": "Action.ToggleVisibility", "targetElements": [ "later", "missing" ] },
+                    {
+                        "type": "Action.ShowCard",
+                        "card": {
+                            "type": "AdaptiveCard",
+                            "body": [ { "type": "TextBlock", "id": "later", "text": "later" } ],
+                            "actions": [ { "type": "Action.ToggleVisibility", "targetElements": [ "self" ] } ]
+                        }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+
+            // Targets that come after the action are resolved, unknown ones are left empty
+            const auto& targets = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions()[0])->GetTargetElements();
+            Assert::IsTrue(targets[0]->GetElement() == card->GetElementById("later"));
+            Assert::IsNull(targets[1]->GetElement().get());
+
+            // Targets inside a show card may refer to the enclosing card
+            const auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[1])->GetCard();
+            const auto& nestedTargets = std::static_pointer_cast<ToggleVisibilityAction>(showCard->GetActions()[0])->GetTargetElements();
+            Assert::IsTrue(nestedTargets[0]->GetElement() == card->GetBody()[0]);
+
+            // An element toggling itself doesn't keep itself alive
+            auto container = std::static_pointer_cast<Container>(card->GetBody()[0]);
+            const auto& selfTargets = std::static_pointer_cast<ToggleVisibilityAction>(container->GetSelectAction())->GetTargetElements();
+            Assert::IsTrue(selfTargets[0]->GetElement() == container);
+
+            std::weak_ptr<BaseCardElement> weakContainer = container;
+            const auto selfTarget = selfTargets[0];
+            card.reset();
+            Assert::IsTrue(weakContainer.use_count() > 0);
+            container.reset();
+            Assert::IsTrue(weakContainer.expired());
+            Assert::IsNull(selfTarget->GetElement().get());
+
+            // Changing the target id clears the resolved element
+            const auto element = std::make_shared<Container>();
+            auto target = std::make_shared<ToggleVisibilityTarget>();
+            target->SetElement(element);
+            Assert::IsNotNull(target->GetElement().get());
+            target->SetElementId("other");
+            Assert::IsNull(target->GetElement().get());
+        }
+
+        TEST_METHOD(CardsThatThrowDropTheirScope)
+        {
+            // The image without a url throws after the first image was recorded and warned about
+            ParseContext context;
+            Assert::ExpectException<AdaptiveCardParseException>([&]() {
+                AdaptiveCard::DeserializeFromString(R"({
+                    "type": "AdaptiveCard",
+                    "version": "1.2",
+                    "body": [
+                        { "type": "Image", "id": "first", "url": "a.png", "backgroundColor": "red" },
+                        { "type": "Image" }
+                    ]
+                })", "1.2", context);
+            });
+
+            // The next card gets its own index and warnings
+            const auto parseResult = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [ { "type": "Image", "id": "second", "url": "a.png", "backgroundColor": "blue" } ]
+            })", "1.2", context);
+
+            const auto card = parseResult->GetAdaptiveCard();
+            Assert::IsNotNull(card->GetElementById("second").get());
+            Assert::IsNull(card->GetElementById("first").get());
+            Assert::AreEqual(size_t{1}, parseResult->GetWarnings().size());
+            Assert::AreEqual(0U, context.GetWarningSink().GetTotalWarningCount());
+        }
+    };
+}
@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "stdafx.h"
+#include "AllocationCounter.h"
 #include "EverythingBagel.h"
 
 #include "ActionSet.h"
@@ -541,6 +542,159 @@ namespace AdaptiveCardsSharedModelUnitTest
         Assert::AreEqual("speak"s, fallbackCard->GetSpeak());
     }
 
+    // Reads the string properties of a card the way a renderer does, passing each one to visit
+    template<typename TVisit> void ReadStringProperties(const BaseActionElement& action, TVisit& visit)
+    {
+        visit(action.GetElementTypeString());
+        switch (action.GetElementType())
+        {
+        case ActionType::OpenUrl:
+            visit(static_cast<const OpenUrlAction&>(action).GetUrl());
+            break;
+        case ActionType::ShowCard:
+            ReadStringProperties(*static_cast<const ShowCardAction&>(action).GetCard(), visit);
+            break;
+        default:
+            break;
+        }
+    }
+
+    template<typename TVisit> void ReadStringProperties(const BaseCardElement& element, TVisit& visit)
+    {
+        visit(element.GetElementTypeString());
+        switch (element.GetElementType())
+        {
+        case CardElementType::TextBlock:
+        {
+            const auto& textBlock = static_cast<const TextBlock&>(element);
+            visit(textBlock.GetText());
+            visit(textBlock.GetLanguage());
+            break;
+        }
+        case CardElementType::RichTextBlock:
+            for (const auto& inlineElement : static_cast<const RichTextBlock&>(element).GetInlines())
+            {
+                const auto& textRun = static_cast<const TextRun&>(*inlineElement);
+                visit(textRun.GetText());
+                visit(textRun.GetLanguage());
+            }
+            break;
+        case CardElementType::Image:
+        {
+            const auto& image = static_cast<const Image&>(element);
+            visit(image.GetUrl());
+            visit(image.GetBackgroundColor());
+            visit(image.GetAltText());
+            break;
+        }
+        case CardElementType::ImageSet:
+            for (const auto& image : static_cast<const ImageSet&>(element).GetImages())
+            {
+                ReadStringProperties(*image, visit);
+            }
+            break;
+        case CardElementType::FactSet:
+            for (const auto& fact : static_cast<const FactSet&>(element).GetFacts())
+            {
+                visit(fact->GetTitle());
+                visit(fact->GetValue());
+                visit(fact->GetLanguage());
+            }
+            break;
+        case CardElementType::Container:
+            for (const auto& item : static_cast<const Container&>(element).GetItems())
+            {
+                ReadStringProperties(*item, visit);
+            }
+            break;
+        case CardElementType::ColumnSet:
+            for (const auto& column : static_cast<const ColumnSet&>(element).GetColumns())
+            {
+                visit(column->GetWidth());
+                for (const auto& item : column->GetItems())
+                {
+                    ReadStringProperties(*item, visit);
+                }
+            }
+            break;
+        case CardElementType::ActionSet:
+            for (const auto& action : static_cast<const ActionSet&>(element).GetActions())
+            {
+                ReadStringProperties(*action, visit);
+            }
+            break;
+        case CardElementType::TextInput:
+        {
+            const auto& textInput = static_cast<const TextInput&>(element);
+            visit(textInput.GetPlaceholder());
+            visit(textInput.GetValue());
+            visit(textInput.GetRegex());
+            visit(textInput.GetErrorMessage());
+            break;
+        }
+        case CardElementType::NumberInput:
+            visit(static_cast<const NumberInput&>(element).GetPlaceholder());
+            break;
+        case CardElementType::DateInput:
+        {
+            const auto& dateInput = static_cast<const DateInput&>(element);
+            visit(dateInput.GetMin());
+            visit(dateInput.GetMax());
+            visit(dateInput.GetPlaceholder());
+            visit(dateInput.GetValue());
+            break;
+        }
+        case CardElementType::TimeInput:
+        {
+            const auto& timeInput = static_cast<const TimeInput&>(element);
+            visit(timeInput.GetMin());
+            visit(timeInput.GetMax());
+            visit(timeInput.GetPlaceholder());
+            visit(timeInput.GetValue());
+            visit(timeInput.GetErrorMessage());
+            break;
+        }
+        case CardElementType::ToggleInput:
+        {
+            const auto& toggleInput = static_cast<const ToggleInput&>(element);
+            visit(toggleInput.GetTitle());
+            visit(toggleInput.GetValue());
+            visit(toggleInput.GetValueOn());
+            visit(toggleInput.GetValueOff());
+            break;
+        }
+        case CardElementType::ChoiceSetInput:
+        {
+            const auto& choiceSetInput = static_cast<const ChoiceSetInput&>(element);
+            visit(choiceSetInput.GetValue());
+            for (const auto& choice : choiceSetInput.GetChoices())
+            {
+                visit(choice->GetTitle());
+                visit(choice->GetValue());
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    template<typename TVisit> void ReadStringProperties(const AdaptiveCard& card, TVisit& visit)
+    {
+        visit(card.GetVersion());
+        visit(card.GetFallbackText());
+        visit(card.GetSpeak());
+        visit(card.GetLanguage());
+        for (const auto& element : card.GetBody())
+        {
+            ReadStringProperties(*element, visit);
+        }
+        for (const auto& action : card.GetActions())
+        {
+            ReadStringProperties(*action, visit);
+        }
+    }
+
     TEST_CLASS(EverythingBagel)
     {
     public:
@@ -572,5 +726,43 @@ namespace AdaptiveCardsSharedModelUnitTest
             const std::string actualJson {everythingBagel->Serialize()};
             Assert::AreEqual(expectedJson, actualJson);
         }
+
+        TEST_METHOD(EverythingBagelStringAccessorAllocations)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromFile("EverythingBagel.json", "1.0");
+            const auto& everythingBagel = *parseResult->GetAdaptiveCard();
+
+            // string properties are read by reference, so reading them doesn't allocate
+            size_t properties = 0;
+            size_t length = 0;
+            auto readByReference = [&](const std::string& value) {
+                ++properties;
+                length += value.size();
+            };
+            AllocationCounter byReference;
+            ReadStringProperties(everythingBagel, readByReference);
+            const auto byReferenceAllocations = byReference.GetAllocations();
+            Assert::AreEqual(0ULL, byReferenceAllocations);
+
+            // copying them, as the getters used to return them, allocates for every string too long for small
+            // string storage
+            size_t copiedLength = 0;
+            auto readByValue = [&](const std::string& value) {
+                const std::string copy = value;
+                copiedLength += copy.size();
+            };
+            AllocationCounter byValue;
+            ReadStringProperties(everythingBagel, readByValue);
+            const auto byValueAllocations = byValue.GetAllocations();
+            const auto byValueBytes = byValue.GetBytes();
+            Assert::AreEqual(length, copiedLength);
+            Assert::IsTrue(byValueAllocations > 0);
+
+            Logger::WriteMessage(("Read "s + std::to_string(properties) + " string properties of EverythingBagel: " +
+                                  std::to_string(byReferenceAllocations) + " allocations by reference, " +
+                                  std::to_string(byValueAllocations) + " allocations (" + std::to_string(byValueBytes) +
+                                  " bytes) by value")
+                                     .c_str());
+        }
     };
 }
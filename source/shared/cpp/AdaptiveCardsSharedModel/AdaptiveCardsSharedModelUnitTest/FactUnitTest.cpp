@@ -37,5 +37,19 @@ namespace AdaptiveCardsSharedModelUnitTest
             Assert::AreEqual(emptyFact.GetTitle(), parsedFact->GetTitle());
             Assert::AreEqual(emptyFact.GetValue(), parsedFact->GetValue());
         }
+
+        TEST_METHOD(DateParsingCache)
+        {
+            Fact fact("{{DATE(2017-02-14T06:08:00Z)}}", "Value");
+            const DateTimePreparser& title = fact.GetTitleForDateParsing();
+            Assert::IsTrue(&title == &fact.GetTitleForDateParsing());
+            Assert::IsTrue(title.HasDateTokens());
+            Assert::IsFalse(fact.GetValueForDateParsing().HasDateTokens());
+
+            fact.SetTitle("Title");
+            fact.SetValue("{{DATE(2017-02-14T06:08:00Z)}}");
+            Assert::IsFalse(fact.GetTitleForDateParsing().HasDateTokens());
+            Assert::IsTrue(fact.GetValueForDateParsing().HasDateTokens());
+        }
     };
 }
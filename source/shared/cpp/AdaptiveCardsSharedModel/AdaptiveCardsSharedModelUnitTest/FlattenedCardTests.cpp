@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FlattenedCard.h"
+#include "ShowCardAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(FlattenedCardTests)
+    {
+    private:
+        struct WalkResult
+        {
+            unsigned int elementCount = 0;
+            unsigned int visibleTextBlocks = 0;
+            unsigned int depthSum = 0;
+        };
+
+        // The traversal renderers do today, through the collection accessors of each container type
+        static void WalkElements(const std::vector<std::shared_ptr<BaseCardElement>>& elements, unsigned int depth, WalkResult& result)
+        {
+            for (const auto& element : elements)
+            {
+                ++result.elementCount;
+                result.depthSum += depth;
+                switch (element->GetElementType())
+                {
+                case CardElementType::TextBlock:
+                    result.visibleTextBlocks += element->GetIsVisible() ? 1 : 0;
+                    break;
+                case CardElementType::Container:
+                    WalkElements(std::static_pointer_cast<Container>(element)->GetItems(), depth + 1, result);
+                    break;
+                case CardElementType::ColumnSet:
+                    for (const auto& column : std::static_pointer_cast<ColumnSet>(element)->GetColumns())
+                    {
+                        ++result.elementCount;
+                        result.depthSum += depth + 1;
+                        WalkElements(column->GetItems(), depth + 2, result);
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+        }
+
+        static WalkResult WalkFlattened(const FlattenedCard& flattened)
+        {
+            WalkResult result;
+            for (const auto& record : flattened.GetElements())
+            {
+                ++result.elementCount;
+                result.depthSum += record.depth;
+                if (record.elementType == CardElementType::TextBlock && static_cast<BaseCardElement*>(record.element)->GetIsVisible())
+                {
+                    ++result.visibleTextBlocks;
+                }
+            }
+            return result;
+        }
+
+        static std::string MakeLargeCard(unsigned int containerCount)
+        {
+            const std::string textBlock = R"({ "type": "TextBlock", "text": "Hello" })";
+            const std::string hiddenTextBlock = R"({ "type": "TextBlock", "text": "Hidden", "isVisible": false })";
+            const std::string column = R"({ "type": "Column", "items": [ )" + textBlock + "," + hiddenTextBlock + "," + textBlock + " ] }";
+            const std::string columnSet = R"({ "type": "ColumnSet", "columns": [ )" + column + "," + column + "," + column + " ] }";
+            const std::string container = R"({ "type": "Container", "items": [ )" + textBlock + "," + columnSet + "," + columnSet + " ] }";
+
+            std::string json = R"({ "type": "AdaptiveCard", "version": "1.2", "body": [ )";
+            for (unsigned int i = 0; i < containerCount; ++i)
+            {
+                json += (i ? "," : "") + container;
+            }
+            return json + " ] }";
+        }
+
+    public:
+        TEST_METHOD(PreorderLayout)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "id": "container",
+                        "items": [
+                            { "type": "TextBlock", "id": "text1", "text": "one" },
+                            {
+                                "type": "ColumnSet",
+                                "id": "columnSet",
+                                "columns": [
+                                    { "type": "Column", "id": "column1", "items": [ { "type": "Image", "id": "image", "url": "a.png" } ] },
+                                    { "type": "Column", "id": "column2" }
+                                ]
+                            }
+                        ]
+                    },
+                    { "type": "TextBlock", "id": "text2", "text": "two" }
+                ],
+                "actions": [
+                    {
+                        "type": "Action.ShowCard",
+                        "id": "showCard",
+                        "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "id": "text3", "text": "three" } ] }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            FlattenedCard flattened(card);
+
+            const std::vector<std::string> expectedIds = {"container", "text1", "columnSet", "column1", "image", "column2", "text2", "showCard", "text3"};
+            const std::vector<unsigned int> expectedParents = {FlattenedCard::NoIndex, 0, 0, 2, 3, 2, FlattenedCard::NoIndex, FlattenedCard::NoIndex, 7};
+            const std::vector<unsigned int> expectedSubtreeSizes = {6, 1, 4, 2, 1, 1, 1, 2, 1};
+            const std::vector<unsigned int> expectedDepths = {0, 1, 1, 2, 3, 2, 0, 0, 1};
+
+            Assert::AreEqual(expectedIds.size(), flattened.GetCount());
+            for (unsigned int i = 0; i < flattened.GetCount(); ++i)
+            {
+                Assert::AreEqual(expectedIds[i], flattened[i].element->GetId());
+                Assert::AreEqual(expectedParents[i], flattened[i].parentIndex);
+                Assert::AreEqual(expectedSubtreeSizes[i], flattened[i].subtreeSize);
+                Assert::AreEqual(expectedDepths[i], flattened[i].depth);
+                Assert::IsTrue(flattened[i].internalId == flattened[i].element->GetInternalId());
+            }
+
+            Assert::IsTrue(flattened[2].elementType == CardElementType::ColumnSet);
+            Assert::IsTrue(flattened[7].elementType == CardElementType::Unknown);
+            Assert::IsTrue(flattened[7].actionType == ActionType::ShowCard);
+
+            // Child ranges
+            Assert::AreEqual(2U, flattened[2].childCount);
+            Assert::AreEqual(3U, flattened.GetFirstChild(2));
+            Assert::AreEqual(5U, flattened.GetNextSibling(3));
+            Assert::AreEqual(FlattenedCard::NoIndex, flattened.GetNextSibling(5));
+            Assert::AreEqual(FlattenedCard::NoIndex, flattened.GetFirstChild(5));
+            Assert::AreEqual(6U, flattened.GetNextSibling(0));
+            Assert::AreEqual(7U, flattened.GetNextSibling(6));
+
+            Assert::AreEqual(4U, flattened.FindByInternalId(flattened[4].element->GetInternalId()));
+        }
+
+        TEST_METHOD(FlattenedWalkMatchesPointerWalk)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(MakeLargeCard(20), "1.2")->GetAdaptiveCard();
+            const FlattenedCard flattened(card);
+
+            WalkResult pointerResult;
+            WalkElements(card->GetBody(), 0, pointerResult);
+            const auto flattenedResult = WalkFlattened(flattened);
+
+            // Each container holds a TextBlock and two ColumnSets of three Columns of three TextBlocks, one of them hidden
+            Assert::AreEqual(20U * 28U, flattenedResult.elementCount);
+            Assert::AreEqual(20U * 13U, flattenedResult.visibleTextBlocks);
+            Assert::AreEqual(pointerResult.elementCount, flattenedResult.elementCount);
+            Assert::AreEqual(pointerResult.visibleTextBlocks, flattenedResult.visibleTextBlocks);
+            Assert::AreEqual(pointerResult.depthSum, flattenedResult.depthSum);
+        }
+    };
+}
@@ -0,0 +1,313 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ElementParserRegistration.h"
+#include "FeatureRegistration.h"
+#include "HostCardResolver.h"
+#include "Image.h"
+#include "ShowCardAction.h"
+#include "ToggleVisibilityAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(HostCardResolverTests)
+    {
+    private:
+        static std::vector<std::string> GetIds(const std::vector<std::shared_ptr<BaseCardElement>>& elements)
+        {
+            std::vector<std::string> ids;
+            for (const auto& element : elements)
+            {
+                ids.push_back(element->GetId());
+            }
+            return ids;
+        }
+
+        // Parses elements of a custom type that the host renderer doesn't register
+        class RatingParser : public BaseCardElementParser
+        {
+        public:
+            std::shared_ptr<BaseCardElement> Deserialize(ParseContext&, const Json::Value& value) override
+            {
+                auto element = std::make_shared<BaseCardElement>(CardElementType::Custom);
+                element->SetElementTypeString("Rating");
+                element->SetId(value["id"].asString());
+                return element;
+            }
+
+            std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+            {
+                return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+            }
+        };
+
+    public:
+        TEST_METHOD(DropAndContentFallback)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    { "type": "TextBlock", "id": "kept", "text": "kept" },
+                    { "type": "Graph", "id": "dropped", "fallback": "drop" },
+                    {
+                        "type": "GraphV2",
+                        "id": "graphV2",
+                        "fallback": {
+                            "type": "Graph",
+                            "id": "graph",
+                            "fallback": { "type": "TextBlock", "id": "replacement", "text": "No graph support" }
+                        }
+                    },
+                    { "type": "TextBlock", "id": "requiresFoo", "text": "foo", "requires": { "foo": "2" }, "fallback": "drop" },
+                    { "type": "Unsupported", "id": "unsupported" }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            FeatureRegistration featureRegistration;
+            ElementParserRegistration elementRegistration;
+
+            auto result = ResolveForHost(card, featureRegistration, elementRegistration);
+            auto resolvedCard = result->GetAdaptiveCard();
+            Assert::IsTrue(std::vector<std::string>{"kept", "replacement"} == GetIds(resolvedCard->GetBody()));
+
+            // The source card isn't modified, and unchanged elements are shared
+            Assert::AreEqual(5U, static_cast<unsigned int>(card->GetBody().size()));
+            Assert::IsTrue(card->GetBody()[0] == resolvedCard->GetBody()[0]);
+
+            // The resolved card's index only has the remaining elements
+            Assert::IsNotNull(resolvedCard->GetElementById("replacement").get());
+            Assert::IsNull(resolvedCard->GetElementById("dropped").get());
+            Assert::IsNotNull(card->GetElementById("dropped").get());
+
+            auto warnings = result->GetWarnings();
+            Assert::AreEqual(5U, static_cast<unsigned int>(warnings.size()));
+            for (const auto& warning : warnings)
+            {
+                Assert::IsTrue(WarningStatusCode::NoRendererForType == warning->GetStatusCode());
+            }
+            Assert::AreEqual("No Renderer found for type: Unsupported"s, warnings[4]->GetReason());
+
+            // Providing the feature keeps the element
+            featureRegistration.AddFeature("foo", "2.1");
+            resolvedCard = ResolveForHost(card, featureRegistration, elementRegistration)->GetAdaptiveCard();
+            Assert::IsTrue(std::vector<std::string>{"kept", "replacement", "requiresFoo"} == GetIds(resolvedCard->GetBody()));
+        }
+
+        TEST_METHOD(FallbackToAncestor)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "id": "outer",
+                        "items": [
+                            {
+                                "type": "ColumnSet",
+                                "id": "columnSet",
+                                "columns": [
+                                    {
+                                        "type": "Column",
+                                        "id": "column",
+                                        "items": [
+                                            { "type": "TextBlock", "id": "text", "text": "text" },
+                                            { "type": "TextBlock", "id": "needsBar", "text": "bar", "requires": { "bar": "1" } }
+                                        ]
+                                    }
+                                ]
+                            }
+                        ],
+                        "fallback": { "type": "TextBlock", "id": "outerFallback", "text": "fallback" }
+                    },
+                    {
+                        "type": "Container",
+                        "id": "noFallback",
+                        "items": [
+                            { "type": "TextBlock", "id": "text2", "text": "text" },
+                            { "type": "TextBlock", "id": "needsBar2", "text": "bar", "requires": { "bar": "1" } }
+                        ]
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            FeatureRegistration featureRegistration;
+            ElementParserRegistration elementRegistration;
+
+            // Without the feature, the element falls back to the nearest ancestor with fallback. Without such an
+            // ancestor the element is dropped and its container is copied.
+            auto resolvedCard = ResolveForHost(card, featureRegistration, elementRegistration)->GetAdaptiveCard();
+            Assert::IsTrue(std::vector<std::string>{"outerFallback", "noFallback"} == GetIds(resolvedCard->GetBody()));
+            auto container = std::static_pointer_cast<Container>(resolvedCard->GetBody()[1]);
+            Assert::IsTrue(container != card->GetBody()[1]);
+            Assert::IsTrue(std::vector<std::string>{"text2"} == GetIds(container->GetItems()));
+            Assert::AreEqual(2U, static_cast<unsigned int>(std::static_pointer_cast<Container>(card->GetBody()[1])->GetItems().size()));
+
+            // Any version of a feature registered as "*" satisfies a requirement
+            featureRegistration.AddFeature("bar", "*");
+            auto result = ResolveForHost(card, featureRegistration, elementRegistration);
+            Assert::IsTrue(card == result->GetAdaptiveCard());
+            Assert::IsTrue(result->GetWarnings().empty());
+        }
+
+        TEST_METHOD(UnregisteredElementAndShowCard)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "ColumnSet",
+                        "columns": [
+                            { "type": "Column", "id": "column1", "items": [ { "type": "Rating", "id": "rating" } ] },
+                            { "type": "Column", "id": "column2" }
+                        ]
+                    }
+                ],
+                "actions": [
+                    {
+                        "type": "Action.ShowCard",
+                        "id": "showCard",
+                        "card": {
+                            "type": "AdaptiveCard",
+                            "body": [
+                                { "type": "TextBlock", "id": "shown", "text": "shown" },
+                                { "type": "Rating", "id": "shownRating" }
+                            ]
+                        }
+                    },
+                    { "type": "Action.OpenUrl", "id": "openUrl", "url": "https://adaptivecards.io", "requires": { "baz": "1" } }
+                ]
+            })";
+
+            auto parseRegistration = std::make_shared<ElementParserRegistration>();
+            parseRegistration->AddParser("Rating", std::make_shared<RatingParser>());
+            ParseContext context(parseRegistration, nullptr);
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2", context)->GetAdaptiveCard();
+
+            // A host that doesn't render the custom element
+            FeatureRegistration featureRegistration;
+            ElementParserRegistration elementRegistration;
+
+            auto resolvedCard = ResolveForHost(card, featureRegistration, elementRegistration)->GetAdaptiveCard();
+            auto columns = std::static_pointer_cast<ColumnSet>(resolvedCard->GetBody()[0])->GetColumns();
+            Assert::AreEqual(2U, static_cast<unsigned int>(columns.size()));
+            Assert::IsTrue(columns[0]->GetItems().empty());
+            Assert::IsTrue(columns[1] == std::static_pointer_cast<ColumnSet>(card->GetBody()[0])->GetColumns()[1]);
+
+            Assert::AreEqual(1U, static_cast<unsigned int>(resolvedCard->GetActions().size()));
+            auto showCard = std::static_pointer_cast<ShowCardAction>(resolvedCard->GetActions()[0]);
+            Assert::IsTrue(showCard != card->GetActions()[0]);
+            Assert::IsTrue(std::vector<std::string>{"shown"} == GetIds(showCard->GetCard()->GetBody()));
+            Assert::AreEqual(2U, static_cast<unsigned int>(std::static_pointer_cast<ShowCardAction>(card->GetActions()[0])->GetCard()->GetBody().size()));
+
+            Assert::IsNotNull(resolvedCard->GetElementById("shown").get());
+            Assert::IsNull(resolvedCard->GetElementById("shownRating").get());
+            Assert::IsNull(resolvedCard->GetElementById("openUrl").get());
+            Assert::IsNotNull(card->GetElementById("shownRating").get());
+        }
+
+        TEST_METHOD(ToggleVisibilityTargetsReferToResolvedElements)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "id": "target",
+                        "items": [
+                            { "type": "TextBlock", "id": "kept", "text": "kept" },
+                            { "type": "Graph", "id": "dropped", "fallback": "drop" }
+                        ]
+                    },
+                    {
+                        "type": "Image",
+                        "id": "image",
+                        "url": "https://adaptivecards.io/content/cats/1.png",
+                        "selectAction": { "type": "Action.ToggleVisibility", "targetElements": [ "target", "dropped" ] }
+                    }
+                ],
+                "actions": [
+                    { "type": "Action.ToggleVisibility", "targetElements": [ "target", "image" ] }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            FeatureRegistration featureRegistration;
+            ElementParserRegistration elementRegistration;
+            auto resolvedCard = ResolveForHost(card, featureRegistration, elementRegistration)->GetAdaptiveCard();
+
+            const auto target = resolvedCard->GetElementById("target");
+            Assert::IsTrue(target != card->GetElementById("target"));
+
+            // Toggling from the resolved card acts on its elements
+            auto toggleAction = std::static_pointer_cast<ToggleVisibilityAction>(resolvedCard->GetActions()[0]);
+            Assert::IsTrue(target == toggleAction->GetTargetElements()[0]->GetElement());
+            Assert::IsTrue(resolvedCard->GetElementById("image") == toggleAction->GetTargetElements()[1]->GetElement());
+
+            auto image = std::static_pointer_cast<Image>(resolvedCard->GetBody()[1]);
+            auto selectAction = std::static_pointer_cast<ToggleVisibilityAction>(image->GetSelectAction());
+            Assert::IsTrue(target == selectAction->GetTargetElements()[0]->GetElement());
+            Assert::IsNull(selectAction->GetTargetElements()[1]->GetElement().get());
+
+            // while toggling from the source card still acts on the source elements
+            auto sourceToggleAction = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions()[0]);
+            Assert::IsTrue(card->GetElementById("target") == sourceToggleAction->GetTargetElements()[0]->GetElement());
+            auto sourceImage = std::static_pointer_cast<Image>(card->GetBody()[1]);
+            auto sourceSelectAction = std::static_pointer_cast<ToggleVisibilityAction>(sourceImage->GetSelectAction());
+            Assert::IsTrue(card->GetElementById("dropped") == sourceSelectAction->GetTargetElements()[1]->GetElement());
+        }
+
+        TEST_METHOD(ResolvedCardsIndexSelectAndInlineActions)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "selectAction": { "type": "Action.Submit", "id": "cardSelect" },
+                "body": [
+                    { "type": "Graph", "id": "dropped", "fallback": "drop" },
+                    {
+                        "type": "Container",
+                        "items": [ { "type": "Image", "url": "a.png", "selectAction": { "type": "Action.Submit", "id": "imageSelect" } } ],
+                        "selectAction": { "type": "Action.Submit", "id": "containerSelect" }
+                    },
+                    {
+                        "type": "RichTextBlock",
+                        "inlines": [ { "type": "TextRun", "text": "a", "selectAction": { "type": "Action.Submit", "id": "runSelect" } } ]
+                    },
+                    { "type": "Input.Text", "id": "input", "inlineAction": { "type": "Action.Submit", "id": "inline" } }
+                ],
+                "actions": [
+                    {
+                        "type": "Action.ShowCard",
+                        "card": { "type": "AdaptiveCard", "selectAction": { "type": "Action.Submit", "id": "shownSelect" } }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            FeatureRegistration featureRegistration;
+            ElementParserRegistration elementRegistration;
+            auto resolvedCard = ResolveForHost(card, featureRegistration, elementRegistration)->GetAdaptiveCard();
+            Assert::IsTrue(resolvedCard != card);
+
+            // The resolved card finds the actions parsing indexed
+            for (const auto& id : {"cardSelect"s, "imageSelect"s, "containerSelect"s, "runSelect"s, "inline"s, "shownSelect"s})
+            {
+                Assert::IsNotNull(card->GetElementById(id).get());
+                Assert::IsTrue(card->GetElementById(id) == resolvedCard->GetElementById(id));
+            }
+        }
+    };
+}
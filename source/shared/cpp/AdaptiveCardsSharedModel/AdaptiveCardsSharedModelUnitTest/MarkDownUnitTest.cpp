@@ -2,9 +2,11 @@
 // Licensed under the MIT License.
 #include "stdafx.h"
 #include "MarkDownParser.h"
+#include <chrono>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
+using namespace std::string_literals;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
@@ -700,5 +702,303 @@ namespace AdaptiveCardsSharedModelUnitTest
             parser3.TransformToHtml();
             Assert::AreEqual<bool>(true, parser3.IsEscaped());
         }
+
+        TEST_METHOD(LongChatMessageTest)
+        {
+            const std::string line = "Hi **team**, see [the build](https://example.com/build?id=42&x=1) and *re-run* it.";
+            const std::string lineHtml =
+                "Hi <strong>team</strong>, see <a href=\"https://example.com/build?id=42&amp;x=1\">the build</a> and <em>re-run</em> it.";
+
+            for (int lineCount : {10, 1000})
+            {
+                std::string text = line;
+                std::string expected = "<p>" + lineHtml;
+                for (int i = 1; i < lineCount; ++i)
+                {
+                    text += "\n" + line;
+                    expected += "\n" + lineHtml;
+                }
+                expected += "</p>";
+
+                const auto start = std::chrono::steady_clock::now();
+                MarkDownParser parser(text);
+                Assert::AreEqual(expected, parser.TransformToHtml());
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                Assert::IsTrue(parser.HasHtmlTags());
+
+                Logger::WriteMessage(("MarkDown with "s + std::to_string(text.size()) + " chars: " +
+                                      std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) + "us")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(EmphasisTest_UnmatchedOpenerDoesNotBlockLaterMatches)
+        {
+            MarkDownParser parser("__b*a*");
+            Assert::AreEqual<std::string>("<p>__b<em>a</em></p>", parser.TransformToHtml());
+
+            MarkDownParser parser2("_ba**b**");
+            Assert::AreEqual<std::string>("<p>_ba<strong>b</strong></p>", parser2.TransformToHtml());
+        }
+
+        TEST_METHOD(EmphasisTest_MultipleOfThreeRule)
+        {
+            // left and right emphasis of 2 can't match right emphasis of 1
+            MarkDownParser parser("a**b* c");
+            Assert::AreEqual<std::string>("<p>a**b* c</p>", parser.TransformToHtml());
+
+            MarkDownParser parser2("*foo**bar*");
+            Assert::AreEqual<std::string>("<p><em>foo**bar</em></p>", parser2.TransformToHtml());
+
+            MarkDownParser parser3("a***b*c");
+            Assert::AreEqual<std::string>("<p>a**<em>b</em>c</p>", parser3.TransformToHtml());
+        }
+
+        TEST_METHOD(EmphasisTest_ManyDelimitersTakeLinearTime)
+        {
+            const auto repeat = [](const std::string& text, int count) {
+                std::string repeated;
+                for (int i = 0; i < count; ++i)
+                {
+                    repeated += text;
+                }
+                return repeated;
+            };
+
+            // 100k delimiter runs each; unmatched openers, unmatched closers, closers of the other delimiter type,
+            // and left and right runs that the multiple of 3 rule keeps from matching
+            const std::vector<std::string> inputs = {repeat("*a ", 100000),
+                                                     repeat("a* ", 100000),
+                                                     repeat("*a ", 50000) + repeat("a_ ", 50000),
+                                                     repeat("a**b* c ", 50000),
+                                                     repeat("_a*", 50000)};
+
+            for (const auto& input : inputs)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                MarkDownParser parser(input);
+                const auto html = parser.TransformToHtml();
+                const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+                Assert::IsTrue(html.size() >= input.size());
+                // linear matching takes tens of milliseconds, quadratic matching takes minutes
+                Assert::IsTrue(elapsed.count() < 5000);
+                Logger::WriteMessage(("MarkDown with "s + std::to_string(input.size()) + " chars of delimiters: " +
+                                      std::to_string(elapsed.count()) + "ms")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(LinkTest_UnclosedLinksKeepTheirText)
+        {
+            MarkDownParser parser1("[](");
+            Assert::AreEqual<std::string>("<p>[](</p>", parser1.TransformToHtml());
+
+            MarkDownParser parser2("[x](y");
+            Assert::AreEqual<std::string>("<p>[x](y</p>", parser2.TransformToHtml());
+
+            MarkDownParser parser3("a [](");
+            Assert::AreEqual<std::string>("<p>a [](</p>", parser3.TransformToHtml());
+
+            MarkDownParser parser4("[x]() b");
+            Assert::AreEqual<std::string>("<p><a href=\"\">x</a> b</p>", parser4.TransformToHtml());
+
+            MarkDownParser parser5("- [](");
+            Assert::AreEqual<std::string>("<ul><li>[](</li></ul>", parser5.TransformToHtml());
+
+            MarkDownParser parser6("[[](");
+            Assert::AreEqual<std::string>("<p>[[](</p>", parser6.TransformToHtml());
+
+            MarkDownParser parser7("[](");
+            const auto runs = parser7.TransformToInlineRuns();
+            Assert::AreEqual(1U, static_cast<unsigned int>(runs.size()));
+            AssertTextRun(runs[0], "[](", false, false);
+        }
+
+        TEST_METHOD(EmphasisTest_MixedDelimiterRuns)
+        {
+            MarkDownParser parser1("*_");
+            Assert::AreEqual<std::string>("<p>*_</p>", parser1.TransformToHtml());
+
+            MarkDownParser parser2("a *_b_* c");
+            Assert::AreEqual<std::string>("<p>a <em><em>b</em></em> c</p>", parser2.TransformToHtml());
+        }
+
+        TEST_METHOD(NestedBlocksTest_DeepNestingTakesLinearTime)
+        {
+            // links and list items only nest so deep, past which their markers are text; without the limit, each
+            // of these took seconds
+            for (const std::string marker : {"[", "- ", "1. ", "[a]("})
+            {
+                std::string input;
+                while (input.size() < 8192)
+                {
+                    input += marker;
+                }
+
+                const auto start = std::chrono::steady_clock::now();
+                MarkDownParser parser(input);
+                const auto html = parser.TransformToHtml();
+                const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+                Assert::IsTrue(elapsed.count() < 1000);
+                Logger::WriteMessage(("MarkDown with "s + std::to_string(input.size()) + " chars of " + marker + ": " +
+                                      std::to_string(elapsed.count()) + "ms")
+                                         .c_str());
+            }
+
+            // every char of the markers is kept
+            MarkDownParser parser(std::string(4096, '['));
+            Assert::AreEqual("<p>"s + std::string(4096, '[') + "</p>", parser.TransformToHtml());
+        }
+
+        TEST_METHOD(NestedBlocksTest_NestingStopsAt16)
+        {
+            const auto nested = [](const std::string& marker, unsigned int depth) {
+                std::string text;
+                for (unsigned int i = 0; i < depth; ++i)
+                {
+                    text += marker;
+                }
+                return text + "a";
+            };
+            const auto items = [](const std::string& open, const std::string& text, const std::string& close) {
+                std::string html = open;
+                for (int i = 0; i < 16; ++i)
+                {
+                    html += "<li>";
+                }
+                html += text;
+                for (int i = 0; i < 16; ++i)
+                {
+                    html += "</li>";
+                }
+                return html + close;
+            };
+
+            // 16 list items nest
+            MarkDownParser parser1(nested("- ", 16));
+            Assert::AreEqual(items("<ul>", "a", "</ul>"), parser1.TransformToHtml());
+
+            // the marker of a 17th is text
+            MarkDownParser parser2(nested("- ", 17));
+            Assert::AreEqual(items("<ul>", "- a", "</ul>"), parser2.TransformToHtml());
+
+            MarkDownParser parser3(nested("1. ", 16));
+            Assert::AreEqual(items("<ol start=\"1\">", "a", "</ol>"), parser3.TransformToHtml());
+
+            MarkDownParser parser4(nested("1. ", 17));
+            Assert::AreEqual(items("<ol start=\"1\">", "1. a", "</ol>"), parser4.TransformToHtml());
+        }
+
+        TEST_METHOD(NestedBlocksTest_LinkNestingStopsAt16)
+        {
+            const auto nested = [](unsigned int depth) {
+                std::string text;
+                for (unsigned int i = 0; i < depth; ++i)
+                {
+                    text += "[";
+                }
+                text += "a";
+                for (unsigned int i = 0; i < depth; ++i)
+                {
+                    text += "](u)";
+                }
+                return text;
+            };
+            const auto links = [](const std::string& text, const std::string& after) {
+                std::string html = "<p>";
+                for (int i = 0; i < 16; ++i)
+                {
+                    html += "<a href=\"u\">";
+                }
+                html += text;
+                for (int i = 0; i < 16; ++i)
+                {
+                    html += "</a>";
+                }
+                return html + after + "</p>";
+            };
+
+            // 16 links nest
+            MarkDownParser parser1(nested(16));
+            Assert::AreEqual(links("a", ""), parser1.TransformToHtml());
+
+            // the opener of a 17th is text, and so is the closer left over
+            MarkDownParser parser2(nested(17));
+            Assert::AreEqual(links("[a", "](u)"), parser2.TransformToHtml());
+        }
+
+        TEST_METHOD(EmphasisTest_MixedDelimiterRunsKeepEveryChar)
+        {
+            // each switch between * and _ dropped the run before it, which made this <p>_*_ with no closing tag
+            MarkDownParser parser1("*_*_*_");
+            Assert::AreEqual<std::string>("<p><em>_</em><em>*</em></p>", parser1.TransformToHtml());
+
+            MarkDownParser parser2("*_*_*_ a");
+            Assert::AreEqual<std::string>("<p><em>_</em><em>*</em> a</p>", parser2.TransformToHtml());
+
+            MarkDownParser parser3("*__*");
+            Assert::AreEqual<std::string>("<p><em>__</em></p>", parser3.TransformToHtml());
+        }
+
+        static void AssertTextRun(const MarkDownInlineRun& run, const std::string& text, bool isBold, bool isItalic, const std::string& url = "")
+        {
+            Assert::IsTrue(MarkDownInlineRun::Type::Text == run.GetType());
+            Assert::AreEqual(text, run.GetText());
+            Assert::AreEqual(isBold, run.IsBold());
+            Assert::AreEqual(isItalic, run.IsItalic());
+            Assert::AreEqual(url, run.GetUrl());
+        }
+
+        TEST_METHOD(InlineRunsTest_Emphasis)
+        {
+            MarkDownParser parser("Hello **bold *both* bold** & _it_");
+            auto runs = parser.TransformToInlineRuns();
+            Assert::AreEqual(6U, static_cast<unsigned int>(runs.size()));
+            AssertTextRun(runs[0], "Hello ", false, false);
+            AssertTextRun(runs[1], "bold ", true, false);
+            AssertTextRun(runs[2], "both", true, true);
+            AssertTextRun(runs[3], " bold", true, false);
+            AssertTextRun(runs[4], " & ", false, false);
+            AssertTextRun(runs[5], "it", false, true);
+            Assert::IsTrue(parser.IsEscaped());
+        }
+
+        TEST_METHOD(InlineRunsTest_Link)
+        {
+            MarkDownParser parser("[**link** text](https://example.com?a=1&b=2) after");
+            auto runs = parser.TransformToInlineRuns();
+            Assert::AreEqual(3U, static_cast<unsigned int>(runs.size()));
+            AssertTextRun(runs[0], "link", true, false, "https://example.com?a=1&b=2");
+            AssertTextRun(runs[1], " text", false, false, "https://example.com?a=1&b=2");
+            AssertTextRun(runs[2], " after", false, false);
+            Assert::IsTrue(parser.HasHtmlTags());
+        }
+
+        TEST_METHOD(InlineRunsTest_Lists)
+        {
+            MarkDownParser parser("para\n- one\n- *two*\n\n3. three\n4. four");
+            auto runs = parser.TransformToInlineRuns();
+            Assert::AreEqual(11U, static_cast<unsigned int>(runs.size()));
+            AssertTextRun(runs[0], "para", false, false);
+            Assert::IsTrue(MarkDownInlineRun::Type::ParagraphBreak == runs[1].GetType());
+            Assert::IsTrue(MarkDownInlineRun::Type::ListItem == runs[2].GetType());
+            Assert::AreEqual(0U, runs[2].GetOrdinal());
+            AssertTextRun(runs[3], "one", false, false);
+            Assert::AreEqual(0U, runs[4].GetOrdinal());
+            AssertTextRun(runs[5], "two", false, true);
+            Assert::IsTrue(MarkDownInlineRun::Type::ParagraphBreak == runs[6].GetType());
+            Assert::AreEqual(3U, runs[7].GetOrdinal());
+            AssertTextRun(runs[8], "three", false, false);
+            Assert::AreEqual(4U, runs[9].GetOrdinal());
+            AssertTextRun(runs[10], "four", false, false);
+        }
+
+        TEST_METHOD(InlineRunsTest_Empty)
+        {
+            MarkDownParser parser("");
+            Assert::IsTrue(parser.TransformToInlineRuns().empty());
+        }
     };
 }
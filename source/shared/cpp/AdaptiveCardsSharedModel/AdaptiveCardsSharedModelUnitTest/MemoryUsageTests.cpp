@@ -0,0 +1,106 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AllocationCounter.h"
+#include "SampleCards.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(MemoryUsageTests)
+    {
+    public:
+        TEST_METHOD(UsageByCategory)
+        {
+            const std::string text(1000, 'a');
+            const std::string json = R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "lang": "not a language",
+                "unknownProperty": { "some": "value" },
+                "body": [
+                    { "type": "TextBlock", "text": ")" + text + R"(", "unknownProperty": [ 1, 2, 3 ] },
+                    { "type": "Graph", "points": [ 1, 2 ] }
+                ],
+                "actions": [
+                    { "type": "Action.Submit", "data": { "id": ")" + text + R"(" } },
+                    { "type": "Action.ShowCard", "card": { "type": "AdaptiveCard", "body": [ { "type": "TextBlock", "text": ")" + text + R"(" } ] } }
+                ]
+            })";
+
+            const auto parseResult = AdaptiveCard::DeserializeFromString(json, "1.0");
+            Assert::IsFalse(parseResult->GetWarnings().empty());
+
+            const auto usage = parseResult->GetMemoryUsage();
+            Assert::IsTrue(usage.elements > 0);
+            Assert::IsTrue(usage.strings > text.size());
+            Assert::IsTrue(usage.json > text.size());
+            Assert::IsTrue(usage.vectors > 0);
+            Assert::IsTrue(usage.warnings > 0);
+
+            const auto showCard = std::static_pointer_cast<ShowCardAction>(parseResult->GetAdaptiveCard()->GetActions()[1]);
+            Assert::AreEqual(showCard->GetCard()->GetMemoryUsage().GetTotal(), usage.showCards);
+            Assert::IsTrue(usage.showCards > text.size());
+
+            // warnings belong to the parse result, not to the card
+            const auto cardUsage = parseResult->GetAdaptiveCard()->GetMemoryUsage();
+            Assert::AreEqual(0U, static_cast<unsigned int>(cardUsage.warnings));
+            Assert::AreEqual(usage.GetTotal() - usage.warnings, cardUsage.GetTotal());
+        }
+
+        TEST_METHOD(UsageMatchesAllocatedBytes)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            // parse once so that the statics of the parsers are allocated before counting
+            std::vector<std::shared_ptr<ParseResult>> results;
+            for (const auto& card : cards)
+            {
+                try
+                {
+                    AdaptiveCard::DeserializeFromString(card, "1.2");
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // not all samples are cards of this version
+                }
+            }
+            results.reserve(cards.size());
+
+            AllocationCounter counter;
+            for (const auto& card : cards)
+            {
+                try
+                {
+                    results.push_back(AdaptiveCard::DeserializeFromString(card, "1.2"));
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                }
+            }
+            const auto liveBytes = counter.GetLiveBytes();
+
+            AllocationCounter usageCounter;
+            size_t usageBytes = 0;
+            for (const auto& result : results)
+            {
+                usageBytes += result->GetMemoryUsage().GetTotal();
+            }
+            Assert::AreEqual(0ULL, static_cast<unsigned long long>(usageCounter.GetAllocations()));
+
+            // the usage doesn't count the overhead of the allocator, nor the strings of the string pools
+            const auto ratio = static_cast<double>(usageBytes) / liveBytes;
+            Assert::IsTrue(ratio > 0.9 && ratio < 1.1);
+
+            Logger::WriteMessage(("Parsed "s + std::to_string(results.size()) + " sample cards: " + std::to_string(liveBytes) +
+                                  " bytes allocated, " + std::to_string(usageBytes) + " bytes of memory usage")
+                                     .c_str());
+        }
+    };
+}
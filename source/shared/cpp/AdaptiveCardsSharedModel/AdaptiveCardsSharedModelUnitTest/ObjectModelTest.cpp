@@ -7,6 +7,7 @@
 #include "ColumnSet.h"
 #include "Container.h"
 #include "FeatureRegistration.h"
+#include "ImageSet.h"
 #include "Media.h"
 #include "OpenUrlAction.h"
 #include "ParseContext.h"
@@ -578,5 +579,93 @@ namespace AdaptiveCardsSharedModelUnitTest
                 Assert::AreEqual("Unable to parse element of type Elephant", e.GetReason().c_str(), L"GetReason incorrect");
             }
         }
+
+        TEST_METHOD(ImpliedTypeReplacesEmptyAndNonStringTypesTest)
+        {
+            // A column or an image of an image set whose type is empty or isn't a string gets the type its collection
+            // implies, both when it's parsed and when it's validated
+            for (const std::string type : {R"("")", "null", "{}", "[]", "5"})
+            {
+                const std::string columnSetCard =
+                    R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "ColumnSet", "columns": [{"type": )" +
+                    type + R"(, "items": []}]}]})";
+                auto card = AdaptiveCard::DeserializeFromString(columnSetCard, "1.0")->GetAdaptiveCard();
+                auto column = std::static_pointer_cast<ColumnSet>(card->GetBody()[0])->GetColumns()[0];
+                Assert::AreEqual("Column"s, column->GetElementTypeString());
+                Assert::AreEqual("Column"s, column->SerializeToJsonValue()["type"].asString());
+                AdaptiveCard::ValidateFromString(columnSetCard, "1.0");
+
+                const std::string imageSetCard =
+                    R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "ImageSet", "images": [{"type": )" +
+                    type + R"(, "url": "http://adaptivecards.io/content/cats/1.png"}]}]})";
+                card = AdaptiveCard::DeserializeFromString(imageSetCard, "1.0")->GetAdaptiveCard();
+                auto image = std::static_pointer_cast<ImageSet>(card->GetBody()[0])->GetImages()[0];
+                Assert::AreEqual("Image"s, image->GetElementTypeString());
+                Assert::AreEqual("Image"s, image->SerializeToJsonValue()["type"].asString());
+                AdaptiveCard::ValidateFromString(imageSetCard, "1.0");
+            }
+        }
+
+        TEST_METHOD(NullItemsOfImpliedTypeTest)
+        {
+            // A null column is parsed as an empty column
+            const std::string columnSetCard =
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "ColumnSet", "columns": [null]}]})";
+            auto card = AdaptiveCard::DeserializeFromString(columnSetCard, "1.0")->GetAdaptiveCard();
+            auto column = std::static_pointer_cast<ColumnSet>(card->GetBody()[0])->GetColumns()[0];
+            Assert::AreEqual("Column"s, column->GetElementTypeString());
+            Assert::IsTrue(column->GetItems().empty());
+            Assert::IsTrue(AdaptiveCard::ValidateFromString(columnSetCard, "1.0").empty());
+
+            // A null image is parsed as an image without a url, which it requires
+            const std::string imageSetCard =
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "ImageSet", "images": [null]}]})";
+            try
+            {
+                AdaptiveCard::DeserializeFromString(imageSetCard, "1.0");
+                Assert::Fail(L"Deserializing should throw an exception");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::RequiredPropertyMissing == e.GetStatusCode(), L"ErrorStatusCode incorrect");
+            }
+        }
+
+        TEST_METHOD(MalformedCardsThrowParseExceptionsTest)
+        {
+            // each of these once escaped as a JSON exception, or crashed
+            const std::vector<std::string> cards = {
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [["TextBlock"]]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": ["TextBlock"]}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "ColumnSet", "columns": [[]]}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": "a", "requires": {"a": 1}}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "text": {"a": 1}}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": )" + std::string(2000, '[')};
+
+            for (const auto& card : cards)
+            {
+                Assert::ExpectException<AdaptiveCardParseException>([&]() { AdaptiveCard::DeserializeFromString(card, "1.0"); });
+            }
+        }
+
+        TEST_METHOD(TextBlockDateParsingCacheTest)
+        {
+            TextBlock textBlock;
+            textBlock.SetText("Due {{DATE(2017-02-14T06:08:00Z)}}");
+
+            // Repeated calls return the same preparsed text
+            const DateTimePreparser& preparsed = textBlock.GetTextForDateParsing();
+            Assert::IsTrue(&preparsed == &textBlock.GetTextForDateParsing());
+            Assert::IsTrue(preparsed.HasDateTokens());
+            Assert::AreEqual(2U, static_cast<unsigned int>(preparsed.GetTextTokens().size()));
+
+            // Changing the text or language invalidates it
+            textBlock.SetText("No dates");
+            Assert::IsFalse(textBlock.GetTextForDateParsing().HasDateTokens());
+            Assert::AreEqual("No dates"s, textBlock.GetTextForDateParsing().GetTextTokens()[0]->GetText());
+
+            textBlock.SetLanguage("fr");
+            Assert::AreEqual(1U, static_cast<unsigned int>(textBlock.GetTextForDateParsing().GetTextTokens().size()));
+        }
     };
 }
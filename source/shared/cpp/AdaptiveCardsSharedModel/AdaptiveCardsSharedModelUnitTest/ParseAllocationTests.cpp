@@ -0,0 +1,135 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AllocationCounter.h"
+#include "Container.h"
+#include "Fact.h"
+#include "SampleCards.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ParseAllocationTests)
+    {
+    public:
+        TEST_METHOD(SettersMoveStrings)
+        {
+            std::string text(1000, 'a');
+            const char* textData = text.data();
+            TextBlock textBlock;
+            textBlock.SetText(std::move(text));
+            Assert::IsTrue(textData == textBlock.GetText().data());
+
+            std::string title(1000, 't');
+            std::string value(1000, 'v');
+            const char* titleData = title.data();
+            const char* valueData = value.data();
+            Fact fact(std::move(title), std::move(value));
+            Assert::IsTrue(titleData == fact.GetTitle().data());
+            Assert::IsTrue(valueData == fact.GetValue().data());
+
+            std::vector<std::shared_ptr<BaseCardElement>> body{std::make_shared<TextBlock>()};
+            std::string fallbackText(1000, 'f');
+            const auto* bodyData = body.data();
+            const char* fallbackTextData = fallbackText.data();
+            AdaptiveCard card("1.0",
+                              std::move(fallbackText),
+                              "",
+                              ContainerStyle::Default,
+                              "",
+                              "",
+                              VerticalContentAlignment::Top,
+                              HeightType::Auto,
+                              0,
+                              std::move(body),
+                              {});
+            Assert::IsTrue(bodyData == card.GetBody().data());
+            Assert::IsTrue(fallbackTextData == card.GetFallbackText().data());
+        }
+
+        TEST_METHOD(LargeTextIsNotCopiedDuringParse)
+        {
+            // a long text nested in a container and a show card, so that copies of json subtrees would show
+            const std::string text(100000, 'a');
+            const std::string json = R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "Container", "items": [{"type": "TextBlock", "text": ")"s +
+                                     text +
+                                     R"("}]}], "actions": [{"type": "Action.ShowCard", "title": "Show", "card": {"type": "AdaptiveCard", "body": [{"type": "TextBlock", "text": ")" +
+                                     text + R"("}]}}]})";
+
+            AllocationCounter counter;
+            auto parseResult = AdaptiveCard::DeserializeFromString(json, "1.0");
+            const auto bytes = counter.GetBytes();
+            const auto allocations = counter.GetAllocations();
+            Assert::IsTrue(parseResult->GetWarnings().empty());
+
+            // the json reader decodes each text before storing it, and the text element keeps its own copy; anything
+            // more is a copy made by the parse
+            Assert::IsTrue(bytes < 2 * 3 * text.size());
+
+            Logger::WriteMessage(("Parsed a card with two "s + std::to_string(text.size()) + " char texts: " +
+                                  std::to_string(allocations) + " allocations, " + std::to_string(bytes) + " bytes")
+                                     .c_str());
+        }
+
+        TEST_METHOD(TextElementsAreSingleAllocations)
+        {
+            // text properties are part of the text element, so copies don't share them
+            TextBlock textBlock;
+            textBlock.SetText("original");
+            TextBlock copy(textBlock);
+            copy.SetText("copy");
+            Assert::AreEqual("original"s, textBlock.GetText());
+
+            AllocationCounter textBlockCounter;
+            const auto emptyTextBlock = std::make_shared<TextBlock>();
+            const auto textBlockAllocations = textBlockCounter.GetAllocations();
+            const auto textBlockBytes = textBlockCounter.GetBytes();
+
+            AllocationCounter textRunCounter;
+            const auto textRun = std::make_shared<TextRun>();
+            const auto textRunAllocations = textRunCounter.GetAllocations();
+            const auto textRunBytes = textRunCounter.GetBytes();
+
+            Logger::WriteMessage(("Made a text block in "s + std::to_string(textBlockAllocations) + " allocations of " +
+                                  std::to_string(textBlockBytes) + " bytes, a text run in " + std::to_string(textRunAllocations) +
+                                  " allocations of " + std::to_string(textRunBytes) + " bytes")
+                                     .c_str());
+        }
+
+        TEST_METHOD(SamplesParseAllocationBenchmark)
+        {
+            const auto cards = LoadSampleCards();
+            Assert::IsFalse(cards.empty());
+
+            unsigned long long allocations = 0;
+            unsigned long long bytes = 0;
+            size_t parsed = 0;
+            for (const auto& card : cards)
+            {
+                try
+                {
+                    AllocationCounter counter;
+                    auto parseResult = AdaptiveCard::DeserializeFromString(card, "1.2");
+                    allocations += counter.GetAllocations();
+                    bytes += counter.GetBytes();
+                    ++parsed;
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // not all samples are cards of this version
+                }
+            }
+            Assert::IsTrue(parsed > 0);
+
+            Logger::WriteMessage(("Parsed "s + std::to_string(parsed) + " sample cards: " + std::to_string(allocations) +
+                                  " allocations, " + std::to_string(bytes) + " bytes")
+                                     .c_str());
+        }
+    };
+}
@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "DateTimePreparser.h"
+#include "HostConfig.h"
+#include "MarkDownParser.h"
+#include "ParseObserver.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Records the events it's notified of, as "begin Element/TextBlock 1"
+    class RecordingObserver : public ParseObserver
+    {
+    public:
+        void OnBegin(const ParseEvent& event) override { events.push_back("begin " + Describe(event)); }
+        void OnEnd(const ParseEvent& event, std::chrono::nanoseconds) override { events.push_back("end " + Describe(event)); }
+
+        std::vector<std::string> events;
+
+    private:
+        static std::string Describe(const ParseEvent& event)
+        {
+            return ParseEventKindToString(event.kind) + (event.type.empty() ? ""s : "/" + event.type) + " " +
+                   std::to_string(event.depth);
+        }
+    };
+
+    TEST_CLASS(ParseObserverTests)
+    {
+    private:
+        const std::string m_card = R"({
+            "type": "AdaptiveCard",
+            "version": "1.0",
+            "body": [
+                {
+                    "type": "Container",
+                    "items": [
+                        { "type": "TextBlock", "text": "First" },
+                        { "type": "TextBlock", "text": "Second" }
+                    ]
+                }
+            ],
+            "actions": [
+                { "type": "Action.Submit", "title": "Submit" }
+            ]
+        })";
+
+    public:
+        TEST_METHOD(EventsNest)
+        {
+            auto observer = std::make_shared<RecordingObserver>();
+            ParseContext context;
+            context.SetParseObserver(observer);
+            AdaptiveCard::DeserializeFromString(m_card, "1.0", context);
+
+            const std::vector<std::string> expected{"begin JsonRead 0",
+                                                    "end JsonRead 0",
+                                                    "begin Element/Container 0",
+                                                    "begin Element/TextBlock 1",
+                                                    "end Element/TextBlock 1",
+                                                    "begin Element/TextBlock 1",
+                                                    "end Element/TextBlock 1",
+                                                    "end Element/Container 0",
+                                                    "begin Action/Action.Submit 0",
+                                                    "end Action/Action.Submit 0"};
+            Assert::IsTrue(expected == observer->events);
+        }
+
+        TEST_METHOD(HistogramCollector)
+        {
+            auto collector = std::make_shared<ParseHistogramCollector>();
+            ParseContext context;
+            context.SetParseObserver(collector);
+            for (int i = 0; i < 10; ++i)
+            {
+                AdaptiveCard::DeserializeFromString(m_card, "1.0", context);
+            }
+
+            const auto histograms = collector->GetHistograms();
+            Assert::AreEqual(4U, static_cast<unsigned int>(histograms.size()));
+            Assert::AreEqual(10ULL, histograms.at("JsonRead").count);
+            Assert::AreEqual(10ULL, histograms.at("Element/Container").count);
+            Assert::AreEqual(10ULL, histograms.at("Action/Action.Submit").count);
+
+            const auto& textBlocks = histograms.at("Element/TextBlock");
+            Assert::AreEqual(20ULL, textBlocks.count);
+            Assert::AreEqual(1U, textBlocks.maxDepth);
+            Assert::AreEqual(10ULL * 2 * R"({ "type": "TextBlock", "text": "First" })"s.size() + 10, textBlocks.totalBytes);
+
+            unsigned long long bucketed = 0;
+            for (const auto bucket : textBlocks.buckets)
+            {
+                bucketed += bucket;
+            }
+            Assert::AreEqual(textBlocks.count, bucketed);
+            Assert::IsTrue(textBlocks.GetPercentileNanoseconds(0.5) <= textBlocks.GetPercentileNanoseconds(0.99));
+            Assert::IsTrue(textBlocks.GetPercentileNanoseconds(0.99) <= textBlocks.maxNanoseconds);
+
+            const auto json = collector->SerializeToJsonValue();
+            Assert::AreEqual(20U, json["Element/TextBlock"]["count"].asUInt());
+
+            collector->Reset();
+            Assert::IsTrue(collector->GetHistograms().empty());
+        }
+
+        TEST_METHOD(GlobalObserver)
+        {
+            Assert::IsTrue(ParseObserver::GetGlobal() == nullptr);
+            Assert::IsTrue(ParseContext().GetParseObserver() == nullptr);
+
+            auto collector = std::make_shared<ParseHistogramCollector>();
+            ParseObserver::SetGlobal(collector);
+            ParseContext context;
+            Assert::IsTrue(context.GetParseObserver() == collector.get());
+
+            MarkDownParser("Hello **world**").TransformToHtml();
+            MarkDownParser("Hello _world_").TransformToInlineRuns();
+            DateTimePreparser("Sent {{DATE(2017-02-14T06:08:39Z, SHORT)}}");
+            HostConfig::DeserializeFromString(R"({ "fontFamily": "Segoe UI" })");
+            AdaptiveCard::DeserializeFromString(m_card, "1.0", context);
+            ParseObserver::SetGlobal(nullptr);
+
+            const auto histograms = collector->GetHistograms();
+            Assert::AreEqual(2ULL, histograms.at("MarkDown").count);
+            Assert::AreEqual(15ULL + 13ULL, histograms.at("MarkDown").totalBytes);
+            Assert::AreEqual(1ULL, histograms.at("DateTimePreparse").count);
+            Assert::AreEqual(1ULL, histograms.at("HostConfig").count);
+            Assert::AreEqual(2ULL, histograms.at("JsonRead").count);
+            Assert::AreEqual(2ULL, histograms.at("Element/TextBlock").count);
+
+            // contexts made once the global observer is cleared don't notify it
+            ParseContext unobserved;
+            AdaptiveCard::DeserializeFromString(m_card, "1.0", unobserved);
+            Assert::AreEqual(2ULL, collector->GetHistograms().at("Element/TextBlock").count);
+        }
+    };
+}
@@ -55,6 +55,7 @@ namespace AdaptiveCardsSharedModelUnitTest
         TEST_METHOD(GetJsonValueFromStringTests)
         {
             Assert::ExpectException<AdaptiveCardParseException>([]() { ParseUtil::GetJsonValueFromString("definitely not json"); });
+            Assert::ExpectException<AdaptiveCardParseException>([]() { ParseUtil::GetJsonValueFromString(std::string(2000, '[')); });
             auto jsonValue = ParseUtil::GetJsonValueFromString("{ \"foo\": \"bar\" }");
             Assert::AreEqual(jsonValue["foo"].asCString(), "bar", false);
         }
@@ -88,6 +89,12 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto typeAsString = ParseUtil::GetTypeAsString(typedValue);
             Assert::AreEqual(typeName, typeAsString);
             Assert::AreEqual(ParseUtil::TryGetTypeAsString(typedValue), typeName);
+
+            // arrays, and types that aren't strings, throw parse exceptions rather than JSON ones
+            auto arrayValue = s_GetJsonObject("[ \"type\" ]");
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetTypeAsString(arrayValue); });
+            auto objectTypedValue = s_GetJsonObject("{ \"type\": { \"foo\": \"bar\" } }");
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { ParseUtil::GetTypeAsString(objectTypedValue); });
         }
 
         TEST_METHOD(ExpectTypeStringTests)
@@ -291,5 +298,31 @@ namespace AdaptiveCardsSharedModelUnitTest
             auto actualString = ParseUtil::GetJsonString(jsonObjWithValidType, AdaptiveCardSchemaKey::Accent, true);
             Assert::AreEqual(actualString, "\"Valid\"\n"s);
         }
+
+        TEST_METHOD(ToLowercaseTests)
+        {
+            Assert::AreEqual("stretch"s, ParseUtil::ToLowercase("Stretch"s));
+            Assert::AreEqual("50px"s, ParseUtil::ToLowercase("50PX"s));
+            Assert::AreEqual(""s, ParseUtil::ToLowercase(""s));
+            // non-ASCII UTF-8 is left alone
+            Assert::AreEqual("\xC3\x89t\xC3\xa9"s, ParseUtil::ToLowercase("\xC3\x89T\xC3\xa9"s));
+        }
+
+        TEST_METHOD(IsValidLanguageTagTests)
+        {
+            for (const auto& tag : {"en"s, "DE"s, "fil"s, "en-US"s, "zh-Hant-TW"s, "zh-yue-HK"s, "sr-Latn-RS"s,
+                                    "es-419"s, "de-CH-1901"s, "sl-rozaj-biske"s, "en-a-bbb-x-a-ccc"s, "x-whatever"s,
+                                    "qaa-Qaaa-QM-x-southern"s, "i-klingon"s, "en-GB-oed"s, "abcdefgh"s, "en-a-bbb-ccc-b-ddd"s})
+            {
+                Assert::IsTrue(ParseUtil::IsValidLanguageTag(tag));
+            }
+
+            for (const auto& tag : {""s, "e"s, "englishlanguage"s, "en_US"s, "en-"s, "-en"s, "en--US"s, "en-US-"s,
+                                    "123"s, "en-a"s, "en-a-x-foo"s, "x"s, "x-"s, "x-toolongvalue"s, "en-GB-oedx"s,
+                                    "de-419-DE"s, "en-US-x"s, "\xC3\xa9n"s})
+            {
+                Assert::IsFalse(ParseUtil::IsValidLanguageTag(tag));
+            }
+        }
     };
 }
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ParseWarningSink.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ParseWarningSinkTests)
+    {
+    private:
+        static std::string MakeImage(const std::string& backgroundColor, const std::string& width = "")
+        {
+            return R"({ "type": "Image", "url": "a.png", "backgroundColor": ")" + backgroundColor + R"(", "width": ")" + width + R"(" })";
+        }
+
+        static std::string MakeCard(const std::string& body, const std::string& actions = "")
+        {
+            return R"({ "type": "AdaptiveCard", "version": "1.2", "body": [ )" + body + R"( ], "actions": [ )" + actions + " ] }";
+        }
+
+    public:
+        TEST_METHOD(RepeatedWarningsAreAggregated)
+        {
+            std::string body;
+            for (int i = 0; i < 1000; ++i)
+            {
+                body += (i ? "," : "") + MakeImage("red");
+            }
+
+            auto parseResult = AdaptiveCard::DeserializeFromString(MakeCard(body), "1.2");
+            const auto warnings = parseResult->GetWarnings();
+            Assert::AreEqual(size_t{1}, warnings.size());
+            Assert::IsTrue(WarningStatusCode::InvalidColorFormat == warnings[0]->GetStatusCode());
+            Assert::AreEqual("Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format (1000 occurrences)"s,
+                             warnings[0]->GetReason());
+        }
+
+        TEST_METHOD(DistinctWarningsAreCapped)
+        {
+            std::string body;
+            for (int i = 0; i < 10; ++i)
+            {
+                body += (i ? "," : "") + MakeImage("", std::to_string(i) + ".5.5px");
+            }
+
+            ParseContext context;
+            context.GetWarningSink().SetMaxWarnings(3);
+            auto parseResult = AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(MakeCard(body)), "1.2", context);
+
+            const auto warnings = parseResult->GetWarnings();
+            Assert::AreEqual(size_t{4}, warnings.size());
+            Assert::AreEqual("expected input arugment to be specified as \\d+(\\.\\d+)?px with no spaces, but received 0.5.5px"s,
+                             warnings[0]->GetReason());
+            Assert::IsTrue(WarningStatusCode::CustomWarning == warnings[3]->GetStatusCode());
+            Assert::AreEqual("7 more warnings dropped"s, warnings[3]->GetReason());
+        }
+
+        TEST_METHOD(FlushStartsTheCountsAndTheCapOver)
+        {
+            ParseWarningSink sink;
+            sink.SetMaxWarnings(2);
+            sink.AddWarning(WarningStatusCode::InvalidColorFormat, "Invalid color: ", "a");
+            sink.AddWarning(WarningStatusCode::InvalidColorFormat, "Invalid color: ", "a");
+            sink.AddWarning(WarningStatusCode::InvalidColorFormat, "Invalid color: ", "b");
+            sink.AddWarning(WarningStatusCode::InvalidLanguage, "Invalid language: ", "c");
+            sink.AddWarning(WarningStatusCode::InvalidLanguage, "Invalid language: ", "c");
+
+            Assert::AreEqual(3U, sink.GetWarningCount(WarningStatusCode::InvalidColorFormat));
+            Assert::AreEqual(5U, sink.GetTotalWarningCount());
+            Assert::AreEqual(2U, sink.GetDroppedWarningCount());
+
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+            sink.Flush(warnings);
+            Assert::AreEqual(size_t{3}, warnings.size());
+            Assert::AreEqual("Invalid color: a (2 occurrences)"s, warnings[0]->GetReason());
+            Assert::AreEqual("2 more warnings dropped"s, warnings[2]->GetReason());
+            Assert::AreEqual(0U, sink.GetWarningCount(WarningStatusCode::InvalidColorFormat));
+            Assert::AreEqual(0U, sink.GetTotalWarningCount());
+            Assert::AreEqual(0U, sink.GetDroppedWarningCount());
+
+            // The dropped warnings fit under the cap again
+            sink.AddWarning(WarningStatusCode::InvalidColorFormat, "Invalid color: ", "b");
+            sink.AddWarning(WarningStatusCode::InvalidLanguage, "Invalid language: ", "c");
+            warnings.clear();
+            sink.Flush(warnings);
+            Assert::AreEqual(size_t{2}, warnings.size());
+            Assert::AreEqual("Invalid color: b"s, warnings[0]->GetReason());
+            Assert::AreEqual("Invalid language: c"s, warnings[1]->GetReason());
+        }
+
+        TEST_METHOD(NestedCardWarningsAreReportedOnce)
+        {
+            // Three levels of show cards, each with an invalid color and a warning of its own
+            std::string card = MakeCard(MakeImage("#12", "9..px"));
+            for (int i = 0; i < 3; ++i)
+            {
+                const std::string showCard = R"({ "type": "Action.ShowCard", "title": "Show", "card": )" + card + " }";
+                card = MakeCard(MakeImage("#12", std::to_string(i) + "..px"), showCard);
+            }
+
+            ParseContext context;
+            auto parseResult = AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(card), "1.2", context);
+            const auto warnings = parseResult->GetWarnings();
+
+            Assert::AreEqual(5U, static_cast<unsigned int>(warnings.size()));
+            Assert::IsTrue(WarningStatusCode::InvalidColorFormat == warnings[0]->GetStatusCode());
+            Assert::AreEqual("Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format (4 occurrences)"s,
+                             warnings[0]->GetReason());
+            // Flushing the outermost card started the counts over
+            Assert::AreEqual(0U, context.GetWarningSink().GetTotalWarningCount());
+        }
+
+        TEST_METHOD(WarningsOutsideOfACardAreAddedImmediately)
+        {
+            ParseContext context;
+            context.AddWarning(WarningStatusCode::InvalidLanguage, "Invalid language identifier: ", "xx-");
+            context.AddWarning(WarningStatusCode::InvalidLanguage, "Invalid language identifier: ", "xx-");
+
+            Assert::AreEqual(size_t{2}, context.warnings.size());
+            Assert::AreEqual("Invalid language identifier: xx-"s, context.warnings[1]->GetReason());
+            Assert::IsFalse(context.GetWarningSink().HasPendingWarnings());
+        }
+    };
+}
@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "HostConfig.h"
+#include "PrefetchPlan.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(PrefetchPlanTests)
+    {
+    private:
+        void ValidateResource(const PrefetchResource& resource,
+                              const std::string& url,
+                              PrefetchPriority priority,
+                              unsigned int targetWidth,
+                              unsigned int targetHeight)
+        {
+            Assert::AreEqual(url, resource.url);
+            Assert::IsTrue(priority == resource.priority);
+            Assert::AreEqual(targetWidth, resource.targetWidth);
+            Assert::AreEqual(targetHeight, resource.targetHeight);
+        }
+
+    public:
+        TEST_METHOD(ResourcesAreInRenderOrder)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "backgroundImage": "Background.png",
+                "body": [
+                    { "type": "Image", "url": "Small.png", "size": "small" },
+                    { "type": "Image", "url": "Explicit.png", "width": "50px", "height": "40px" },
+                    { "type": "Image", "url": "Auto.png" },
+                    {
+                        "type": "ImageSet",
+                        "imageSize": "large",
+                        "images": [
+                            { "type": "Image", "url": "ImageSet1.png" },
+                            { "type": "Image", "url": "ImageSet2.png", "isVisible": false }
+                        ]
+                    },
+                    {
+                        "type": "ColumnSet",
+                        "columns": [
+                            { "type": "Column", "items": [ { "type": "Image", "url": "Column1.png", "size": "medium" } ] },
+                            { "type": "Column", "isVisible": false, "items": [ { "type": "Image", "url": "Column2.png" } ] }
+                        ]
+                    },
+                    {
+                        "type": "Media",
+                        "poster": "Poster.png",
+                        "sources": [ { "mimeType": "video/mp4", "url": "Media.mp4" } ]
+                    }
+                ],
+                "actions": [
+                    {
+                        "type": "Action.ShowCard",
+                        "title": "Show",
+                        "iconUrl": "Icon.png",
+                        "card": {
+                            "type": "AdaptiveCard",
+                            "body": [ { "type": "Image", "url": "ShowCard.png" } ]
+                        }
+                    }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            HostConfig hostConfig;
+
+            auto plan = BuildPrefetchPlan(*card, hostConfig, 10000);
+            Assert::AreEqual(size_t{12}, plan.size());
+
+            const unsigned int setHeight = std::min(hostConfig.GetImageSizes().largeSize, hostConfig.GetImageSet().maxImageHeight);
+            ValidateResource(plan[0], "Background.png", PrefetchPriority::AboveTheFold, 0, 0);
+            ValidateResource(plan[1], "Small.png", PrefetchPriority::AboveTheFold, 80, 80);
+            ValidateResource(plan[2], "Explicit.png", PrefetchPriority::AboveTheFold, 50, 40);
+            ValidateResource(plan[3], "Auto.png", PrefetchPriority::AboveTheFold, 0, 0);
+            ValidateResource(plan[4], "ImageSet1.png", PrefetchPriority::AboveTheFold, 180, setHeight);
+            ValidateResource(plan[5], "ImageSet2.png", PrefetchPriority::Hidden, 180, setHeight);
+            ValidateResource(plan[6], "Column1.png", PrefetchPriority::AboveTheFold, 120, 120);
+            ValidateResource(plan[7], "Column2.png", PrefetchPriority::Hidden, 0, 0);
+            ValidateResource(plan[8], "Poster.png", PrefetchPriority::AboveTheFold, 0, 0);
+            ValidateResource(plan[9], "Media.mp4", PrefetchPriority::OnDemand, 0, 0);
+            ValidateResource(plan[10], "Icon.png", PrefetchPriority::AboveTheFold, 30, 30);
+            ValidateResource(plan[11], "ShowCard.png", PrefetchPriority::OnDemand, 0, 0);
+
+            Assert::AreEqual("video/mp4"s, plan[9].mimeType);
+            Assert::IsTrue(plan[1].owner == card->GetBody()[0]->GetInternalId());
+        }
+
+        TEST_METHOD(FoldSplitsVisibleResources)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    { "type": "Image", "url": "First.png", "height": "300px" },
+                    { "type": "Image", "url": "Hidden.png", "height": "300px", "isVisible": false },
+                    { "type": "Image", "url": "Second.png", "height": "300px", "spacing": "none" },
+                    { "type": "Image", "url": "Third.png", "height": "300px", "spacing": "none" }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            HostConfig hostConfig;
+
+            // Hidden content takes no room, so only the third image falls beyond the fold
+            auto plan = BuildPrefetchPlan(*card, hostConfig, 600);
+            Assert::AreEqual(size_t{4}, plan.size());
+            ValidateResource(plan[0], "First.png", PrefetchPriority::AboveTheFold, 0, 300);
+            ValidateResource(plan[1], "Hidden.png", PrefetchPriority::Hidden, 0, 300);
+            ValidateResource(plan[2], "Second.png", PrefetchPriority::AboveTheFold, 0, 300);
+            ValidateResource(plan[3], "Third.png", PrefetchPriority::BelowTheFold, 0, 300);
+        }
+
+        TEST_METHOD(ActionsAreSkippedWithoutInteractivity)
+        {
+            std::string testJsonString = R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [],
+                "actions": [
+                    { "type": "Action.OpenUrl", "title": "Open", "url": "https://adaptivecards.io", "iconUrl": "Icon.png" }
+                ]
+            })";
+
+            auto card = AdaptiveCard::DeserializeFromString(testJsonString, "1.2")->GetAdaptiveCard();
+            HostConfig hostConfig = HostConfig::DeserializeFromString(R"({ "supportsInteractivity": false })");
+
+            Assert::IsTrue(BuildPrefetchPlan(*card, hostConfig).empty());
+        }
+    };
+}
@@ -0,0 +1,573 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AdaptiveCardParseException.h"
+#include "AllocationCounter.h"
+#include "DateTimePreparser.h"
+#include "SemanticVersion.h"
+#include "Util.h"
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <random>
+#include <regex>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    // Checks the hand written scanners against the regular expressions they replaced
+    TEST_CLASS(RegexFreeParsingTests)
+    {
+    private:
+        struct DimensionResult
+        {
+            int value;
+            std::vector<std::string> warnings;
+        };
+
+        // ParseSizeForPixelSize as it was implemented with std::regex
+        static DimensionResult ReferenceParseSizeForPixelSize(const std::string& input)
+        {
+            DimensionResult result{0, {}};
+
+            bool shouldParse = false;
+            if (!input.empty())
+            {
+                char ch = input.at(0);
+                shouldParse = ('-' == ch || '.' == ch);
+                int hasDigit = 0;
+                for (size_t index = 0; index < input.length() && !shouldParse;)
+                {
+                    ch = input.at(index++);
+                    hasDigit |= isdigit(ch);
+                    shouldParse = hasDigit && (isalpha(ch) || '.' == ch);
+                }
+            }
+
+            if (shouldParse)
+            {
+                const std::string warningMessage =
+                    "expected input arugment to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
+                std::regex pattern("^([1-9]+\\d*)(\\.\\d+)?(px)$");
+                std::smatch matches;
+                if (std::regex_search(input, matches, pattern))
+                {
+                    try
+                    {
+                        result.value = std::stoi(matches[0]);
+                    }
+                    catch (const std::out_of_range&)
+                    {
+                        result.warnings.push_back("out of range: " + input);
+                    }
+                }
+                else
+                {
+                    result.warnings.push_back(warningMessage + input);
+                }
+            }
+            return result;
+        }
+
+        static DimensionResult ParseDimension(const std::string& input)
+        {
+            std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+            DimensionResult result{ParseSizeForPixelSize(input, &warnings), {}};
+            for (const auto& warning : warnings)
+            {
+                Assert::IsTrue(WarningStatusCode::InvalidDimensionSpecified == warning->GetStatusCode());
+                result.warnings.push_back(warning->GetReason());
+            }
+            return result;
+        }
+
+        // SemanticVersion as it was implemented with std::regex, returning an empty string for invalid versions
+        static std::string ReferenceSemanticVersion(const std::string& version)
+        {
+            static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
+            std::smatch subMatches;
+            if (!std::regex_match(version, subMatches, versionMatch))
+            {
+                return "";
+            }
+
+            std::string result;
+            try
+            {
+                for (size_t i = 1; i <= 4; ++i)
+                {
+                    result += std::to_string(subMatches[i].matched ? std::stoi(subMatches[i]) : 0) + (i < 4 ? "." : "");
+                }
+            }
+            catch (const std::out_of_range&)
+            {
+                return "";
+            }
+            return result;
+        }
+
+        static std::string ParseSemanticVersion(const std::string& version)
+        {
+            try
+            {
+                return SemanticVersion(version);
+            }
+            catch (const AdaptiveCardParseException&)
+            {
+                return "";
+            }
+        }
+
+        // Construction alone, without the conversion to string, for the benchmark
+        static unsigned int ReferenceSemanticVersionMinor(const std::string& version)
+        {
+            static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
+            std::smatch subMatches;
+            return (std::regex_match(version, subMatches, versionMatch) && subMatches[2].matched) ? std::stoi(subMatches[2]) : 0;
+        }
+
+        static unsigned int SemanticVersionMinor(const std::string& version) { return SemanticVersion(version).GetMinor(); }
+
+        static std::string ReferenceSimpleTime(const std::string& string)
+        {
+            std::smatch subMatches;
+            static const std::regex timeMatch(R"regex(^(\d{2}):(\d{2})$)regex");
+            if (std::regex_match(string, subMatches, timeMatch))
+            {
+                const unsigned int hours = std::stoul(subMatches[1]);
+                const unsigned int minutes = std::stoul(subMatches[2]);
+                if (hours <= 24 && minutes <= 60)
+                {
+                    return std::to_string(hours) + ":" + std::to_string(minutes);
+                }
+            }
+            return "";
+        }
+
+        static std::string ParseSimpleTime(const std::string& string)
+        {
+            unsigned int hours = 0;
+            unsigned int minutes = 0;
+            return DateTimePreparser::TryParseSimpleTime(string, hours, minutes) ?
+                std::to_string(hours) + ":" + std::to_string(minutes) :
+                "";
+        }
+
+        static std::string ReferenceSimpleDate(const std::string& string)
+        {
+            std::smatch subMatches;
+            static const std::regex dateMatch(R"regex(^(\d{4})-(\d{2})-(\d{2})$)regex");
+            if (std::regex_match(string, subMatches, dateMatch))
+            {
+                const unsigned int year = std::stoul(subMatches[1]);
+                const unsigned int month = std::stoul(subMatches[2]);
+                const unsigned int day = std::stoul(subMatches[3]);
+                const bool isLeapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+                const unsigned int daysInMonth =
+                    (month == 2) ? (isLeapYear ? 29 : 28) : (month == 4 || month == 6 || month == 9 || month == 11) ? 30 : 31;
+                if (month <= 12 && day <= daysInMonth)
+                {
+                    return std::to_string(year) + "-" + std::to_string(month) + "-" + std::to_string(day);
+                }
+            }
+            return "";
+        }
+
+        static std::string ParseSimpleDate(const std::string& string)
+        {
+            unsigned int year, month, day;
+            return DateTimePreparser::TryParseSimpleDate(string, year, month, day) ?
+                std::to_string(year) + "-" + std::to_string(month) + "-" + std::to_string(day) :
+                "";
+        }
+
+        static void LocalTime(time_t time, struct tm& result)
+        {
+#ifdef _WIN32
+            localtime_s(&result, &time);
+#else
+            localtime_r(&time, &result);
+#endif
+        }
+
+        // DateTimePreparser::ParseDateTime as it was implemented with std::regex, describing each token as a string.
+        // Sets skip when the result hit one of the daylight saving time errors of the old conversion.
+        static std::vector<std::string> ReferenceParseDateTime(const std::string& in, bool& skip)
+        {
+            std::vector<std::string> tokens;
+            const auto addText = [&tokens](const std::string& text) {
+                if (!text.empty())
+                {
+                    tokens.push_back(text);
+                }
+            };
+
+            static const std::regex pattern(
+                "\\{\\{((DATE)|(TIME))\\((\\d{4})-{1}(\\d{2})-{1}(\\d{2})T(\\d{2}):{1}(\\d{2}):{1}(\\d{2})(Z|(([+-])(\\d{2}):{1}(\\d{2})))((((, ?SHORT)|(, ?LONG))|(, ?COMPACT))|)\\)\\}\\}");
+            std::smatch matches;
+            std::string text = in;
+            while (std::regex_search(text, matches, pattern))
+            {
+                int formatStyle{};
+                const bool isDate = matches[2].matched;
+                if (matches[16].matched)
+                {
+                    formatStyle = matches[15].str().at(matches[15].str().at(1) == ' ' ? 2 : 1);
+                }
+
+                addText(matches.prefix().str());
+                if (!isDate && formatStyle)
+                {
+                    addText(matches[0].str());
+                    text = matches.suffix().str();
+                    continue;
+                }
+
+                struct tm parsedTm
+                {
+                };
+                int hours{}, minutes{};
+                parsedTm.tm_year = std::stoi(matches[4]);
+                parsedTm.tm_mon = std::stoi(matches[5]);
+                parsedTm.tm_mday = std::stoi(matches[6]);
+                parsedTm.tm_hour = std::stoi(matches[7]);
+                parsedTm.tm_min = std::stoi(matches[8]);
+                parsedTm.tm_sec = std::stoi(matches[9]);
+                if (matches[13].matched)
+                {
+                    hours = std::stoi(matches[13]);
+                    minutes = std::stoi(matches[14]);
+                }
+
+                const bool isLeapYear = (parsedTm.tm_year % 4 == 0 && parsedTm.tm_year % 100 != 0) || parsedTm.tm_year % 400 == 0;
+                const int month = parsedTm.tm_mon;
+                const int daysInMonth =
+                    (month == 2) ? (isLeapYear ? 29 : 28) : (month == 4 || month == 6 || month == 9 || month == 11) ? 30 : 31;
+                if (!(month <= 12 && parsedTm.tm_mday <= daysInMonth && parsedTm.tm_hour <= 24 && parsedTm.tm_min <= 60 &&
+                      parsedTm.tm_sec <= 60 && hours <= 24 && minutes <= 60))
+                {
+                    addText(matches[0].str());
+                    text = matches.suffix().str();
+                    continue;
+                }
+
+                time_t offset{};
+                if (matches[12].matched)
+                {
+                    offset = static_cast<time_t>(hours * 3600 + minutes * 60);
+                    if (matches[12].str().at(0) == '+')
+                    {
+                        offset *= -1;
+                    }
+                }
+
+                parsedTm.tm_year -= 1900;
+                parsedTm.tm_mon -= 1;
+                time_t utc = mktime(&parsedTm);
+                char tzOffsetBuff[6]{};
+                strftime(tzOffsetBuff, 6, "%z", &parsedTm);
+                const time_t nTzOffset = static_cast<time_t>(std::stoi(std::string(tzOffsetBuff)));
+                offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
+                utc += offset;
+
+                // The offset was taken from the time in the card rather than from the instant it denotes, which is an
+                // hour later when daylight saving time is in effect
+                struct tm result
+                {
+                };
+                struct tm instant
+                {
+                };
+                struct tm standardTm = parsedTm;
+                struct tm daylightTm = parsedTm;
+                standardTm.tm_isdst = 0;
+                daylightTm.tm_isdst = 1;
+                const time_t daylightShift = mktime(&standardTm) - mktime(&daylightTm);
+                const time_t instantUtc = utc - (parsedTm.tm_isdst == 1 ? daylightShift : 0);
+                LocalTime(utc, result);
+                LocalTime(instantUtc, instant);
+                if (result.tm_isdst != parsedTm.tm_isdst || instant.tm_isdst != parsedTm.tm_isdst ||
+                    (result.tm_isdst == 1 && daylightShift != 3600) ||
+                    (result.tm_isdst == 1 && result.tm_hour == 0))
+                {
+                    skip = true;
+                }
+                if (result.tm_isdst == 1)
+                {
+                    result.tm_hour -= 1;
+                }
+
+                if (isDate)
+                {
+                    const char* format = (formatStyle == 'S') ? "short" : (formatStyle == 'L') ? "long" : "compact";
+                    tokens.push_back(matches[0].str() + " " + format + " " + std::to_string(result.tm_year + 1900) + "-" +
+                                     std::to_string(result.tm_mon) + "-" + std::to_string(result.tm_mday));
+                }
+                else
+                {
+                    std::ostringstream parsedTime;
+                    parsedTime << std::put_time(&result, "%I:%M %p");
+                    tokens.push_back(parsedTime.str());
+                }
+
+                text = matches.suffix().str();
+            }
+
+            addText(text);
+            return tokens;
+        }
+
+        static std::vector<std::string> ParseDateTime(const std::string& in)
+        {
+            std::vector<std::string> tokens;
+            for (const auto& token : DateTimePreparser(in).GetTextTokens())
+            {
+                switch (token->GetFormat())
+                {
+                case DateTimePreparsedTokenFormat::RegularString:
+                    tokens.push_back(token->GetText());
+                    break;
+                default:
+                {
+                    const char* format = (token->GetFormat() == DateTimePreparsedTokenFormat::DateShort) ?
+                        "short" :
+                        (token->GetFormat() == DateTimePreparsedTokenFormat::DateLong) ? "long" : "compact";
+                    tokens.push_back(token->GetText() + " " + format + " " + std::to_string(token->GetYear()) + "-" +
+                                     std::to_string(token->GetMonth()) + "-" + std::to_string(token->GetDay()));
+                    break;
+                }
+                }
+            }
+            return tokens;
+        }
+
+        static size_t ReferenceDateTimeTokenCount(const std::string& in)
+        {
+            bool skip = false;
+            return ReferenceParseDateTime(in, skip).size();
+        }
+
+        static size_t DateTimeTokenCount(const std::string& in) { return DateTimePreparser(in).GetTextTokens().size(); }
+
+        // Every string of up to maxLength characters from the alphabet
+        static std::vector<std::string> AllStrings(const std::string& alphabet, size_t maxLength)
+        {
+            std::vector<std::string> strings{""};
+            for (size_t begin = 0, length = 0; length < maxLength; ++length)
+            {
+                const size_t end = strings.size();
+                for (size_t i = begin; i < end; ++i)
+                {
+                    for (char c : alphabet)
+                    {
+                        strings.push_back(strings[i] + c);
+                    }
+                }
+                begin = end;
+            }
+            return strings;
+        }
+
+        // Random strings of the given length from the alphabet
+        static std::vector<std::string> RandomStrings(const std::string& alphabet, size_t length, size_t count)
+        {
+            std::mt19937 generator(42);
+            std::uniform_int_distribution<size_t> distribution(0, alphabet.size() - 1);
+            std::vector<std::string> strings;
+            for (size_t i = 0; i < count; ++i)
+            {
+                std::string string;
+                for (size_t j = 0; j < length; ++j)
+                {
+                    string += alphabet[distribution(generator)];
+                }
+                strings.push_back(string);
+            }
+            return strings;
+        }
+
+        template<typename TResult>
+        static long long NanosecondsPerCall(const std::vector<std::string>& inputs, TResult (*parse)(const std::string&))
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (const auto& input : inputs)
+            {
+                parse(input);
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / static_cast<long long>(inputs.size());
+        }
+
+    public:
+        TEST_METHOD(DimensionMatchesRegex)
+        {
+            auto inputs = AllStrings("019.px- ", 5);
+            for (const auto& input : {"2147483647px"s, "2147483648px"s, "99999999999999999999.5px"s, "10.000001px"s,
+                                      "1pxpx"s, "1.px"s, "1..5px"s, "0.5px"s, "12PX"s, "\xD9\xA3px"s, "1\xD9\xA3px"s})
+            {
+                inputs.push_back(input);
+            }
+
+            for (const auto& input : inputs)
+            {
+                const auto expected = ReferenceParseSizeForPixelSize(input);
+                const auto actual = ParseDimension(input);
+                Assert::AreEqual(expected.value, actual.value, std::wstring(input.begin(), input.end()).c_str());
+                Assert::IsTrue(expected.warnings == actual.warnings, std::wstring(input.begin(), input.end()).c_str());
+            }
+        }
+
+        TEST_METHOD(SemanticVersionMatchesRegex)
+        {
+            auto inputs = AllStrings("019.a", 7);
+            for (const auto& input : {"2147483647"s, "2147483648"s, "1.2147483648"s, "00000000000000000000001.2"s,
+                                      "1.2.3.4"s, "1.2.3.4.5"s, " 1"s, "1 "s, "+1"s})
+            {
+                inputs.push_back(input);
+            }
+
+            for (const auto& input : inputs)
+            {
+                Assert::AreEqual(ReferenceSemanticVersion(input), ParseSemanticVersion(input));
+            }
+        }
+
+        TEST_METHOD(SimpleDateAndTimeMatchRegex)
+        {
+            auto times = RandomStrings("01239:-", 5, 20000);
+            auto dates = RandomStrings("012349-", 10, 20000);
+            for (const auto& input : AllStrings("09:", 5))
+            {
+                times.push_back(input);
+            }
+            times.push_back("23:59");
+            times.push_back("24:60");
+            dates.push_back("2019-12-31");
+            dates.push_back("2019-13-01");
+            dates.push_back("2019-02-29");
+
+            for (const auto& input : times)
+            {
+                Assert::AreEqual(ReferenceSimpleTime(input), ParseSimpleTime(input));
+            }
+            for (const auto& input : dates)
+            {
+                Assert::AreEqual(ReferenceSimpleDate(input), ParseSimpleDate(input));
+            }
+        }
+
+        TEST_METHOD(DateTimeTokensMatchRegex)
+        {
+            const std::vector<std::string> pieces = {"{{DATE(", "{{TIME(", "{{", "{", "DATE(", ")}}", "}}", ")",
+                                                     "2019-06-15T23:30:00", "2017-02-28T08:00:00", "2016-02-29T12:45:10",
+                                                     "1999-12-31T00:05:59", "2019-03-10T10:00:00", "2019-11-03T09:30:00",
+                                                     "2017-02-29T08:00:00", "2019-13-01T00:00:00", "2019-04-31T24:60:60",
+                                                     "2019-01-01T1:00:00", "Z", "+05:30", "-08:00", "+25:00", "-00:61",
+                                                     ", SHORT", ",LONG", ", COMPACT", ",  SHORT", ", short", "text ", " "};
+
+            std::vector<std::string> inputs = {"", "no tokens", "{{DATE(2019-06-15T23:30:00Z)}}",
+                                               "Due {{DATE(2017-02-14T06:08:00Z, SHORT)}} at {{TIME(2017-02-14T06:08:00-07:00)}}",
+                                               "{{{DATE(2019-06-15T11:30:00+01:00,LONG)}}}", "{{TIME(2019-06-15T11:30:00Z, SHORT)}}"};
+            std::mt19937 generator(42);
+            std::uniform_int_distribution<size_t> pieceDistribution(0, pieces.size() - 1);
+            std::uniform_int_distribution<size_t> countDistribution(1, 12);
+            for (int i = 0; i < 20000; ++i)
+            {
+                std::string input;
+                for (size_t count = countDistribution(generator); count > 0; --count)
+                {
+                    input += pieces[pieceDistribution(generator)];
+                }
+                inputs.push_back(input);
+            }
+            for (const auto& date : {"2019-06-15T23:30:00", "2016-02-29T12:45:10", "1999-12-31T00:05:59", "2019-03-10T10:00:00"})
+            {
+                for (const auto& zone : {"Z", "+05:30", "-08:00"})
+                {
+                    inputs.push_back("{{DATE("s + date + zone + ")}}");
+                    inputs.push_back("{{TIME("s + date + zone + ")}}");
+                }
+            }
+
+            unsigned int compared = 0;
+            for (const auto& input : inputs)
+            {
+                bool skip = false;
+                const auto expected = ReferenceParseDateTime(input, skip);
+                if (!skip)
+                {
+                    Assert::IsTrue(expected == ParseDateTime(input), std::wstring(input.begin(), input.end()).c_str());
+                    ++compared;
+                }
+            }
+            Assert::IsTrue(compared > inputs.size() / 2);
+        }
+
+        TEST_METHOD(DateTimeTokensAreSpansOfTheText)
+        {
+            std::string text;
+            for (int i = 0; i < 100; ++i)
+            {
+                text += "Due {{DATE(2019-06-15T23:30:00Z, SHORT)}} at {{TIME(2019-06-15T23:30:00-07:00)}}. ";
+            }
+
+            // Parsing copies the text and records where its tokens are, without a string for each token
+            AllocationCounter counter;
+            DateTimePreparser preparser(text);
+            Assert::IsTrue(counter.GetAllocations() < 20);
+            Assert::IsTrue(preparser.HasDateTokens());
+
+            const auto tokens = preparser.GetTextTokens();
+            Assert::AreEqual(401U, static_cast<unsigned int>(tokens.size()));
+            Assert::AreEqual("Due "s, tokens[0]->GetText());
+            Assert::AreEqual("{{DATE(2019-06-15T23:30:00Z, SHORT)}}"s, tokens[1]->GetText());
+            Assert::IsTrue(DateTimePreparsedTokenFormat::DateShort == tokens[1]->GetFormat());
+            Assert::AreEqual(". Due "s, tokens[4]->GetText());
+            Assert::AreEqual(". "s, tokens[400]->GetText());
+        }
+
+        TEST_METHOD(DateTimeTokenBenchmark)
+        {
+            // Linear in the number of tokens, where the regex parse was quadratic
+            for (int tokenCount : {100, 1000})
+            {
+                std::string text;
+                for (int i = 0; i < tokenCount; ++i)
+                {
+                    text += "Due {{DATE(2019-06-15T23:30:00Z, SHORT)}} at {{TIME(2019-06-15T23:30:00-07:00)}}. ";
+                }
+                const std::vector<std::string> inputs(5, text);
+
+                Logger::WriteMessage(("DateTimePreparser with "s + std::to_string(2 * tokenCount) + " tokens: regex " +
+                                      std::to_string(NanosecondsPerCall(inputs, ReferenceDateTimeTokenCount) / 1000) + "us, scanner " +
+                                      std::to_string(NanosecondsPerCall(inputs, DateTimeTokenCount) / 1000) + "us")
+                                         .c_str());
+            }
+        }
+
+        TEST_METHOD(ScannerBenchmark)
+        {
+            std::vector<std::string> dimensions;
+            std::vector<std::string> versions;
+            for (int i = 0; i < 2000; ++i)
+            {
+                dimensions.push_back(std::to_string(i + 1) + (i % 2 ? ".5px" : "px"));
+                versions.push_back("1." + std::to_string(i % 10));
+            }
+            const auto times = RandomStrings("0123:", 5, 2000);
+
+            Logger::WriteMessage(("Dimension: regex "s + std::to_string(NanosecondsPerCall(dimensions, ReferenceParseSizeForPixelSize)) +
+                                  "ns, scanner " + std::to_string(NanosecondsPerCall(dimensions, ParseDimension)) + "ns")
+                                     .c_str());
+            Logger::WriteMessage(("SemanticVersion: regex "s + std::to_string(NanosecondsPerCall(versions, ReferenceSemanticVersionMinor)) +
+                                  "ns, scanner " + std::to_string(NanosecondsPerCall(versions, SemanticVersionMinor)) + "ns")
+                                     .c_str());
+            Logger::WriteMessage(("Simple time: regex "s + std::to_string(NanosecondsPerCall(times, ReferenceSimpleTime)) +
+                                  "ns, scanner " + std::to_string(NanosecondsPerCall(times, ParseSimpleTime)) + "ns")
+                                     .c_str());
+        }
+    };
+}
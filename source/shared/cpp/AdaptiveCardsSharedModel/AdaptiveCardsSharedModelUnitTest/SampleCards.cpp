@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "SampleCards.h"
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    void ForEachSample(bool hostConfigs, const AdaptiveCardsSharedModelUnitTest::SampleVisitor& visit)
+    {
+        const auto samples = std::filesystem::path(__FILE__).parent_path() / "../../../../../samples";
+        for (const auto& file : std::filesystem::recursive_directory_iterator(samples))
+        {
+            const auto path = file.path().lexically_relative(samples).generic_string();
+            if (file.path().extension() != ".json" || path.find("Templates") != std::string::npos ||
+                (path.find("HostConfig") != std::string::npos) != hostConfigs)
+            {
+                continue;
+            }
+
+            std::ifstream stream(file.path());
+            visit(path, std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>()));
+        }
+    }
+}
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    void ForEachSampleCard(const SampleVisitor& visit)
+    {
+        ForEachSample(false, visit);
+    }
+
+    std::vector<std::string> LoadSampleCards()
+    {
+        std::vector<std::string> cards;
+        ForEachSampleCard([&cards](const std::string&, const std::string& json) { cards.push_back(json); });
+        return cards;
+    }
+
+    void ForEachSampleHostConfig(const SampleVisitor& visit)
+    {
+        ForEachSample(true, visit);
+    }
+}
@@ -0,0 +1,22 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    using SampleVisitor = std::function<void(const std::string& path, const std::string& json)>;
+
+    // Calls visit with the path of each sample card relative to samples/, such as "v1.0/Scenarios/ActivityUpdate.json",
+    // and its json. Host configs and templates are skipped. Not every sample is a card of every version.
+    void ForEachSampleCard(const SampleVisitor& visit);
+
+    // The json of each sample card
+    std::vector<std::string> LoadSampleCards();
+
+    // Calls visit with the path of each sample host config relative to samples/, and its json
+    void ForEachSampleHostConfig(const SampleVisitor& visit);
+}
@@ -0,0 +1,200 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AllocationCounter.h"
+#include "Container.h"
+#include "ParseUtil.h"
+#include "RichTextBlock.h"
+#include "SchemaProperties.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+#include <filesystem>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(SchemaPropertiesTests)
+    {
+    private:
+        static bool IsSchemaProperty(SchemaPropertySet properties, const std::string& name)
+        {
+            return AdaptiveCards::IsSchemaProperty(properties, name.data(), name.data() + name.size());
+        }
+
+        static Json::Value LoadJson(const std::filesystem::path& path)
+        {
+            std::ifstream stream(path);
+            return ParseUtil::GetJsonValueFromString(std::string((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>()));
+        }
+
+        // The schema properties of the object model type a schema type parses to, or nothing if it has none
+        static bool TryGetSchemaProperties(const std::string& typeName, SchemaPropertySet& properties)
+        {
+            if (typeName == "TextRun")
+            {
+                properties = GetSchemaProperties(InlineElementType::TextRun);
+                return true;
+            }
+
+            const auto elementType = CardElementTypeFromString(typeName);
+            if (elementType != CardElementType::Unknown && elementType != CardElementType::Custom)
+            {
+                properties = GetSchemaProperties(elementType);
+                return true;
+            }
+
+            const auto actionType = ActionTypeFromString(typeName);
+            if (actionType != ActionType::Unsupported && actionType != ActionType::Custom)
+            {
+                properties = GetSchemaProperties(actionType);
+                return true;
+            }
+            return false;
+        }
+
+    public:
+        TEST_METHOD(SchemaPropertiesMatchNamesExactly)
+        {
+            const auto textBlock = GetSchemaProperties(CardElementType::TextBlock);
+            Assert::IsTrue(IsSchemaProperty(textBlock, "text"));
+            Assert::IsTrue(IsSchemaProperty(textBlock, "wrap"));
+            Assert::IsTrue(IsSchemaProperty(textBlock, "type"));
+            // inherited from Element
+            Assert::IsTrue(IsSchemaProperty(textBlock, "spacing"));
+            Assert::IsTrue(IsSchemaProperty(textBlock, "fallback"));
+
+            Assert::IsFalse(IsSchemaProperty(textBlock, "tex"));
+            Assert::IsFalse(IsSchemaProperty(textBlock, "texts"));
+            Assert::IsFalse(IsSchemaProperty(textBlock, "Text"));
+            Assert::IsFalse(IsSchemaProperty(textBlock, ""));
+            Assert::IsFalse(IsSchemaProperty(textBlock, "text\0"s));
+            // a property of other types
+            Assert::IsFalse(IsSchemaProperty(textBlock, "items"));
+            Assert::IsFalse(IsSchemaProperty(textBlock, "italic"));
+
+            // custom types get the properties every element or action has
+            Assert::IsTrue(IsSchemaProperty(GetSchemaProperties(CardElementType::Custom), "isVisible"));
+            Assert::IsFalse(IsSchemaProperty(GetSchemaProperties(CardElementType::Custom), "text"));
+            Assert::IsTrue(IsSchemaProperty(GetSchemaProperties(ActionType::Custom), "title"));
+            Assert::IsFalse(IsSchemaProperty(GetSchemaProperties(ActionType::Custom), "url"));
+        }
+
+        TEST_METHOD(SchemaPropertiesAreUpToDate)
+        {
+            // The properties each type of the schema describes itself. The generator adds the ones it inherits, and
+            // leaves out the ones the object model keeps as additional properties.
+            const auto schemas = std::filesystem::path(__FILE__).parent_path() / "../../../../../schemas/src";
+            const auto propertyLists = LoadJson(std::filesystem::path(__FILE__).parent_path() /
+                                                "../AdaptiveCardsSharedModelCodeGen/UnpublishedProperties.json");
+            const auto& additional = propertyLists["additionalProperties"];
+            unsigned int typesChecked = 0;
+            for (const auto& file : std::filesystem::recursive_directory_iterator(schemas))
+            {
+                SchemaPropertySet properties;
+                if (file.path().extension() != ".json" || !TryGetSchemaProperties(file.path().stem().string(), properties))
+                {
+                    continue;
+                }
+
+                const auto typeName = file.path().stem().string();
+                for (const auto& name : LoadJson(file.path())["properties"].getMemberNames())
+                {
+                    bool isKept = false;
+                    for (const auto& keptName : additional[typeName])
+                    {
+                        isKept = isKept || keptName.asString() == name;
+                    }
+
+                    if (isKept)
+                    {
+                        Assert::IsFalse(IsSchemaProperty(properties, name));
+                        continue;
+                    }
+
+                    if (!IsSchemaProperty(properties, name))
+                    {
+                        Logger::WriteMessage((typeName + " is missing " + name + "\n").c_str());
+                    }
+                    Assert::IsTrue(IsSchemaProperty(properties, name));
+                }
+                ++typesChecked;
+            }
+            Assert::IsTrue(typesChecked >= 20);
+
+            const auto& unpublished = propertyLists["properties"];
+            for (const auto& typeName : unpublished.getMemberNames())
+            {
+                SchemaPropertySet properties;
+                if (TryGetSchemaProperties(typeName, properties))
+                {
+                    for (const auto& name : unpublished[typeName])
+                    {
+                        Assert::IsTrue(IsSchemaProperty(properties, name.asString()));
+                    }
+                }
+            }
+        }
+
+        TEST_METHOD(SchemaPropertiesAreNotAdditionalProperties)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(R"({
+                "type": "AdaptiveCard",
+                "version": "1.2",
+                "body": [
+                    {
+                        "type": "Container",
+                        "backgroundImage": "https://adaptivecards.io/content/bg.png",
+                        "bleed": true,
+                        "minHeight": "50px",
+                        "myProperty": "mine",
+                        "items": [
+                            {
+                                "type": "RichTextBlock",
+                                "inlines": [{"type": "TextRun", "text": "a", "highlight": true, "myRunProperty": 1}]
+                            }
+                        ]
+                    }
+                ]
+            })", "1.2")->GetAdaptiveCard();
+
+            const auto container = std::static_pointer_cast<Container>(card->GetBody().front());
+            Assert::AreEqual("{\"myProperty\":\"mine\"}\n"s, ParseUtil::JsonToString(container->GetAdditionalProperties()));
+
+            const auto richTextBlock = std::static_pointer_cast<RichTextBlock>(container->GetItems().front());
+            Assert::AreEqual("{\"myRunProperty\":1}\n"s, ParseUtil::JsonToString(richTextBlock->GetInlines().front()->GetAdditionalProperties()));
+        }
+
+        TEST_METHOD(ParsingAsksCustomElementsForTheirProperties)
+        {
+            class RatingElement : public BaseCardElement
+            {
+            public:
+                RatingElement() : BaseCardElement(CardElementType::Custom) {}
+
+            protected:
+                void PopulateKnownPropertiesSet() override { m_knownProperties.insert("rating"); }
+            };
+
+            ParseContext context{};
+            const auto rating = BaseCardElement::Deserialize<RatingElement>(
+                context, ParseUtil::GetJsonValueFromString(R"({"type": "Rating", "id": "a", "rating": 4, "myProperty": 1})"));
+
+            Assert::AreEqual("{\"myProperty\":1}\n"s, ParseUtil::JsonToString(rating->GetAdditionalProperties()));
+        }
+
+        TEST_METHOD(ElementsDontAllocateKnownProperties)
+        {
+            // The first element of a type sets up what every element of the type shares
+            TextBlock first;
+
+            AllocationCounter counter;
+            TextBlock textBlock;
+            // The requirements, and nothing for the properties the element knows
+            Assert::IsTrue(counter.GetAllocations() <= 2);
+        }
+    };
+}
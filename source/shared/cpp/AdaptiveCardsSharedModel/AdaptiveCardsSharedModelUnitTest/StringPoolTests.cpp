@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AllocationCounter.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "SampleCards.h"
+#include "SharedAdaptiveCard.h"
+#include "StringPool.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(StringPoolTests)
+    {
+    private:
+        // Parses a conversation of the given number of cards out of the sample cards, and returns the bytes the
+        // parsed cards hold
+        static long long ParseConversation(const std::vector<std::string>& samples, size_t length, const std::shared_ptr<StringPool>& pool)
+        {
+            std::vector<std::shared_ptr<AdaptiveCard>> conversation;
+            conversation.reserve(length);
+            AllocationCounter counter;
+            for (size_t i = 0; conversation.size() < length; ++i)
+            {
+                try
+                {
+                    ParseContext context;
+                    context.SetStringPool(pool);
+                    conversation.push_back(
+                        AdaptiveCard::DeserializeFromString(samples[i % samples.size()], "1.2", context)->GetAdaptiveCard());
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // not all samples are cards of this version
+                }
+            }
+            return counter.GetLiveBytes();
+        }
+
+    public:
+        TEST_METHOD(InternSharesStorage)
+        {
+            StringPool pool(true);
+            const auto first = pool.Intern("https://adaptivecards.io/content/cats/1.png");
+            const auto second = pool.Intern("https://adaptivecards.io/content/cats/1.png");
+            Assert::IsTrue(first.SharesStorageWith(second));
+            Assert::IsTrue(&first.Get() == &second.Get());
+            Assert::IsFalse(first.SharesStorageWith(pool.Intern("https://adaptivecards.io/content/cats/2.png")));
+
+            // empty strings have no storage, pooled or not
+            Assert::IsTrue(pool.Intern("").empty());
+            Assert::IsTrue(InternedString("").empty());
+            Assert::AreEqual(""s, InternedString().Get());
+
+            auto stats = pool.GetStatistics();
+            Assert::AreEqual(1ULL, stats.hits);
+            Assert::AreEqual(2ULL, stats.misses);
+            Assert::AreEqual(2U, static_cast<unsigned int>(stats.entries));
+
+            // trimming drops only the strings nothing refers to, and interned strings outlive their pool
+            pool.Trim();
+            Assert::AreEqual(1U, static_cast<unsigned int>(pool.GetStatistics().entries));
+            pool.Clear();
+            Assert::AreEqual("https://adaptivecards.io/content/cats/1.png"s, first.Get());
+        }
+
+        TEST_METHOD(DisabledPool)
+        {
+            StringPool pool(false);
+            const auto first = pool.Intern("en-US");
+            Assert::AreEqual("en-US"s, first.Get());
+            Assert::IsFalse(first.SharesStorageWith(pool.Intern("en-US")));
+            Assert::AreEqual(0U, static_cast<unsigned int>(pool.GetStatistics().entries));
+
+            // the default pool is disabled until the host enables it
+            Assert::IsFalse(StringPool::GetDefault().IsEnabled());
+        }
+
+        TEST_METHOD(ParsedCardsShareStrings)
+        {
+            const std::string json = R"({
+                "type": "AdaptiveCard",
+                "version": "1.0",
+                "lang": "en-US",
+                "body": [
+                    { "type": "TextBlock", "text": "Hello" },
+                    { "type": "Image", "url": "https://adaptivecards.io/content/cats/1.png", "backgroundColor": "#FF00FF00" },
+                    { "type": "FactSet", "facts": [ { "title": "Title", "value": "Value" } ] }
+                ],
+                "actions": [
+                    { "type": "Action.OpenUrl", "url": "https://adaptivecards.io", "iconUrl": "https://adaptivecards.io/content/cats/1.png" }
+                ]
+            })";
+
+            auto pool = std::make_shared<StringPool>(true);
+            std::vector<std::shared_ptr<AdaptiveCard>> cards;
+            for (int i = 0; i < 2; ++i)
+            {
+                ParseContext context;
+                context.SetStringPool(pool);
+                cards.push_back(AdaptiveCard::DeserializeFromString(json, "1.0", context)->GetAdaptiveCard());
+            }
+
+            const auto& first = cards[0];
+            const auto& second = cards[1];
+            Assert::IsTrue(&first->GetLanguage() == &second->GetLanguage());
+            Assert::IsTrue(&first->GetLanguage() == &std::static_pointer_cast<TextBlock>(second->GetBody()[0])->GetLanguage());
+            Assert::IsTrue(&first->GetLanguage() ==
+                           &std::static_pointer_cast<FactSet>(second->GetBody()[2])->GetFacts()[0]->GetLanguage());
+            Assert::IsTrue(&first->GetBody()[0]->GetElementTypeString() == &second->GetBody()[0]->GetElementTypeString());
+            Assert::IsTrue(&std::static_pointer_cast<Image>(first->GetBody()[1])->GetBackgroundColor() ==
+                           &std::static_pointer_cast<Image>(second->GetBody()[1])->GetBackgroundColor());
+            Assert::AreEqual("https://adaptivecards.io/content/cats/1.png"s, second->GetActions()[0]->GetIconUrl());
+
+            // the language, the color and the icon url
+            const auto stats = pool->GetStatistics();
+            Assert::AreEqual(3U, static_cast<unsigned int>(stats.entries));
+
+            // without a pool, known type names and the card's language are still shared within a card
+            ParseContext context;
+            const auto unpooled = AdaptiveCard::DeserializeFromString(json, "1.0", context)->GetAdaptiveCard();
+            Assert::IsTrue(&first->GetBody()[0]->GetElementTypeString() == &unpooled->GetBody()[0]->GetElementTypeString());
+            Assert::IsTrue(&unpooled->GetLanguage() == &std::static_pointer_cast<TextBlock>(unpooled->GetBody()[0])->GetLanguage());
+            Assert::IsFalse(&first->GetLanguage() == &unpooled->GetLanguage());
+            Assert::IsTrue(&first->GetActions()[0]->GetElementTypeString() == &unpooled->GetActions()[0]->GetElementTypeString());
+
+            // so are the names hosts give their custom types
+            TextBlock custom;
+            custom.SetElementTypeString("MyElement"s);
+            TextBlock otherCustom;
+            otherCustom.SetElementTypeString("MyElement"s);
+            Assert::IsTrue(&custom.GetElementTypeString() == &otherCustom.GetElementTypeString());
+        }
+
+        TEST_METHOD(ConversationMemoryBenchmark)
+        {
+            const auto samples = LoadSampleCards();
+            Assert::IsFalse(samples.empty());
+            const size_t length = 10000;
+
+            const auto unpooledBytes = ParseConversation(samples, length, nullptr);
+            auto pool = std::make_shared<StringPool>(true);
+            const auto pooledBytes = ParseConversation(samples, length, pool);
+            Assert::IsTrue(pooledBytes < unpooledBytes);
+
+            const auto stats = pool->GetStatistics();
+            Logger::WriteMessage(("Parsed a conversation of "s + std::to_string(length) + " sample cards: " +
+                                  std::to_string(unpooledBytes) + " bytes without a string pool, " +
+                                  std::to_string(pooledBytes) + " bytes with one (" + std::to_string(stats.entries) +
+                                  " pooled strings, hit rate " +
+                                  std::to_string(static_cast<double>(stats.hits) / (stats.hits + stats.misses)) + ")")
+                                     .c_str());
+        }
+    };
+}
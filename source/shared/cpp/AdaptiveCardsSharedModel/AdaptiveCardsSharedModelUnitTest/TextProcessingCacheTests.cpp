@@ -0,0 +1,231 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "Fact.h"
+#include "MarkDownParser.h"
+#include "ParseUtil.h"
+#include "SampleCards.h"
+#include "TextBlock.h"
+#include "TextProcessingCache.h"
+#include <chrono>
+#include <thread>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(TextProcessingCacheTests)
+    {
+    private:
+        struct SampleText
+        {
+            std::string text;
+            std::string language;
+        };
+
+        static void CollectTexts(const Json::Value& json, const std::string& language, std::vector<SampleText>& texts)
+        {
+            if (json.isObject())
+            {
+                for (const auto& name : json.getMemberNames())
+                {
+                    const auto& member = json[name];
+                    if (member.isString() && (name == "text" || name == "title" || name == "value"))
+                    {
+                        texts.push_back({member.asString(), language});
+                    }
+                    else
+                    {
+                        CollectTexts(member, language, texts);
+                    }
+                }
+            }
+            else if (json.isArray())
+            {
+                for (const auto& item : json)
+                {
+                    CollectTexts(item, language, texts);
+                }
+            }
+        }
+
+        // Texts of TextBlocks, TextRuns and Facts of the cards in samples/
+        static std::vector<SampleText> LoadSampleTexts()
+        {
+            std::vector<SampleText> texts;
+            ForEachSampleCard([&texts](const std::string&, const std::string& json) {
+                try
+                {
+                    const auto root = ParseUtil::GetJsonValueFromString(json);
+                    CollectTexts(root, root.isObject() ? root.get("lang", "").asString() : "", texts);
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                    // not all samples are valid json
+                }
+            });
+            return texts;
+        }
+
+    public:
+        TEST_METHOD(HitsAndEviction)
+        {
+            TextProcessingCache cache(2);
+            auto first = cache.GetMarkDown("**bold**", "en");
+            Assert::AreEqual("<p><strong>bold</strong></p>"s, first->GetHtml());
+            Assert::IsTrue(first->HasHtmlTags());
+            Assert::IsTrue(first == cache.GetMarkDown("**bold**", "en"));
+
+            // language and outputs are part of the key
+            Assert::IsTrue(first != cache.GetMarkDown("**bold**", "fr"));
+            auto runs = cache.GetMarkDown("**bold**", "en", ProcessedMarkDown::InlineRuns);
+            Assert::IsTrue(runs->GetHtml().empty());
+            Assert::AreEqual(1U, static_cast<unsigned int>(runs->GetInlineRuns().size()));
+            Assert::IsTrue(runs->GetInlineRuns()[0].IsBold());
+
+            // the least recently used result was dropped
+            auto stats = cache.GetMarkDownStatistics();
+            Assert::AreEqual(1ULL, stats.hits);
+            Assert::AreEqual(3ULL, stats.misses);
+            Assert::AreEqual(2U, static_cast<unsigned int>(stats.entries));
+            Assert::IsTrue(first != cache.GetMarkDown("**bold**", "en"));
+
+            cache.ResetStatistics();
+            auto date = cache.GetDateTimePreparser("{{DATE(2017-02-14T06:08:39Z, SHORT)}}");
+            Assert::IsTrue(date->HasDateTokens());
+            Assert::IsTrue(date == cache.GetDateTimePreparser("{{DATE(2017-02-14T06:08:39Z, SHORT)}}"));
+            Assert::AreEqual(1ULL, cache.GetDateTimeStatistics().hits);
+            Assert::AreEqual(0ULL, cache.GetMarkDownStatistics().hits);
+
+            cache.SetCapacity(1);
+            Assert::AreEqual(1U, static_cast<unsigned int>(cache.GetMarkDownStatistics().entries));
+            cache.Clear();
+            Assert::AreEqual(0U, static_cast<unsigned int>(cache.GetDateTimeStatistics().entries));
+        }
+
+        TEST_METHOD(DisabledCache)
+        {
+            TextProcessingCache cache(0);
+            auto first = cache.GetMarkDown("_text_", "");
+            Assert::AreEqual("<p><em>text</em></p>"s, first->GetHtml());
+            Assert::IsTrue(first != cache.GetMarkDown("_text_", ""));
+            Assert::AreEqual(0ULL, cache.GetMarkDownStatistics().misses);
+
+            // the default cache is disabled until the host enables it
+            Assert::AreEqual(0U, static_cast<unsigned int>(TextProcessingCache::GetDefault().GetCapacity()));
+        }
+
+        TEST_METHOD(SharedByElements)
+        {
+            auto& defaultCache = TextProcessingCache::GetDefault();
+            defaultCache.SetCapacity(16);
+
+            TextBlock textBlock;
+            textBlock.SetText("Due {{DATE(2017-02-14T06:08:39Z, LONG)}}");
+            Fact fact("Due", "Due {{DATE(2017-02-14T06:08:39Z, LONG)}}");
+            Assert::IsTrue(&textBlock.GetTextForDateParsing() == &fact.GetValueForDateParsing());
+
+            defaultCache.SetCapacity(0);
+            defaultCache.Clear();
+            defaultCache.ResetStatistics();
+        }
+
+        TEST_METHOD(ConcurrentLookups)
+        {
+            TextProcessingCache cache(8);
+            std::vector<std::thread> threads;
+            for (int thread = 0; thread < 4; ++thread)
+            {
+                threads.emplace_back([&cache, thread]() {
+                    for (int i = 0; i < 1000; ++i)
+                    {
+                        const auto text = "**message " + std::to_string((i + thread) % 16) + "**";
+                        cache.GetMarkDown(text, "en");
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            const auto stats = cache.GetMarkDownStatistics();
+            Assert::AreEqual(4000ULL, stats.hits + stats.misses);
+            Assert::IsTrue(stats.entries <= 8);
+        }
+
+        TEST_METHOD(ConcurrentDateParsing)
+        {
+            // Elements preparse their text the first time it's read, which may happen on several threads at once
+            Fact fact("Due", "Due {{DATE(2017-02-14T06:08:39Z, LONG)}}");
+            std::vector<const DateTimePreparser*> preparsed(4);
+            std::vector<std::thread> threads;
+            for (size_t thread = 0; thread < preparsed.size(); ++thread)
+            {
+                threads.emplace_back([&fact, &preparsed, thread]() { preparsed[thread] = &fact.GetValueForDateParsing(); });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            for (const auto result : preparsed)
+            {
+                Assert::IsTrue(result == preparsed.front());
+            }
+            Assert::IsTrue(preparsed.front()->HasDateTokens());
+        }
+
+        TEST_METHOD(SamplesReplayBenchmark)
+        {
+            const auto texts = LoadSampleTexts();
+            Assert::IsFalse(texts.empty());
+            const int replays = 100;
+
+            size_t uncachedLength = 0;
+            const auto uncachedStart = std::chrono::steady_clock::now();
+            for (int replay = 0; replay < replays; ++replay)
+            {
+                for (const auto& sample : texts)
+                {
+                    MarkDownParser parser(sample.text);
+                    uncachedLength += parser.TransformToHtml().size();
+                    uncachedLength += DateTimePreparser(sample.text).GetTextTokens().size();
+                }
+            }
+            const auto uncachedElapsed = std::chrono::steady_clock::now() - uncachedStart;
+
+            TextProcessingCache cache(texts.size());
+            size_t cachedLength = 0;
+            const auto cachedStart = std::chrono::steady_clock::now();
+            for (int replay = 0; replay < replays; ++replay)
+            {
+                for (const auto& sample : texts)
+                {
+                    cachedLength += cache.GetMarkDown(sample.text, sample.language)->GetHtml().size();
+                    cachedLength += cache.GetDateTimePreparser(sample.text)->GetTextTokens().size();
+                }
+            }
+            const auto cachedElapsed = std::chrono::steady_clock::now() - cachedStart;
+            Assert::AreEqual(uncachedLength, cachedLength);
+
+            // only the first replay misses, and repeated texts hit even then
+            const auto markDownStats = cache.GetMarkDownStatistics();
+            const auto dateTimeStats = cache.GetDateTimeStatistics();
+            Assert::IsTrue(markDownStats.GetHitRate() >= 0.99);
+            Assert::IsTrue(dateTimeStats.GetHitRate() >= 0.99);
+
+            const auto toMicroseconds = [](auto elapsed) {
+                return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+            };
+            Logger::WriteMessage(("Replayed "s + std::to_string(texts.size()) + " sample texts " + std::to_string(replays) +
+                                  " times: uncached " + toMicroseconds(uncachedElapsed) + "us, cached " +
+                                  toMicroseconds(cachedElapsed) + "us, markdown hit rate " +
+                                  std::to_string(markDownStats.GetHitRate()) + ", date/time hit rate " +
+                                  std::to_string(dateTimeStats.GetHitRate()))
+                                     .c_str());
+        }
+    };
+}
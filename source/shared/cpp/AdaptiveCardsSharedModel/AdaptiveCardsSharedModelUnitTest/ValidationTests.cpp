@@ -0,0 +1,218 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "stdafx.h"
+#include "AllocationCounter.h"
+#include "SampleCards.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ValidationTests)
+    {
+    private:
+        static std::string DescribeWarnings(const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+        {
+            std::string description;
+            for (const auto& warning : warnings)
+            {
+                description += "warning " + std::to_string(static_cast<int>(warning->GetStatusCode())) + ": " + warning->GetReason() + "\n";
+            }
+            return description;
+        }
+
+        // What parsing the card yields, as text: its warnings, or the error it throws
+        template<typename TParse> static std::string DescribeOutcome(TParse&& parse)
+        {
+            try
+            {
+                return DescribeWarnings(parse());
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                return "error " + std::to_string(static_cast<int>(e.GetStatusCode())) + ": " + e.GetReason();
+            }
+            catch (const std::exception& e)
+            {
+                return "exception: "s + e.what();
+            }
+        }
+
+        static std::string DescribeDeserialize(const std::string& json, const std::string& rendererVersion)
+        {
+            return DescribeOutcome([&]() { return AdaptiveCard::DeserializeFromString(json, rendererVersion)->GetWarnings(); });
+        }
+
+        static std::string DescribeValidate(const std::string& json, const std::string& rendererVersion)
+        {
+            return DescribeOutcome([&]() { return AdaptiveCard::ValidateFromString(json, rendererVersion); });
+        }
+
+        static void AssertValidatesLikeItParses(const std::string& json, const std::string& rendererVersion = "1.3")
+        {
+            const auto expected = DescribeDeserialize(json, rendererVersion);
+            const auto actual = DescribeValidate(json, rendererVersion);
+            if (expected != actual)
+            {
+                Logger::WriteMessage(("Deserialize: " + expected + "\nValidate: " + actual + "\nfor " + json + "\n").c_str());
+            }
+            Assert::AreEqual(expected, actual);
+        }
+
+        static std::string CardWithBody(const std::string& body)
+        {
+            return R"({"type": "AdaptiveCard", "version": "1.2", "body": [)" + body + "]}";
+        }
+
+    public:
+        TEST_METHOD(SamplesValidateLikeTheyParse)
+        {
+            ForEachSampleCard([](const std::string& path, const std::string& json) {
+                Logger::WriteMessage(("Validating " + path + "\n").c_str());
+                AssertValidatesLikeItParses(json);
+                AssertValidatesLikeItParses(json, "");
+                // most samples need a later version than this one, and fall back to their fallback text
+                AssertValidatesLikeItParses(json, "1.0");
+            });
+        }
+
+        TEST_METHOD(InvalidCardsThrowLikeTheyParse)
+        {
+            const std::vector<std::string> cards{
+                R"([])",
+                R"({"type": "Card", "version": "1.0"})",
+                R"({"type": "AdaptiveCard"})",
+                R"({"type": "AdaptiveCard", "version": "one"})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "speak": 1})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": {}})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "backgroundImage": {"fillMode": "repeat"}})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "backgroundImage": 5})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "selectAction": 5})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "actions": [5]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "style": ["emphasis"]})",
+                CardWithBody(R"(5)"),
+                CardWithBody(R"({"text": "no type"})"),
+                CardWithBody(R"({"type": ["TextBlock"]})"),
+                CardWithBody(R"({"type": "TextBlock"})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "wrap": "yes"})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "maxLines": -1})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "size": 1})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "id": 1})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "fallback": "skip"})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "fallback": 5})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "fallback": {"type": "TextBlock"}})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "requires": []})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "requires": {"feature": 1}})"),
+                CardWithBody(R"({"type": "TextBlock", "text": "a", "requires": {"feature": "one"}})"),
+                CardWithBody(R"({"type": "RichTextBlock", "inlines": [5]})"),
+                CardWithBody(R"({"type": "RichTextBlock", "inlines": [{"type": "TextRun", "text": "a", "italic": 1}]})"),
+                CardWithBody(R"({"type": "Image"})"),
+                CardWithBody(R"({"type": "Image", "url": "a", "width": []})"),
+                CardWithBody(R"({"type": "ImageSet", "images": [{"type": "TextBlock", "text": "a"}]})"),
+                CardWithBody(R"({"type": "ImageSet", "images": [{"alt": "no url"}]})"),
+                CardWithBody(R"({"type": "ImageSet", "images": [null]})"),
+                CardWithBody(R"({"type": "ImageSet"})"),
+                CardWithBody(R"({"type": "Container", "items": [{"type": "TextBlock"}]})"),
+                CardWithBody(R"({"type": "Container", "bleed": 1})"),
+                CardWithBody(R"({"type": "ColumnSet", "columns": [{"type": "Container"}]})"),
+                CardWithBody(R"({"type": "ColumnSet", "columns": [{"width": []}]})"),
+                CardWithBody(R"({"type": "FactSet", "facts": [{"title": "a"}]})"),
+                CardWithBody(R"({"type": "ActionSet", "actions": [{"type": "Action.OpenUrl"}]})"),
+                CardWithBody(R"({"type": "Media", "sources": [{"mimeType": "video/mp4", "url": "a"}, {"mimeType": "audio/mp3", "url": "b"}]})"),
+                CardWithBody(R"({"type": "Media"})"),
+                CardWithBody(R"({"type": "Input.Text"})"),
+                CardWithBody(R"({"type": "Input.Text", "id": "a", "maxLength": "5"})"),
+                CardWithBody(R"({"type": "Input.Number", "id": "a", "value": "5"})"),
+                CardWithBody(R"({"type": "Input.Toggle", "id": "a"})"),
+                CardWithBody(R"({"type": "Input.ChoiceSet", "id": "a", "choices": [{"title": "a"}]})"),
+                CardWithBody(R"({"type": "Input.Date", "id": "a", "min": 5})"),
+                CardWithBody(R"({"type": "MyElement", "id": 5})"),
+                R"({"type": "AdaptiveCard", "version": "1.0", "actions": [{"type": "Action.ShowCard", "card": {"type": "Card"}}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "actions": [{"type": "Action.Submit", "ignoreInputValidation": 1}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "actions": [{"type": "Action.ToggleVisibility", "targetElements": [{"elementId": "a", "isVisible": "x"}]}]})",
+                R"({"type": "AdaptiveCard", "version": "1.0", "actions": [{"type": "Action.Foo", "title": 5}]})",
+            };
+
+            for (const auto& card : cards)
+            {
+                AssertValidatesLikeItParses(card);
+            }
+        }
+
+        TEST_METHOD(WarningsMatchDeserialize)
+        {
+            const std::vector<std::string> cards{
+                R"({"type": "AdaptiveCard", "version": "1.0", "lang": "not a language", "minHeight": "tall"})",
+                CardWithBody(R"({"type": "Image", "url": "a", "width": "10 px", "backgroundColor": "blue"})"),
+                CardWithBody(R"({"type": "ColumnSet", "columns": [{"width": "wide", "fallback": {"type": "TextBlock", "text": "a"}}]})"),
+                CardWithBody(R"({"type": "Container", "minHeight": "-5px", "items": [{"type": "MyElement"}]})"),
+                R"({"type": "AdaptiveCard", "version": "1.5", "body": [{"type": "TextBlock"}]})",
+            };
+
+            for (const auto& card : cards)
+            {
+                AssertValidatesLikeItParses(card);
+                Assert::IsFalse(DescribeValidate(card, "1.3").empty());
+            }
+        }
+
+        TEST_METHOD(IdCollisionsAreDetected)
+        {
+            const std::vector<std::string> cards{
+                CardWithBody(R"({"type": "TextBlock", "id": "a", "text": "a"}, {"type": "TextBlock", "id": "a", "text": "b"})"),
+                CardWithBody(R"({"type": "Container", "id": "a", "items": [{"type": "TextBlock", "id": "a", "text": "a"}]})"),
+                CardWithBody(R"({"type": "TextBlock", "id": "a", "text": "a", "fallback": {"type": "TextBlock", "id": "a", "text": "b"}})"),
+                CardWithBody(R"({"type": "TextBlock", "id": "a", "text": "a", "fallback": {"type": "TextBlock", "id": "b", "text": "b"}}, {"type": "TextBlock", "id": "b", "text": "c"})"),
+                R"({"type": "AdaptiveCard", "version": "1.0", "body": [{"type": "TextBlock", "id": "a", "text": "a"}],
+                    "actions": [{"type": "Action.ShowCard", "card": {"type": "AdaptiveCard", "body": [{"type": "TextBlock", "id": "a", "text": "b"}]}}]})",
+            };
+
+            for (const auto& card : cards)
+            {
+                AssertValidatesLikeItParses(card);
+            }
+
+            const auto collision = DescribeValidate(cards.front(), "1.3");
+            Assert::AreEqual("error "s + std::to_string(static_cast<int>(ErrorStatusCode::IdCollision)) + ": Collision detected for id 'a'", collision);
+        }
+
+        TEST_METHOD(ValidationAllocatesLessThanParsing)
+        {
+            unsigned long long parseBytes = 0;
+            unsigned long long validateBytes = 0;
+            for (const auto& sample : LoadSampleCards())
+            {
+                const auto json = ParseUtil::GetJsonValueFromString(sample);
+
+                AllocationCounter counter;
+                try
+                {
+                    ParseContext context;
+                    AdaptiveCard::Deserialize(json, "1.3", context);
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                }
+                parseBytes += counter.GetBytes();
+
+                counter.Reset();
+                try
+                {
+                    ParseContext context;
+                    AdaptiveCard::Validate(json, "1.3", context);
+                }
+                catch (const AdaptiveCardParseException&)
+                {
+                }
+                validateBytes += counter.GetBytes();
+            }
+
+            Logger::WriteMessage(("Parsing allocated " + std::to_string(parseBytes) + " bytes, validation " +
+                                  std::to_string(validateBytes) + "\n").c_str());
+            Assert::IsTrue(validateBytes * 4 < parseBytes);
+        }
+    };
+}
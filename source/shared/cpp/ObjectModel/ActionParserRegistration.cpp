@@ -13,6 +13,26 @@
 
 namespace AdaptiveSharedNamespace
 {
+    namespace
+    {
+        const std::unordered_set<std::string>& GetKnownElements()
+        {
+            static const std::unordered_set<std::string> knownElements{
+                ActionTypeToString(ActionType::OpenUrl),
+                ActionTypeToString(ActionType::ShowCard),
+                ActionTypeToString(ActionType::Submit),
+                ActionTypeToString(ActionType::ToggleVisibility),
+                ActionTypeToString(ActionType::UnknownAction),
+            };
+            return knownElements;
+        }
+    }
+
+    bool ActionElementParser::Validate(ParseContext& context, const Json::Value& value)
+    {
+        return Deserialize(context, value) != nullptr;
+    }
+
     ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionElementParser> parserToWrap) :
         m_parser{parserToWrap}
     {
@@ -22,42 +42,56 @@ namespace AdaptiveSharedNamespace
     {
         const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
         const AdaptiveSharedNamespace::InternalId internalId = AdaptiveSharedNamespace::InternalId::Next();
-        context.PushElement(idProperty, internalId);
-        std::shared_ptr<BaseActionElement> element = m_parser->Deserialize(context, value);
-        context.PopElement();
+        std::shared_ptr<BaseActionElement> element = context.Observe(ParseEventKind::Action, value, [&]() {
+            context.PushElement(idProperty, internalId);
+            auto parsedElement = m_parser->Deserialize(context, value);
+            context.PopElement(parsedElement);
+            return parsedElement;
+        });
 
         return element;
     }
 
     std::shared_ptr<BaseActionElement> ActionElementParserWrapper::DeserializeFromString(ParseContext& context, const std::string& value)
     {
-        return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+        return Deserialize(context, context.Observe(ParseEventKind::JsonRead, value.size(), [&]() {
+            return ParseUtil::GetJsonValueFromString(value);
+        }));
     }
 
-    ActionParserRegistration::ActionParserRegistration()
+    bool ActionElementParserWrapper::Validate(ParseContext& context, const Json::Value& value)
     {
-        m_knownElements.insert({
-            ActionTypeToString(ActionType::OpenUrl),
-            ActionTypeToString(ActionType::ShowCard),
-            ActionTypeToString(ActionType::Submit),
-            ActionTypeToString(ActionType::ToggleVisibility),
-            ActionTypeToString(ActionType::UnknownAction),
-        });
+        const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
+        const AdaptiveSharedNamespace::InternalId internalId = AdaptiveSharedNamespace::InternalId::Next();
+        context.PushElement(idProperty, internalId);
+        const bool isValid = m_parser->Validate(context, value);
+        context.PopElement();
+        return isValid;
+    }
+
+    ActionParserRegistration::ActionParserRegistration() : m_cardElementParsers{GetBuiltInParsers()}
+    {
+    }
 
-        m_cardElementParsers.insert(
-            {{ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
-             {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
-             {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
-             {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
-             {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+    const std::shared_ptr<const ActionParserRegistration::ParserMap>& ActionParserRegistration::GetBuiltInParsers()
+    {
+        static const std::shared_ptr<const ParserMap> builtInParsers = std::make_shared<const ParserMap>(ParserMap{
+            {ActionTypeToString(ActionType::OpenUrl), std::make_shared<OpenUrlActionParser>()},
+            {ActionTypeToString(ActionType::ShowCard), std::make_shared<ShowCardActionParser>()},
+            {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
+            {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
+            {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+        return builtInParsers;
     }
 
     void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
     {
         // make sure caller isn't attempting to overwrite a known element's parser
-        if (m_knownElements.find(elementType) == m_knownElements.end())
+        if (GetKnownElements().find(elementType) == GetKnownElements().end())
         {
-            ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+            auto parsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+            (*parsers)[elementType] = parser;
+            m_cardElementParsers = std::move(parsers);
         }
         else
         {
@@ -68,9 +102,11 @@ namespace AdaptiveSharedNamespace
     void ActionParserRegistration::RemoveParser(std::string const& elementType)
     {
         // make sure caller isn't attempting to remove a known element's parser
-        if (m_knownElements.find(elementType) == m_knownElements.end())
+        if (GetKnownElements().find(elementType) == GetKnownElements().end())
         {
-            ActionParserRegistration::m_cardElementParsers.erase(elementType);
+            auto parsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+            parsers->erase(elementType);
+            m_cardElementParsers = std::move(parsers);
         }
         else
         {
@@ -80,8 +116,8 @@ namespace AdaptiveSharedNamespace
 
     std::shared_ptr<ActionElementParser> ActionParserRegistration::GetParser(std::string const& elementType) const
     {
-        auto parser = m_cardElementParsers.find(elementType);
-        if (parser != ActionParserRegistration::m_cardElementParsers.end())
+        auto parser = m_cardElementParsers->find(elementType);
+        if (parser != m_cardElementParsers->end())
         {
             // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
             // collision detection. We *could* do this within the implementation of parsers themselves, but that would
@@ -96,4 +132,10 @@ namespace AdaptiveSharedNamespace
             return std::shared_ptr<ActionElementParser>(nullptr);
         }
     }
+
+    std::shared_ptr<ActionElementParser> ActionParserRegistration::FindParser(std::string const& elementType) const
+    {
+        auto parser = m_cardElementParsers->find(elementType);
+        return parser != m_cardElementParsers->end() ? parser->second : nullptr;
+    }
 }
@@ -15,6 +15,10 @@ namespace AdaptiveSharedNamespace
     public:
         virtual std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) = 0;
         virtual std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& value) = 0;
+
+        // Checks value the way Deserialize does, throwing and warning alike, and returns whether Deserialize would
+        // return an element. The built-in parsers do so without building the element.
+        virtual bool Validate(ParseContext& context, const Json::Value& value);
     };
 
     class ActionElementParserWrapper : public ActionElementParser
@@ -30,6 +34,7 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) override;
         std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& value) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
         std::shared_ptr<ActionElementParser> GetActualParser() const { return m_parser; }
 
     private:
@@ -45,8 +50,18 @@ namespace AdaptiveSharedNamespace
         void RemoveParser(std::string const& elementType);
         std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser> GetParser(std::string const& elementType) const;
 
+        // Returns the parser registered for elementType, unwrapped, or null if there's none
+        std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser> FindParser(std::string const& elementType) const;
+
     private:
-        std::unordered_set<std::string> m_knownElements;
-        std::unordered_map<std::string, std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
+        using ParserMap = std::unordered_map<std::string,
+                                             std::shared_ptr<AdaptiveSharedNamespace::ActionElementParser>,
+                                             CaseInsensitiveHash,
+                                             CaseInsensitiveEqualTo>;
+
+        static const std::shared_ptr<const ParserMap>& GetBuiltInParsers();
+
+        // Registrations share the parsers of the built-in types, and copy them when a custom parser is added or removed
+        std::shared_ptr<const ParserMap> m_cardElementParsers;
     };
 }
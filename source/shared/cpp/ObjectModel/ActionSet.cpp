@@ -10,13 +10,11 @@ using namespace AdaptiveCards;
 
 ActionSet::ActionSet() : BaseCardElement(CardElementType::ActionSet), m_actions{}, m_orientation(ActionsOrientation::Vertical)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ActionSet::ActionSet(std::vector<std::shared_ptr<BaseActionElement>>& actions) :
     BaseCardElement(CardElementType::ActionSet), m_actions(actions), m_orientation(ActionsOrientation::Vertical)
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::vector<std::shared_ptr<BaseActionElement>>& ActionSet::GetActions()
@@ -44,15 +42,28 @@ Json::Value ActionSet::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<BaseCardElement> ActionSetParser::Deserialize(ParseContext& context, const Json::Value& value)
+void ActionSet::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    ParseUtil::ExpectTypeString(value, CardElementType::ActionSet);
+    usage.AddObject(sizeof(ActionSet));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_actions);
+}
+
+template<typename TPolicy>
+void ActionSetParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    ParseUtil::ExpectTypeString(json, CardElementType::ActionSet);
 
-    auto actionSet = BaseCardElement::Deserialize<ActionSet>(context, value);
+    BaseCardElement::ParseProperties(policy, context, json);
 
     // Parse Actions
-    auto actionElements = ParseUtil::GetActionCollection(context, value, AdaptiveCardSchemaKey::Actions, false);
-    actionSet->m_actions = std::move(actionElements);
+    policy.Actions(context, json, AdaptiveCardSchemaKey::Actions, &ActionSet::m_actions);
+}
+
+std::shared_ptr<BaseCardElement> ActionSetParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto actionSet = std::make_shared<ActionSet>();
+    ParseProperties(BuildPolicy<ActionSet>(*actionSet), context, json);
 
     return actionSet;
 }
@@ -62,7 +73,9 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
     return ActionSetParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ActionSet::PopulateKnownPropertiesSet()
+bool ActionSetParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
+    ParseProperties(ValidatePolicy<ActionSet>(), context, json);
+
+    return true;
 }
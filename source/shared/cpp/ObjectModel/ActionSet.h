@@ -18,12 +18,12 @@ namespace AdaptiveCards
         ActionSet(std::vector<std::shared_ptr<BaseActionElement>>& actions);
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
         std::vector<std::shared_ptr<BaseActionElement>>& GetActions();
         const std::vector<std::shared_ptr<BaseActionElement>>& GetActions() const;
 
     private:
-        void PopulateKnownPropertiesSet() override;
         std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>> m_actions;
         ActionsOrientation m_orientation;
     };
@@ -40,5 +40,10 @@ namespace AdaptiveCards
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& contexts, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -7,7 +7,18 @@
 #endif
 
 #include "AdaptiveBase64Util.h"
-#include <map>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define ADAPTIVE_BASE64_SSSE3
+#include <tmmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#define ADAPTIVE_BASE64_TARGET_SSSE3
+#else
+#define ADAPTIVE_BASE64_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#endif
 
 /*
 * Copyright (C) 2013 Tomas Kislan
@@ -24,222 +35,241 @@ Portions Copyright Microsoft Corporation
 
 using namespace AdaptiveSharedNamespace;
 
-const char c_base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                "abcdefghijklmnopqrstuvwxyz"
-                                "0123456789+/";
-
-void GetBase64Alphabet(std::map<char, int>* base64AlphabetOut)
+namespace
 {
-    static std::map<char, int> base64Alphabet = {
-        {'A', 0}, {'B', 1}, {'C', 2}, {'D', 3}, {'E', 4}, {'F', 5}, {'G', 6}, {'H', 7}, {'I', 8}, {'J', 9}, {'K', 10}, {'L', 11},
-        {'M', 12}, {'N', 13}, {'O', 14}, {'P', 15}, {'Q', 16}, {'R', 17}, {'S', 18}, {'T', 19}, {'U', 20}, {'V', 21}, {'W', 22},
-        {'X', 23}, {'Y', 24}, {'Z', 25}, {'a', 26}, {'b', 27}, {'c', 28}, {'d', 29}, {'e', 30}, {'f', 31}, {'g', 32}, {'h', 33},
-        {'i', 34}, {'j', 35}, {'k', 36}, {'l', 37}, {'m', 38}, {'n', 39}, {'o', 40}, {'p', 41}, {'q', 42}, {'r', 43}, {'s', 44},
-        {'t', 45}, {'u', 46}, {'v', 47}, {'w', 48}, {'x', 49}, {'y', 50}, {'z', 51}, {'0', 52}, {'1', 53}, {'2', 54}, {'3', 55},
-        {'4', 56}, {'5', 57}, {'6', 58}, {'7', 59}, {'8', 60}, {'9', 61}, {'+', 62}, {'/', 63},
+    const char c_base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                    "abcdefghijklmnopqrstuvwxyz"
+                                    "0123456789+/";
+
+    // Values of base64 chars; other chars have the invalid bit set and decode as 0
+    const unsigned char c_invalid = 0x80;
+    const unsigned char c_decodingTable[256] = {
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 62,   0x80, 0x80, 0x80, 63,
+        52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,   11,   12,   13,   14,
+        15,   16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,
+        41,   42,   43,   44,   45,   46,   47,   48,   49,   50,   51,   0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+        0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
     };
 
-    *base64AlphabetOut = base64Alphabet;
-}
-
-size_t AdaptiveBase64Util::DecodedLength(const char* in, size_t in_length)
-{
-    int numEq{};
-
-    const char *in_end{ in + in_length };
-    while (*--in_end == '=')
+    // Length of base64 data, which ends at the first padding char
+    size_t DataLength(const char* in, size_t in_length)
     {
-        ++numEq;
+        const void* padding = std::memchr(in, '=', in_length);
+        return padding ? static_cast<size_t>(static_cast<const char*>(padding) - in) : in_length;
     }
 
-    return ((6 * in_length) / 8) - numEq;
-}
-
-size_t AdaptiveBase64Util::DecodedLength(const std::string& in)
-{
-    size_t numEq{};
-    size_t n{ in.size() };
+    // Decodes groups of 4 chars to 3 bytes, returns the chars that were invalid or'ed together
+    unsigned char DecodeGroups(const unsigned char* in, size_t groups, unsigned char* out)
+    {
+        unsigned char invalid = 0;
+        for (size_t i = 0; i < groups; ++i, in += 4, out += 3)
+        {
+            const unsigned char a = c_decodingTable[in[0]];
+            const unsigned char b = c_decodingTable[in[1]];
+            const unsigned char c = c_decodingTable[in[2]];
+            const unsigned char d = c_decodingTable[in[3]];
+            invalid |= a | b | c | d;
+
+            const unsigned int bits = ((a & 0x3f) << 18) | ((b & 0x3f) << 12) | ((c & 0x3f) << 6) | (d & 0x3f);
+            out[0] = static_cast<unsigned char>(bits >> 16);
+            out[1] = static_cast<unsigned char>(bits >> 8);
+            out[2] = static_cast<unsigned char>(bits);
+        }
+        return invalid & c_invalid;
+    }
 
-    for (auto it = in.rbegin(); (numEq < n) && (*it == '='); ++it)
+#ifdef ADAPTIVE_BASE64_SSSE3
+    bool HasSsse3()
     {
-        ++numEq;
+#ifdef _MSC_VER
+        static const bool hasSsse3 = []() {
+            int cpuInfo[4];
+            __cpuid(cpuInfo, 1);
+            return (cpuInfo[2] & (1 << 9)) != 0;
+        }();
+        return hasSsse3;
+#else
+        return __builtin_cpu_supports("ssse3");
+#endif
     }
 
-    return ((6 * n) / 8) - numEq;
-}
+    // Decodes blocks of 16 chars to 12 bytes until a block has an invalid char, and returns the number of blocks
+    // decoded. Each block stores 16 bytes, so out must have 4 bytes of room after the last block.
+    // Vectorized lookup by Wojciech Mula and Alfred Klomp's base64 library.
+    ADAPTIVE_BASE64_TARGET_SSSE3 size_t DecodeBlocksSsse3(const unsigned char* in, size_t blocks, unsigned char* out)
+    {
+        const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i mask2F = _mm_set1_epi8(0x2F);
+        const __m128i mergeBytes = _mm_set1_epi32(0x01400140);
+        const __m128i mergeWords = _mm_set1_epi32(0x00011000);
+        const __m128i packBytes = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        size_t block = 0;
+        for (; block < blocks; ++block, in += 16, out += 12)
+        {
+            __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+
+            // chars are valid when the bits of their low and high nibbles don't overlap
+            const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask2F);
+            const __m128i loNibbles = _mm_and_si128(chars, mask2F);
+            const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+            const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+            if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+            {
+                break;
+            }
 
-size_t AdaptiveBase64Util::EncodedLength(size_t length)
-{
-    return ((length + 2 - ((length + 2) % 3)) / 3) * 4;
+            // add the offset of each char's range to get its value
+            const __m128i eq2F = _mm_cmpeq_epi8(chars, mask2F);
+            chars = _mm_add_epi8(chars, _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2F, hiNibbles)));
+
+            // pack 4 values of 6 bits to 3 bytes
+            const __m128i words = _mm_maddubs_epi16(chars, mergeBytes);
+            const __m128i bytes = _mm_madd_epi16(words, mergeWords);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(bytes, packBytes));
+        }
+        return block;
+    }
+#endif
 }
 
-size_t AdaptiveBase64Util::EncodedLength(const std::vector<char>& in)
+size_t AdaptiveBase64Util::DecodedLength(const char* in, size_t in_length)
 {
-    return EncodedLength(in.size());
+    // a single char left over doesn't make a byte
+    const size_t dataLength = DataLength(in, in_length);
+    return (dataLength / 4) * 3 + ((dataLength % 4) * 3) / 4;
 }
 
-void AdaptiveBase64Util::StripPadding(std::string* in)
+bool AdaptiveBase64Util::Decode(const char* in, size_t in_length, char* out)
 {
-    while (!in->empty() && *(in->rbegin()) == '=')
+    const size_t dataLength = DataLength(in, in_length);
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(in);
+    unsigned char* output = reinterpret_cast<unsigned char*>(out);
+    size_t groups = dataLength / 4;
+    unsigned char invalid = 0;
+
+#ifdef ADAPTIVE_BASE64_SSSE3
+    // blocks store 4 bytes past their output, so at least 2 groups are left for the table, whose 6 bytes hold the
+    // store of the last block
+    if (groups > 5 && HasSsse3())
     {
-        in->resize(in->size() - 1);
+        const size_t blocks = DecodeBlocksSsse3(input, (groups - 2) / 4, output);
+        input += blocks * 16;
+        output += blocks * 12;
+        groups -= blocks * 4;
     }
-}
+#endif
 
-void AdaptiveBase64Util::a3_to_a4(unsigned char* a4, unsigned char* a3)
-{
-    a4[0] = (a3[0] & 0xfc) >> 2;
-    a4[1] = ((a3[0] & 0x03) << 4) + ((a3[1] & 0xf0) >> 4);
-    a4[2] = ((a3[1] & 0x0f) << 2) + ((a3[2] & 0xc0) >> 6);
-    a4[3] = (a3[2] & 0x3f);
-}
+    invalid |= DecodeGroups(input, groups, output);
+    input += groups * 4;
+    output += groups * 3;
 
-void AdaptiveBase64Util::a4_to_a3(unsigned char* a3, unsigned char* a4)
-{
-    a3[0] = (a4[0] << 2) + ((a4[1] & 0x30) >> 4);
-    a3[1] = ((a4[1] & 0xf) << 4) + ((a4[2] & 0x3c) >> 2);
-    a3[2] = ((a4[2] & 0x3) << 6) + a4[3];
+    const size_t remainder = dataLength % 4;
+    if (remainder)
+    {
+        unsigned char group[4] = {'A', 'A', 'A', 'A'};
+        std::memcpy(group, input, remainder);
+        unsigned char bytes[3];
+        invalid |= DecodeGroups(group, 1, bytes);
+        std::memcpy(output, bytes, (remainder * 3) / 4);
+    }
+
+    return !invalid && remainder != 1;
 }
 
-unsigned char AdaptiveBase64Util::b64_lookup(unsigned char c)
+std::vector<char> AdaptiveBase64Util::Decode(const std::string& encodedBase64)
 {
-    std::map<char, int> base64Alphabet;
-    GetBase64Alphabet(&base64Alphabet);
-
-    if (base64Alphabet.find(c) == base64Alphabet.end())
-    {
-        return 255;
-    }
-    return static_cast<unsigned char>(base64Alphabet[c]);
+    std::vector<char> decoded(DecodedLength(encodedBase64.data(), encodedBase64.size()));
+    Decode(encodedBase64.data(), encodedBase64.size(), decoded.data());
+    return decoded;
 }
 
 bool AdaptiveBase64Util::Encode(const std::vector<char>& in, std::string* out)
 {
-    out->resize(EncodedLength(in));
-
-    size_t input_len{ in.size() };
-    auto input = in.begin();
+    const size_t length = in.size();
+    out->resize(((length + 2) / 3) * 4);
 
-    int i{};
-    size_t enc_len{};
-    unsigned char a3[3];
-    unsigned char a4[4];
-    while (input_len--)
+    const unsigned char* input = reinterpret_cast<const unsigned char*>(in.data());
+    size_t enc_len = 0;
+    size_t i = 0;
+    for (; i + 3 <= length; i += 3)
     {
-        a3[i++] = *(input++);
-        if (i == 3)
-        {
-            a3_to_a4(a4, a3);
-
-            for (i = 0; i < 4; ++i)
-            {
-                (*out)[enc_len++] = c_base64Alphabet[a4[i]];
-            }
-
-            i = 0;
-        }
+        const unsigned int bits = (input[i] << 16) | (input[i + 1] << 8) | input[i + 2];
+        (*out)[enc_len++] = c_base64Alphabet[(bits >> 18) & 0x3f];
+        (*out)[enc_len++] = c_base64Alphabet[(bits >> 12) & 0x3f];
+        (*out)[enc_len++] = c_base64Alphabet[(bits >> 6) & 0x3f];
+        (*out)[enc_len++] = c_base64Alphabet[bits & 0x3f];
     }
 
-    if (i)
+    if (i < length)
     {
-        for (int j{ i }; j < 3; ++j)
-        {
-            a3[j] = '\0';
-        }
-
-        a3_to_a4(a4, a3);
-
-        for (int j{}; j < i + 1; ++j)
-        {
-            (*out)[enc_len++] = c_base64Alphabet[a4[j]];
-        }
-
-        while ((i++ < 3))
-        {
-            (*out)[enc_len++] = '=';
-        }
+        const unsigned int bits = (input[i] << 16) | ((i + 1 < length) ? (input[i + 1] << 8) : 0);
+        (*out)[enc_len++] = c_base64Alphabet[(bits >> 18) & 0x3f];
+        (*out)[enc_len++] = c_base64Alphabet[(bits >> 12) & 0x3f];
+        (*out)[enc_len++] = (i + 1 < length) ? c_base64Alphabet[(bits >> 6) & 0x3f] : '=';
+        (*out)[enc_len++] = '=';
     }
 
     return (enc_len == out->size());
 }
 
-bool AdaptiveBase64Util::Decode(const std::string& in, std::vector<char>* out)
+std::string AdaptiveBase64Util::Encode(const std::vector<char>& decodedBase64)
 {
-    size_t input_len{ in.size() };
-    auto input = in.begin();
+    std::string encodedString;
+    Encode(decodedBase64, &encodedString);
+    return encodedString;
+}
 
-    out->resize(DecodedLength(in));
+// Format for DataURI is data:[<MediaType>][;base64],data with MediaType and base64 being optional and data is composed of [A-Z a-z 0-9 + /] characters
+std::string AdaptiveBase64Util::ExtractDataFromUri(const std::string& dataUri)
+{
+    const char* data;
+    size_t dataLength;
+    FindDataInUri(dataUri.data(), dataUri.size(), data, dataLength);
+    return std::string(data, dataLength);
+}
 
-    int i{};
-    size_t dec_len = 0;
-    unsigned char a3[3];
-    unsigned char a4[4];
-    while (input_len--)
+void AdaptiveBase64Util::FindDataInUri(const char* dataUri, size_t length, const char*& data, size_t& dataLength)
+{
+    // data follows the last comma, or is the whole uri when there's none
+    const char* dataStart = dataUri;
+    for (const char* ch = dataUri + length; ch != dataUri; --ch)
     {
-        if (*input == '=')
+        if (*(ch - 1) == ',')
         {
+            dataStart = ch;
             break;
         }
-
-        a4[i++] = *(input++);
-        if (i == 4)
-        {
-            for (i = 0; i < 4; ++i)
-            {
-                a4[i] = b64_lookup(a4[i]);
-            }
-
-            a4_to_a3(a3, a4);
-
-            for (i = 0; i < 3; ++i)
-            {
-                (*out)[dec_len++] = a3[i];
-            }
-
-            i = 0;
-        }
-    }
-
-    if (i)
-    {
-        for (int j{ i }; j < 4; ++j)
-        {
-            a4[j] = '\0';
-        }
-
-        for (int j{}; j < 4; j++)
-        {
-            a4[j] = b64_lookup(a4[j]);
-        }
-
-        a4_to_a3(a3, a4);
-
-        for (int j{}; j < i - 1; ++j)
-        {
-            (*out)[dec_len++] = a3[j];
-        }
     }
-
-    return (dec_len == out->size());
-}
-
-std::vector<char> AdaptiveBase64Util::Decode(const std::string& encodedBase64)
-{
-    std::vector<char> decodedString;
-    Decode(encodedBase64, &decodedString);
-    return decodedString;
+    data = dataStart;
+    dataLength = length - (dataStart - dataUri);
 }
 
-std::string AdaptiveBase64Util::Encode(const std::vector<char>& decodedBase64)
+size_t AdaptiveBase64Util::DecodedDataUriLength(const char* dataUri, size_t length)
 {
-    std::string encodedString;
-    Encode(decodedBase64, &encodedString);
-    return encodedString;
+    const char* data;
+    size_t dataLength;
+    FindDataInUri(dataUri, length, data, dataLength);
+    return DecodedLength(data, dataLength);
 }
 
-// Format for DataURI is data:[<MediaType>][;base64],data with MediaType and base64 being optional and data is composed of [A-Z a-z 0-9 + /] characters
-std::string AdaptiveBase64Util::ExtractDataFromUri(const std::string& dataUri)
+bool AdaptiveBase64Util::DecodeDataUri(const char* dataUri, size_t length, char* out)
 {
-    size_t comaPosition = dataUri.find_last_of(",");
-    return dataUri.substr(comaPosition + 1);
+    const char* data;
+    size_t dataLength;
+    FindDataInUri(dataUri, length, data, dataLength);
+    return Decode(data, dataLength, out);
 }
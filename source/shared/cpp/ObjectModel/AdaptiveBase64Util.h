@@ -13,21 +13,25 @@ namespace AdaptiveSharedNamespace
     class AdaptiveBase64Util
     {
     private:
-        static size_t DecodedLength(const char* in, size_t in_length);
-        static size_t DecodedLength(const std::string& in);
-        static inline size_t EncodedLength(size_t length);
-        static inline size_t EncodedLength(const std::vector<char>& in);
-        static inline void StripPadding(std::string* in);
-        static inline void a3_to_a4(unsigned char* a4, unsigned char* a3);
-        static inline void a4_to_a3(unsigned char* a3, unsigned char* a4);
-        static inline unsigned char b64_lookup(unsigned char c);
         static bool Encode(const std::vector<char>& in, std::string* out);
-        static bool Decode(const std::string& in, std::vector<char>* out);
+        static void FindDataInUri(const char* dataUri, size_t length, const char*& data, size_t& dataLength);
 
     public:
         static std::vector<char> Decode(const std::string& encodedBase64);
         static std::string Encode(const std::vector<char>& decodedBase64);
 
         static std::string ExtractDataFromUri(const std::string& dataUri);
+
+        // Number of bytes the given base64 decodes to; decoding ends at the first padding char
+        static size_t DecodedLength(const char* in, size_t in_length);
+        // Decodes base64 into out, which must hold DecodedLength(in, in_length) bytes. Returns false if the base64 has
+        // invalid chars, which are decoded as if they were 'A'.
+        static bool Decode(const char* in, size_t in_length, char* out);
+
+        // Data URIs are decoded without copying their data, so that large inline images can be decoded into a buffer
+        // the caller owns
+        static size_t DecodedDataUriLength(const char* dataUri, size_t length);
+        // out must hold DecodedDataUriLength(dataUri, length) bytes
+        static bool DecodeDataUri(const char* dataUri, size_t length, char* out);
     };
 }
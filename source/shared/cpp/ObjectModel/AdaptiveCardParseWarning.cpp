@@ -19,3 +19,9 @@ const std::string& AdaptiveCardParseWarning::GetReason() const
 {
     return m_message;
 }
+
+void AdaptiveCardParseWarning::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(AdaptiveCardParseWarning));
+    usage.AddString(m_message);
+}
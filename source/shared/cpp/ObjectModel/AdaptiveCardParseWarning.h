@@ -3,6 +3,7 @@
 #pragma once
 
 #include "pch.h"
+#include "MemoryUsage.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -14,6 +15,8 @@ namespace AdaptiveSharedNamespace
         AdaptiveSharedNamespace::WarningStatusCode GetStatusCode() const;
         const std::string& GetReason() const;
 
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
+
     private:
         const AdaptiveSharedNamespace::WarningStatusCode m_statusCode;
         const std::string m_message;
@@ -3,13 +3,14 @@
 #include "pch.h"
 #include "BackgroundImage.h"
 #include "ParseContext.h"
+#include "ParsePolicy.h"
 #include "ParseUtil.h"
 
 using namespace AdaptiveSharedNamespace;
 
-std::string BackgroundImage::GetUrl() const { return m_url; }
+const std::string& BackgroundImage::GetUrl() const { return m_url; }
 
-void BackgroundImage::SetUrl(const std::string& value) { m_url = value; }
+void BackgroundImage::SetUrl(std::string value) { m_url = std::move(value); }
 
 ImageFillMode BackgroundImage::GetFillMode() const { return m_fillMode; }
 
@@ -68,20 +69,30 @@ Json::Value BackgroundImage::SerializeToJsonValue() const
     return root;
 }
 
+template<typename TPolicy> void BackgroundImage::ParseProperties(const TPolicy& policy, const Json::Value& json)
+{
+    policy.String(json, AdaptiveCardSchemaKey::Url, &BackgroundImage::SetUrl, true);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::FillMode,
+                ImageFillMode::Cover,
+                ImageFillModeFromString,
+                &BackgroundImage::SetFillMode);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::HorizontalAlignment,
+                HorizontalAlignment::Left,
+                HorizontalAlignmentFromString,
+                &BackgroundImage::SetHorizontalAlignment);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::VerticalAlignment,
+                VerticalAlignment::Top,
+                VerticalAlignmentFromString,
+                &BackgroundImage::SetVerticalAlignment);
+}
+
 std::shared_ptr<BackgroundImage> BackgroundImage::Deserialize(const Json::Value& json)
 {
     std::shared_ptr<BackgroundImage> image = std::make_shared<BackgroundImage>();
-
-    image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
-
-    image->SetFillMode(ParseUtil::GetEnumValue<ImageFillMode>(
-        json, AdaptiveCardSchemaKey::FillMode, ImageFillMode::Cover, ImageFillModeFromString));
-
-    image->SetHorizontalAlignment(ParseUtil::GetEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentFromString));
-
-    image->SetVerticalAlignment(ParseUtil::GetEnumValue<VerticalAlignment>(
-        json, AdaptiveCardSchemaKey::VerticalAlignment, VerticalAlignment::Top, VerticalAlignmentFromString));
+    ParseProperties(BuildPolicy<BackgroundImage>(*image), json);
 
     return image;
 }
@@ -90,3 +101,14 @@ std::shared_ptr<BackgroundImage> BackgroundImage::DeserializeFromString(const st
 {
     return BackgroundImage::Deserialize(ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+void BackgroundImage::Validate(const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<BackgroundImage>(), json);
+}
+
+void BackgroundImage::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(BackgroundImage));
+    usage.AddString(m_url);
+}
@@ -4,6 +4,7 @@
 
 #include "pch.h"
 #include "ParseContext.h"
+#include "MemoryUsage.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -14,14 +15,14 @@ namespace AdaptiveSharedNamespace
             m_fillMode(ImageFillMode::Cover), m_hAlignment(HorizontalAlignment::Left), m_vAlignment(VerticalAlignment::Top)
         {
         }
-        BackgroundImage(std::string const& url) : m_url(url) {}
-        BackgroundImage(std::string const& url, ImageFillMode fillMode, HorizontalAlignment hAlignment, VerticalAlignment vAlignment) :
-            m_url(url), m_fillMode(fillMode), m_hAlignment(hAlignment), m_vAlignment(vAlignment)
+        BackgroundImage(std::string url) : m_url(std::move(url)) {}
+        BackgroundImage(std::string url, ImageFillMode fillMode, HorizontalAlignment hAlignment, VerticalAlignment vAlignment) :
+            m_url(std::move(url)), m_fillMode(fillMode), m_hAlignment(hAlignment), m_vAlignment(vAlignment)
         {
         }
 
-        std::string GetUrl() const;
-        void SetUrl(const std::string& value);
+        const std::string& GetUrl() const;
+        void SetUrl(std::string value);
         ImageFillMode GetFillMode() const;
         void SetFillMode(const ImageFillMode& value);
         HorizontalAlignment GetHorizontalAlignment() const;
@@ -31,11 +32,15 @@ namespace AdaptiveSharedNamespace
 
         std::string Serialize() const;
         Json::Value SerializeToJsonValue() const;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
         static std::shared_ptr<BackgroundImage> Deserialize(const Json::Value& json);
         static std::shared_ptr<BackgroundImage> DeserializeFromString(const std::string& jsonString);
+        static void Validate(const Json::Value& json);
 
     private:
+        template<typename TPolicy> static void ParseProperties(const TPolicy& policy, const Json::Value& json);
+
         std::string m_url;
         ImageFillMode m_fillMode = ImageFillMode::Cover;
         HorizontalAlignment m_hAlignment = HorizontalAlignment::Left;
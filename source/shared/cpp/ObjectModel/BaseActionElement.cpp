@@ -4,16 +4,21 @@
 #include "BaseActionElement.h"
 #include "BaseElement.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 using namespace AdaptiveSharedNamespace;
 
+static_assert(sizeof(BaseActionElement) <=
+                  UnpaddedSize(sizeof(BaseElement) + sizeof(ActionType) + sizeof(std::string) + 2 * sizeof(InternedString),
+                               alignof(BaseActionElement)),
+              "BaseActionElement is larger than its fields, keep them ordered by alignment");
+
 constexpr const char* const BaseActionElement::defaultStyle;
 
 BaseActionElement::BaseActionElement(ActionType type) :
-    m_style(BaseActionElement::defaultStyle), m_type(type)
+    m_type(type), m_style(GetDefaultStyle())
 {
-    SetTypeString(ActionTypeToString(type));
-    PopulateKnownPropertiesSet();
+    SetTypeString(type);
 }
 
 std::string BaseActionElement::GetTitle() const
@@ -28,22 +33,28 @@ void BaseActionElement::SetTitle(const std::string& value)
 
 std::string BaseActionElement::GetIconUrl() const
 {
-    return m_iconUrl;
+    return m_iconUrl.Get();
 }
 
 void BaseActionElement::SetIconUrl(const std::string& value)
 {
-    m_iconUrl = value;
+    m_iconUrl = InternedString(value);
 }
 
 std::string BaseActionElement::GetStyle() const
 {
-    return m_style;
+    return m_style.Get();
 }
 
 void BaseActionElement::SetStyle(const std::string& value)
 {
-    m_style = value;
+    m_style = InternedString(value);
+}
+
+const InternedString& BaseActionElement::GetDefaultStyle()
+{
+    static const InternedString style(defaultStyle);
+    return style;
 }
 
 const ActionType BaseActionElement::GetElementType() const
@@ -57,7 +68,7 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
     if (!m_iconUrl.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl)] = m_iconUrl;
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl)] = m_iconUrl.Get();
     }
 
     if (!m_title.empty())
@@ -65,29 +76,19 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = m_title;
     }
 
-    if (!m_style.empty() && (m_style.compare(defaultStyle) != 0))
+    if (!m_style.empty() && (m_style.Get().compare(defaultStyle) != 0))
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = m_style;
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)] = m_style.Get();
     }
 
     return root;
 }
 
-void BaseActionElement::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)});
-}
-
 void BaseActionElement::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
     if (!m_iconUrl.empty())
     {
-        RemoteResourceInformation imageResourceInfo;
-        imageResourceInfo.url = m_iconUrl;
-        imageResourceInfo.mimeType = "image";
-        resourceInfo.push_back(imageResourceInfo);
+        resourceInfo.push_back({m_iconUrl.Get(), "image"});
     }
 }
 
@@ -97,3 +98,14 @@ void BaseActionElement::ParseJsonObject(AdaptiveSharedNamespace::ParseContext& c
 {
     baseElement = ParseUtil::GetActionFromJsonValue(context, json);
 }
+
+bool BaseActionElement::ValidateJsonObject(ParseContext& context, const Json::Value& json)
+{
+    return ParseUtil::ValidateActionFromJsonValue(context, json);
+}
+
+void BaseActionElement::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    BaseElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_title);
+}
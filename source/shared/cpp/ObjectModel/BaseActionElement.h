@@ -6,8 +6,13 @@
 #include "ParseUtil.h"
 #include "RemoteResourceInformation.h"
 #include "BaseElement.h"
+#include "SchemaProperties.h"
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
+void HandleUnknownProperties(const Json::Value& json,
+                             AdaptiveSharedNamespace::SchemaPropertySet schemaProperties,
+                             const std::unordered_set<std::string>& knownProperties,
+                             Json::Value& unknownProperties);
 
 namespace AdaptiveSharedNamespace
 {
@@ -35,40 +40,64 @@ namespace AdaptiveSharedNamespace
         virtual const ActionType GetElementType() const;
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
         Json::Value SerializeToJsonValue() const override;
 
         template <typename T>
         static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
+        // Walks the properties every action has with a ParsePolicy, for the parsers of the action types
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
 
         static void ParseJsonObject(AdaptiveSharedNamespace::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element);
 
-    protected:
-        void PopulateKnownPropertiesSet() override;
+        // Validation counterpart of ParseJsonObject, which checks json without building an action
+        static bool ValidateJsonObject(ParseContext& context, const Json::Value& json);
 
     private:
-        std::string m_title;
-        std::string m_iconUrl;
-        std::string m_style;
+        // Shared by every action of the default style
+        static const InternedString& GetDefaultStyle();
+
         static constexpr const char* const defaultStyle = "default";
+
+        // The type comes first, to share the padding at the end of BaseElement where the ABI allows it
         ActionType m_type;
+        std::string m_title;
+        InternedString m_iconUrl;
+        InternedString m_style;
     };
 
     template <typename T>
     std::shared_ptr<T> BaseActionElement::Deserialize(ParseContext& context, const Json::Value& json)
     {
-        std::shared_ptr<T> cardElement = std::make_shared<T>();
-        std::shared_ptr<BaseActionElement> baseActionElement = std::static_pointer_cast<BaseActionElement>(cardElement);
+        std::shared_ptr<T> actionElement = std::make_shared<T>();
+        ParseProperties(BuildPolicy<BaseActionElement>(*actionElement), context, json);
+        return actionElement;
+    }
 
+    template<typename TPolicy>
+    void BaseActionElement::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+    {
         ParseUtil::ThrowIfNotJsonObject(json);
 
-        baseActionElement->DeserializeBase<BaseActionElement>(context, json);
-        baseActionElement->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title));
-        baseActionElement->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
-        baseActionElement->SetStyle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Style, defaultStyle, false));
-
-        // Walk all properties and put any unknown ones in the additional properties json
-        HandleUnknownProperties(json, baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
-
-        return cardElement;
+        BaseElement::ParseBase<BaseActionElement>(policy, context, json);
+        policy.String(json, AdaptiveCardSchemaKey::Title, &BaseActionElement::SetTitle);
+        policy.String(json, AdaptiveCardSchemaKey::IconUrl, [&context](BaseActionElement& action, std::string iconUrl) {
+            action.m_iconUrl = context.Intern(std::move(iconUrl));
+        });
+        const auto setStyle = [&context](BaseActionElement& action, std::string style) {
+            action.m_style = (style == defaultStyle) ? GetDefaultStyle() : context.Intern(std::move(style));
+        };
+        policy.String(json, AdaptiveCardSchemaKey::Style, defaultStyle, setStyle);
+
+        if (BaseActionElement* actionElement = policy.Object())
+        {
+            // Walk all properties and put any unknown ones in the additional properties json
+            actionElement->PopulateKnownPropertiesSet();
+            HandleUnknownProperties(json,
+                                    GetSchemaProperties(actionElement->GetElementType()),
+                                    actionElement->m_knownProperties,
+                                    actionElement->m_additionalProperties);
+        }
     }
 }
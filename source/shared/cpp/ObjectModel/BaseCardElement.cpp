@@ -8,33 +8,25 @@
 #include "ShowCardAction.h"
 #include "OpenUrlAction.h"
 #include "SubmitAction.h"
+#include "Util.h"
 
 using namespace AdaptiveSharedNamespace;
 
+static_assert(sizeof(BaseCardElement) <=
+                  UnpaddedSize(sizeof(BaseElement) + 2 * sizeof(bool) + sizeof(CardElementType) + sizeof(Spacing) + sizeof(HeightType),
+                               alignof(BaseCardElement)),
+              "BaseCardElement is larger than its fields, keep them ordered by alignment");
+
 BaseCardElement::BaseCardElement(CardElementType type, Spacing spacing, bool separator, HeightType height) :
-    m_type(type), m_spacing(spacing),
-    m_height(height), m_separator(separator),
-    m_isVisible(true)
+    m_separator(separator), m_isVisible(true), m_type(type), m_spacing(spacing), m_height(height)
 {
-    SetTypeString(CardElementTypeToString(type));
-    PopulateKnownPropertiesSet();
+    SetTypeString(type);
 }
 
 BaseCardElement::BaseCardElement(CardElementType type) :
-    m_type(type), m_spacing(Spacing::Default), m_separator(false),
-    m_height(HeightType::Auto), m_isVisible(true)
+    m_separator(false), m_isVisible(true), m_type(type), m_spacing(Spacing::Default), m_height(HeightType::Auto)
 {
-    SetTypeString(CardElementTypeToString(type));
-    PopulateKnownPropertiesSet();
-}
-
-void BaseCardElement::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MinHeight),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)});
+    SetTypeString(type);
 }
 
 bool BaseCardElement::GetSeparator() const
@@ -137,3 +129,26 @@ void BaseCardElement::ParseJsonObject(AdaptiveSharedNamespace::ParseContext& con
 
     throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
 }
+
+bool BaseCardElement::ValidateJsonObject(ParseContext& context, const Json::Value& json)
+{
+    return ValidateJsonObject(context, json, ParseUtil::GetTypeAsString(json));
+}
+
+bool BaseCardElement::ValidateJsonObject(ParseContext& context, const Json::Value& json, const std::string& typeString)
+{
+    std::shared_ptr<BaseCardElementParser> parser = context.elementParserRegistration->FindParser(typeString);
+
+    if (parser == nullptr)
+    {
+        parser = context.elementParserRegistration->FindParser("Unknown");
+    }
+
+    // The parser is wrapped on the stack rather than by GetParser, which allocates the wrapper
+    if (BaseCardElementParserWrapper(std::move(parser)).Validate(context, json))
+    {
+        return true;
+    }
+
+    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
+}
@@ -8,8 +8,13 @@
 #include "ElementParserRegistration.h"
 #include "Separator.h"
 #include "RemoteResourceInformation.h"
+#include "SchemaProperties.h"
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
+void HandleUnknownProperties(const Json::Value& json,
+                             AdaptiveSharedNamespace::SchemaPropertySet schemaProperties,
+                             const std::unordered_set<std::string>& knownProperties,
+                             Json::Value& unknownProperties);
 
 namespace AdaptiveSharedNamespace
 {
@@ -43,40 +48,64 @@ namespace AdaptiveSharedNamespace
         virtual const CardElementType GetElementType() const;
 
         template<typename T> static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
+        // Walks the properties every element has with a ParsePolicy, for the parsers of the element types
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
 
         static void ParseJsonObject(AdaptiveSharedNamespace::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element);
 
+        // Validation counterparts of ParseJsonObject, which check json without building an element. The typeString
+        // overload validates json as an element of that type, for items of a type implied by their collection.
+        static bool ValidateJsonObject(ParseContext& context, const Json::Value& json);
+        static bool ValidateJsonObject(ParseContext& context, const Json::Value& json, const std::string& typeString);
+
     protected:
         static Json::Value SerializeSelectAction(const std::shared_ptr<BaseActionElement> selectAction);
-        void PopulateKnownPropertiesSet() override;
 
     private:
+        // The flags come first, to share the padding at the end of BaseElement where the ABI allows it
+        bool m_separator;
+        bool m_isVisible;
         CardElementType m_type;
         Spacing m_spacing;
         HeightType m_height;
-        bool m_separator;
-        bool m_isVisible;
     };
 
     template<typename T> std::shared_ptr<T> BaseCardElement::Deserialize(ParseContext& context, const Json::Value& json)
     {
         std::shared_ptr<T> cardElement = std::make_shared<T>();
-        std::shared_ptr<BaseCardElement> baseCardElement = std::static_pointer_cast<BaseCardElement>(cardElement);
+        ParseProperties(BuildPolicy<BaseCardElement>(*cardElement), context, json);
+        return cardElement;
+    }
 
+    template<typename TPolicy>
+    void BaseCardElement::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+    {
         ParseUtil::ThrowIfNotJsonObject(json);
 
-        baseCardElement->DeserializeBase<BaseCardElement>(context, json);
-        baseCardElement->SetCanFallbackToAncestor(context.GetCanFallbackToAncestor());
-        baseCardElement->SetHeight(
-            ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString));
-        baseCardElement->SetIsVisible(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsVisible, true));
-        baseCardElement->SetSeparator(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Separator, false));
-        baseCardElement->SetSpacing(
-            ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingFromString));
-
-        // Walk all properties and put any unknown ones in the additional properties json
-        HandleUnknownProperties(json, baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
-
-        return cardElement;
+        BaseElement::ParseBase<BaseCardElement>(policy, context, json);
+        policy.Set(&BaseCardElement::SetCanFallbackToAncestor, context.GetCanFallbackToAncestor());
+        policy.Enum(json,
+                    AdaptiveCardSchemaKey::Height,
+                    HeightType::Auto,
+                    HeightTypeFromString,
+                    &BaseCardElement::SetHeight);
+        policy.Bool(json, AdaptiveCardSchemaKey::IsVisible, true, &BaseCardElement::SetIsVisible);
+        policy.Bool(json, AdaptiveCardSchemaKey::Separator, false, &BaseCardElement::SetSeparator);
+        policy.Enum(json,
+                    AdaptiveCardSchemaKey::Spacing,
+                    Spacing::Default,
+                    SpacingFromString,
+                    &BaseCardElement::SetSpacing);
+
+        if (BaseCardElement* cardElement = policy.Object())
+        {
+            // Walk all properties and put any unknown ones in the additional properties json
+            cardElement->PopulateKnownPropertiesSet();
+            HandleUnknownProperties(json,
+                                    GetSchemaProperties(cardElement->GetElementType()),
+                                    cardElement->m_knownProperties,
+                                    cardElement->m_additionalProperties);
+        }
     }
 }
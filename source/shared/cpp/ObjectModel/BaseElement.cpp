@@ -5,9 +5,97 @@
 #include "BaseElement.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
+#include "Util.h"
+#include <array>
 
 namespace AdaptiveSharedNamespace
 {
+    namespace
+    {
+        // Names of the built-in types, made once and then shared by every element of the type without locking. Types
+        // the enum has no name for are left empty.
+        template<typename TType, size_t Count>
+        std::array<InternedString, Count> MakeTypeNames(const std::string (*toString)(TType))
+        {
+            std::array<InternedString, Count> names;
+            for (size_t i = 0; i < Count; ++i)
+            {
+                try
+                {
+                    names[i] = InternedString(toString(static_cast<TType>(i)));
+                }
+                catch (const std::out_of_range&)
+                {
+                }
+            }
+            return names;
+        }
+
+        template<typename TType, size_t Count>
+        InternedString GetTypeName(const std::array<InternedString, Count>& names, TType type, const std::string (*toString)(TType))
+        {
+            const auto index = static_cast<size_t>(type);
+            return (index < Count && !names[index].empty()) ? names[index] : InternedString(toString(type));
+        }
+
+        // Names of custom types, which hosts set on the elements their parsers make
+        StringPool& GetCustomTypeNames()
+        {
+            static StringPool customTypeNames(true);
+            return customTypeNames;
+        }
+
+        // Calls onRequirement with the name and version of each requirement of the element, throwing on invalid ones
+        template<typename TOnRequirement>
+        void ForEachRequirement(const Json::Value& json, TOnRequirement&& onRequirement)
+        {
+            const auto& requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+            if (!requiresValue.isNull())
+            {
+                if (requiresValue.isObject())
+                {
+                    for (auto requirement = requiresValue.begin(); requirement != requiresValue.end(); ++requirement)
+                    {
+                        const std::string memberName = requirement.name();
+                        if (!requirement->isString())
+                        {
+                            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                                             "Invalid version in requires value for '" + memberName + "'");
+                        }
+                        const auto& memberValue = requirement->asString();
+
+                        if (memberValue == "*")
+                        {
+                            // * means any version.
+                            onRequirement(memberName, SemanticVersion("0"));
+                        }
+                        else
+                        {
+                            try
+                            {
+                                onRequirement(memberName, SemanticVersion(memberValue));
+                            }
+                            catch (const AdaptiveCardParseException&)
+                            {
+                                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                                                 "Invalid version in requires value: '" + memberValue + "'");
+                            }
+                        }
+                    }
+                    return;
+                }
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid value for requires (should be object)");
+            }
+        }
+    }
+
+    static_assert(sizeof(BaseElement) <=
+                      UnpaddedSize(sizeof(void*) + sizeof(InternedString) + sizeof(std::unordered_set<std::string>) +
+                                       sizeof(Json::Value) + 2 * sizeof(std::shared_ptr<BaseElement>) + sizeof(std::string) +
+                                       sizeof(InternalId) + sizeof(FallbackType) + sizeof(bool),
+                                   alignof(BaseElement)),
+                  "BaseElement is larger than its fields, keep them ordered by alignment");
+
     unsigned int InternalId::s_currentInternalId = 1;
 
     InternalId InternalId::Current()
@@ -39,46 +127,45 @@ namespace AdaptiveSharedNamespace
 
     void BaseElement::SetId(const std::string& value) { m_id = value; }
 
-    std::string BaseElement::GetElementTypeString() const { return m_typeString; }
+    const std::string& BaseElement::GetElementTypeString() const { return m_typeString.Get(); }
+
+    void BaseElement::SetElementTypeString(std::string value)
+    {
+        m_typeString = GetCustomTypeNames().Intern(std::move(value));
+    }
 
-    void BaseElement::SetElementTypeString(const std::string& value) { m_typeString = value; }
+    void BaseElement::SetElementTypeString(InternedString value) { m_typeString = std::move(value); }
 
-    void BaseElement::PopulateKnownPropertiesSet()
+    void BaseElement::SetTypeString(CardElementType type)
     {
-        m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Requires),
-                                  AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+        static const auto typeNames =
+            MakeTypeNames<CardElementType, static_cast<size_t>(CardElementType::Unknown) + 1>(CardElementTypeToString);
+        m_typeString = GetTypeName(typeNames, type, CardElementTypeToString);
     }
 
+    void BaseElement::SetTypeString(ActionType type)
+    {
+        static const auto typeNames =
+            MakeTypeNames<ActionType, static_cast<size_t>(ActionType::UnknownAction) + 1>(ActionTypeToString);
+        m_typeString = GetTypeName(typeNames, type, ActionTypeToString);
+    }
+
+    void BaseElement::PopulateKnownPropertiesSet() {}
+
     Json::Value BaseElement::GetAdditionalProperties() const { return m_additionalProperties; }
 
-    void BaseElement::SetAdditionalProperties(Json::Value const& value) { m_additionalProperties = value; }
+    void BaseElement::SetAdditionalProperties(Json::Value value) { m_additionalProperties = std::move(value); }
 
     // Given a map of what our host provides, determine if this element's requirements are satisfied.
     bool BaseElement::MeetsRequirements(const AdaptiveSharedNamespace::FeatureRegistration& featureRegistration) const
     {
         for (const auto& requirement : *m_requires)
         {
-            // special case for adaptive cards version
-            const auto& requirementName = requirement.first;
-            const auto& requirementVersion = requirement.second;
-            const auto& featureVersion = featureRegistration.GetFeatureVersion(requirementName);
-            if (featureVersion.empty())
+            // host must provide the requirement at an acceptable version
+            if (!featureRegistration.ProvidesFeature(requirement.first, requirement.second))
             {
-                // host doesn't provide this requirement
                 return false;
             }
-            else
-            {
-                // host provides this requirement, but does it provide an acceptible version?
-                const SemanticVersion providesVersion{featureVersion};
-                if (providesVersion < requirementVersion)
-                {
-                    // host's provided version is too low
-                    return false;
-                }
-            }
         }
 
         return true;
@@ -130,42 +217,33 @@ namespace AdaptiveSharedNamespace
     // Base implementation for elements that have no resource information
     void BaseElement::GetResourceInformation(std::vector<RemoteResourceInformation>& /*resourceInfo*/) { return; }
 
-    void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& json)
+    void BaseElement::AccumulateMemoryUsage(MemoryUsage& usage) const
     {
-        const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
-        if (!requiresValue.isNull())
+        usage.AddStringSet(m_knownProperties);
+        usage.AddJson(m_additionalProperties);
+        usage.AddString(m_id);
+        if (m_requires)
         {
-            if (requiresValue.isObject())
+            usage.AddObject(sizeof(*m_requires));
+            usage.AddHashTable(*m_requires);
+            for (const auto& requirement : *m_requires)
             {
-                const auto& memberNames = requiresValue.getMemberNames();
-                const auto countNames = memberNames.size();
-                for (unsigned int i = 0; i < countNames; ++i)
-                {
-                    const auto& memberName = memberNames.at(i);
-                    const auto& memberValue = requiresValue[memberName].asString();
-
-                    if (memberValue == "*")
-                    {
-                        // * means any version.
-                        m_requires->emplace(memberName, "0");
-                    }
-                    else
-                    {
-                        try
-                        {
-                            SemanticVersion memberVersion(memberValue);
-                            m_requires->emplace(memberName, memberVersion);
-                        }
-                        catch (const AdaptiveCardParseException&)
-                        {
-                            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                                             "Invalid version in requires value: '" + memberValue + "'");
-                        }
-                    }
-                }
-                return;
+                usage.AddString(requirement.first);
             }
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Invalid value for requires (should be object)");
         }
+        if (m_fallbackContent)
+        {
+            m_fallbackContent->AccumulateMemoryUsage(usage);
+        }
+    }
+
+    void BaseElement::ParseRequires(const Json::Value& json, BaseElement* element)
+    {
+        ForEachRequirement(json, [element](const std::string& name, SemanticVersion version) {
+            if (element)
+            {
+                element->m_requires->emplace(name, std::move(version));
+            }
+        });
     }
 }
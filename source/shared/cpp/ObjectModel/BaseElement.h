@@ -6,9 +6,12 @@
 #include "json/json.h"
 #include "FeatureRegistration.h"
 #include "ParseContext.h"
+#include "ParsePolicy.h"
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
 #include "RemoteResourceInformation.h"
+#include "MemoryUsage.h"
+#include "StringPool.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -47,10 +50,9 @@ namespace AdaptiveSharedNamespace
         BaseElement() :
             m_additionalProperties{}, m_typeString{},
             m_requires{std::make_shared<std::unordered_map<std::string, AdaptiveSharedNamespace::SemanticVersion>>()},
-            m_fallbackContent(nullptr), m_fallbackType(FallbackType::None), m_id{}, m_internalId{InternalId::Current()},
+            m_fallbackContent(nullptr), m_id{}, m_internalId{InternalId::Current()}, m_fallbackType(FallbackType::None),
             m_canFallbackToAncestor(false)
         {
-            PopulateKnownPropertiesSet();
         }
 
         BaseElement(const BaseElement&) = default;
@@ -60,19 +62,24 @@ namespace AdaptiveSharedNamespace
         virtual ~BaseElement() = default;
 
         // Element type and identity
-        std::string GetElementTypeString() const;
-        void SetElementTypeString(const std::string& value);
+        const std::string& GetElementTypeString() const;
+        // Custom type names are pooled, so that the elements of a custom type share their name
+        void SetElementTypeString(std::string value);
+        void SetElementTypeString(InternedString value);
         virtual std::string GetId() const;
         virtual void SetId(const std::string& value);
 
         const InternalId GetInternalId() const { return m_internalId; }
 
-        template<typename T> void DeserializeBase(ParseContext& context, const Json::Value& json);
+        // Walks the id, fallback and requires of an element with a ParsePolicy (see ParsePolicy.h). The fallback
+        // content is parsed as a TElementKind, BaseCardElement or BaseActionElement.
+        template<typename TElementKind, typename TPolicy>
+        static void ParseBase(const TPolicy& policy, ParseContext& context, const Json::Value& json);
 
         virtual std::string Serialize() const;
         virtual Json::Value SerializeToJsonValue() const;
         Json::Value GetAdditionalProperties() const;
-        void SetAdditionalProperties(const Json::Value& additionalProperties);
+        void SetAdditionalProperties(Json::Value additionalProperties);
 
         // Fallback and Requires support
         FallbackType GetFallbackType() const { return m_fallbackType; }
@@ -86,52 +93,67 @@ namespace AdaptiveSharedNamespace
 
         // Misc.
         virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris);
+        // Adds the memory the element owns to usage. Elements add their own object and what they own, then call their
+        // base class; the element object isn't counted unless the element type does so.
+        virtual void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
     protected:
+        // Parsing keeps the properties an element doesn't know as additional properties. An element knows the properties
+        // the schema describes for its type (see SchemaProperties.h) and those in m_knownProperties. Parsing calls this
+        // on the new element just before it collects the additional properties; a custom type, including the custom
+        // element and action types of the Android bindings, overrides it to add the properties it parses itself to
+        // m_knownProperties. The built-in types need nothing here.
         virtual void PopulateKnownPropertiesSet();
-        void SetTypeString(const std::string& type) { m_typeString = type; }
+        // Built-in type names are shared by every element of the type
+        void SetTypeString(CardElementType type);
+        void SetTypeString(ActionType type);
         void SetCanFallbackToAncestor(bool value) { m_canFallbackToAncestor = value; }
 
-        std::string m_typeString;
+        InternedString m_typeString;
         std::unordered_set<std::string> m_knownProperties;
         Json::Value m_additionalProperties;
 
     private:
-        template<typename T> void ParseFallback(ParseContext& context, const Json::Value& json);
-        void ParseRequires(ParseContext& context, const Json::Value& json);
+        template<typename TElementKind, typename TPolicy>
+        static void ParseFallback(const TPolicy& policy, ParseContext& context, const Json::Value& json);
+        // Adds the requirements to those of element, if it's given
+        static void ParseRequires(const Json::Value& json, BaseElement* element);
 
+        // Fields are ordered by alignment, with the flag last, where some ABIs place the fields of derived classes after
+        // it in the padding at the end of the element
         std::shared_ptr<std::unordered_map<std::string, AdaptiveSharedNamespace::SemanticVersion>> m_requires;
         std::shared_ptr<BaseElement> m_fallbackContent;
+        std::string m_id;
         InternalId m_internalId;
         FallbackType m_fallbackType;
         bool m_canFallbackToAncestor;
-        std::string m_id;
     };
 
-    template<typename T> void BaseElement::DeserializeBase(ParseContext& context, const Json::Value& json)
+    template<typename TElementKind, typename TPolicy>
+    void BaseElement::ParseBase(const TPolicy& policy, ParseContext& context, const Json::Value& json)
     {
         ParseUtil::ThrowIfNotJsonObject(json);
 
         // Order matters here -- we need to set the id property *prior* to parsing fallback so that we can detect id
         // collisions.
-        SetId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id));
-        ParseFallback<T>(context, json);
-        ParseRequires(context, json);
+        policy.String(json, AdaptiveCardSchemaKey::Id, &BaseElement::m_id);
+        ParseFallback<TElementKind>(policy, context, json);
+        ParseRequires(json, policy.Object());
     }
 
-    template<typename T> void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
+    template<typename TElementKind, typename TPolicy>
+    void BaseElement::ParseFallback(const TPolicy& policy, ParseContext& context, const Json::Value& json)
     {
-        const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+        const auto& fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
         if (!fallbackValue.empty())
         {
             // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
             // element.
             if (fallbackValue.isString())
             {
-                auto fallbackStringValue = ParseUtil::ToLowercase(fallbackValue.asString());
-                if (fallbackStringValue == "drop")
+                if (ParseUtil::ToLowercase(fallbackValue.asString()) == "drop")
                 {
-                    m_fallbackType = FallbackType::Drop;
+                    policy.Set(&BaseElement::m_fallbackType, FallbackType::Drop);
                     return;
                 }
                 throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
@@ -140,16 +162,20 @@ namespace AdaptiveSharedNamespace
             else if (fallbackValue.isObject())
             {
                 // fallback value is a JSON object. parse it and add it as fallback content. For more details, refer to
-                // the giant comment on ID collision detection in ParseContext.cpp.
-                context.PushElement(GetId(), GetInternalId(), true /*isFallback*/);
+                // the giant comment on ID collision detection in ParseContext.cpp. An element being validated has the
+                // current internal id, as it would have had if it had been built.
+                const BaseElement* element = policy.Object();
+                context.PushElement(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id),
+                                    element ? element->GetInternalId() : InternalId::Current(),
+                                    true /*isFallback*/);
                 std::shared_ptr<BaseElement> fallbackElement;
-                T::ParseJsonObject(context, fallbackValue, fallbackElement);
+                const bool isElement = policy.template Element<TElementKind>(context, fallbackValue, fallbackElement);
                 context.PopElement();
 
-                if (fallbackElement)
+                if (isElement)
                 {
-                    m_fallbackType = FallbackType::Content;
-                    m_fallbackContent = fallbackElement;
+                    policy.Set(&BaseElement::m_fallbackType, FallbackType::Content);
+                    policy.Set(&BaseElement::m_fallbackContent, std::move(fallbackElement));
                     return;
                 }
                 throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Fallback content did not parse correctly.");
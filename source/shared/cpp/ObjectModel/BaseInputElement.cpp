@@ -8,13 +8,11 @@ using namespace AdaptiveSharedNamespace;
 
 BaseInputElement::BaseInputElement(CardElementType elementType) : BaseCardElement(elementType), m_isRequired(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 BaseInputElement::BaseInputElement(CardElementType elementType, Spacing spacing, bool separator, HeightType height) :
     BaseCardElement(elementType, spacing, separator, height), m_isRequired(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 bool BaseInputElement::GetIsRequired() const
@@ -27,14 +25,14 @@ void BaseInputElement::SetIsRequired(const bool value)
     m_isRequired = value;
 }
 
-std::string BaseInputElement::GetErrorMessage() const
+const std::string& BaseInputElement::GetErrorMessage() const
 {
     return m_errorMessage;
 }
 
-void BaseInputElement::SetErrorMessage(const std::string errorMessage)
+void BaseInputElement::SetErrorMessage(std::string errorMessage)
 {
-    m_errorMessage = errorMessage;
+    m_errorMessage = std::move(errorMessage);
 }
 
 Json::Value BaseInputElement::SerializeToJsonValue() const
@@ -54,8 +52,8 @@ Json::Value BaseInputElement::SerializeToJsonValue() const
     return root;
 }
 
-void BaseInputElement::PopulateKnownPropertiesSet()
+void BaseInputElement::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsRequired),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ErrorMessage)});
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_errorMessage);
 }
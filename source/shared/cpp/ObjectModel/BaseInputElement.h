@@ -15,17 +15,20 @@ namespace AdaptiveSharedNamespace
         BaseInputElement(CardElementType type, Spacing spacing, bool separator, HeightType height);
 
         template<typename T> static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
+        // Walks the properties every input has with a ParsePolicy, for the parsers of the input types
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
 
         bool GetIsRequired() const;
         void SetIsRequired(const bool isRequired);
 
-        std::string GetErrorMessage() const;
-        void SetErrorMessage(const std::string errorMessage);
+        const std::string& GetErrorMessage() const;
+        void SetErrorMessage(std::string errorMessage);
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet();
         bool m_isRequired;
         std::string m_errorMessage;
     };
@@ -33,14 +36,18 @@ namespace AdaptiveSharedNamespace
     template<typename T>
     std::shared_ptr<T> BaseInputElement::Deserialize(ParseContext& context, const Json::Value& json)
     {
-        std::shared_ptr<T> baseInputElement = BaseCardElement::Deserialize<T>(context, json);
-
-        ParseUtil::ThrowIfNotJsonObject(json);
+        std::shared_ptr<T> baseInputElement = std::make_shared<T>();
+        ParseProperties(BuildPolicy<BaseInputElement>(*baseInputElement), context, json);
+        return baseInputElement;
+    }
 
-        baseInputElement->SetId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Id, true));
-        baseInputElement->SetIsRequired(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsRequired, false));
-        baseInputElement->SetErrorMessage(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ErrorMessage));
+    template<typename TPolicy>
+    void BaseInputElement::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+    {
+        BaseCardElement::ParseProperties(policy, context, json);
 
-        return baseInputElement;
+        policy.String(json, AdaptiveCardSchemaKey::Id, &BaseInputElement::SetId, true);
+        policy.Bool(json, AdaptiveCardSchemaKey::IsRequired, false, &BaseInputElement::SetIsRequired);
+        policy.String(json, AdaptiveCardSchemaKey::ErrorMessage, &BaseInputElement::SetErrorMessage);
     }
 }
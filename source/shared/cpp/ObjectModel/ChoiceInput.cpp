@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "ChoiceInput.h"
 #include "ParseContext.h"
+#include "ParsePolicy.h"
 #include "ParseUtil.h"
 
 using namespace AdaptiveSharedNamespace;
@@ -11,12 +12,16 @@ ChoiceInput::ChoiceInput()
 {
 }
 
+template<typename TPolicy> void ChoiceInput::ParseProperties(const TPolicy& policy, const Json::Value& json)
+{
+    policy.String(json, AdaptiveCardSchemaKey::Title, &ChoiceInput::SetTitle, true);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &ChoiceInput::SetValue, true);
+}
+
 std::shared_ptr<ChoiceInput> ChoiceInput::Deserialize(ParseContext& /*context*/, const Json::Value& json)
 {
     auto choice = std::make_shared<ChoiceInput>();
-
-    choice->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true));
-    choice->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, true));
+    ParseProperties(BuildPolicy<ChoiceInput>(*choice), json);
 
     return choice;
 }
@@ -26,6 +31,11 @@ std::shared_ptr<ChoiceInput> ChoiceInput::DeserializeFromString(ParseContext& co
     return ChoiceInput::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
+void ChoiceInput::Validate(ParseContext& /*context*/, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<ChoiceInput>(), json);
+}
+
 std::string ChoiceInput::Serialize()
 {
     return ParseUtil::JsonToString(SerializeToJsonValue());
@@ -41,22 +51,29 @@ Json::Value ChoiceInput::SerializeToJsonValue()
     return root;
 }
 
-std::string ChoiceInput::GetTitle() const
+const std::string& ChoiceInput::GetTitle() const
 {
     return m_title;
 }
 
-void ChoiceInput::SetTitle(const std::string& title)
+void ChoiceInput::SetTitle(std::string title)
 {
-    m_title = title;
+    m_title = std::move(title);
 }
 
-std::string ChoiceInput::GetValue() const
+const std::string& ChoiceInput::GetValue() const
 {
     return m_value;
 }
 
-void ChoiceInput::SetValue(const std::string& value)
+void ChoiceInput::SetValue(std::string value)
+{
+    m_value = std::move(value);
+}
+
+void ChoiceInput::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    m_value = value;
+    usage.AddObject(sizeof(ChoiceInput));
+    usage.AddString(m_title);
+    usage.AddString(m_value);
 }
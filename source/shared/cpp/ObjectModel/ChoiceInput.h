@@ -4,6 +4,7 @@
 
 #include "pch.h"
 #include "ParseContext.h"
+#include "MemoryUsage.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -14,17 +15,21 @@ namespace AdaptiveSharedNamespace
 
         std::string Serialize();
         Json::Value SerializeToJsonValue();
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
-        std::string GetTitle() const;
-        void SetTitle(const std::string& value);
+        const std::string& GetTitle() const;
+        void SetTitle(std::string value);
 
-        std::string GetValue() const;
-        void SetValue(const std::string& value);
+        const std::string& GetValue() const;
+        void SetValue(std::string value);
 
         static std::shared_ptr<ChoiceInput> Deserialize(ParseContext&, const Json::Value& root);
         static std::shared_ptr<ChoiceInput> DeserializeFromString(ParseContext&, const std::string& jsonString);
+        static void Validate(ParseContext&, const Json::Value& root);
 
     private:
+        template<typename TPolicy> static void ParseProperties(const TPolicy& policy, const Json::Value& json);
+
         std::string m_title;
         std::string m_value;
     };
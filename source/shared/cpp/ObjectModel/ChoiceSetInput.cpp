@@ -12,7 +12,6 @@ ChoiceSetInput::ChoiceSetInput() :
     BaseInputElement(CardElementType::ChoiceSetInput), m_wrap(false), m_isMultiSelect(false),
     m_choiceSetStyle(ChoiceSetStyle::Compact)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<ChoiceInput>>& ChoiceSetInput::GetChoices() const
@@ -76,14 +75,14 @@ void ChoiceSetInput::SetChoiceSetStyle(const ChoiceSetStyle choiceSetStyle)
     m_choiceSetStyle = choiceSetStyle;
 }
 
-std::string ChoiceSetInput::GetValue() const
+const std::string& ChoiceSetInput::GetValue() const
 {
     return m_value;
 }
 
-void ChoiceSetInput::SetValue(std::string const& value)
+void ChoiceSetInput::SetValue(std::string value)
 {
-    m_value = value;
+    m_value = std::move(value);
 }
 
 bool ChoiceSetInput::GetWrap() const
@@ -96,21 +95,38 @@ void ChoiceSetInput::SetWrap(bool value)
     m_wrap = value;
 }
 
-std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+void ChoiceSetInput::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(ChoiceSetInput));
+    BaseInputElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_value);
+    usage.AddObjects(m_choices);
+}
+
+template<typename TPolicy>
+void ChoiceSetInputParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::ChoiceSetInput);
 
-    auto choiceSet = BaseInputElement::Deserialize<ChoiceSetInput>(context, json);
+    BaseInputElement::ParseProperties(policy, context, json);
 
-    choiceSet->SetChoiceSetStyle(
-        ParseUtil::GetEnumValue<ChoiceSetStyle>(json, AdaptiveCardSchemaKey::Style, ChoiceSetStyle::Compact, ChoiceSetStyleFromString));
-    choiceSet->SetIsMultiSelect(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiSelect, false));
-    choiceSet->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, false));
-    choiceSet->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false, false));
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::Style,
+                ChoiceSetStyle::Compact,
+                ChoiceSetStyleFromString,
+                &ChoiceSetInput::SetChoiceSetStyle);
+    policy.Bool(json, AdaptiveCardSchemaKey::IsMultiSelect, false, &ChoiceSetInput::SetIsMultiSelect);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &ChoiceSetInput::SetValue, false);
+    policy.Bool(json, AdaptiveCardSchemaKey::Wrap, false, &ChoiceSetInput::SetWrap, false);
 
     // Parse Choices
-    auto choices = ParseUtil::GetElementCollectionOfSingleType<ChoiceInput>(context, json, AdaptiveCardSchemaKey::Choices, ChoiceInput::Deserialize, true);
-    choiceSet->m_choices = std::move(choices);
+    policy.template Items<ChoiceInput>(context, json, AdaptiveCardSchemaKey::Choices, &ChoiceSetInput::m_choices, true);
+}
+
+std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto choiceSet = std::make_shared<ChoiceSetInput>();
+    ParseProperties(BuildPolicy<ChoiceSetInput>(*choiceSet), context, json);
 
     return choiceSet;
 }
@@ -121,11 +137,9 @@ ChoiceSetInputParser::DeserializeFromString(ParseContext& context, const std::st
     return ChoiceSetInputParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ChoiceSetInput::PopulateKnownPropertiesSet()
+bool ChoiceSetInputParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    ParseProperties(ValidatePolicy<ChoiceSetInput>(), context, json);
+
+    return true;
 }
@@ -22,6 +22,7 @@ namespace AdaptiveSharedNamespace
         ~ChoiceSetInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
         bool GetIsMultiSelect() const;
         void SetIsMultiSelect(const bool isMultiSelect);
@@ -32,15 +33,13 @@ namespace AdaptiveSharedNamespace
         std::vector<std::shared_ptr<ChoiceInput>>& GetChoices();
         const std::vector<std::shared_ptr<ChoiceInput>>& GetChoices() const;
 
-        std::string GetValue() const;
-        void SetValue(const std::string& value);
+        const std::string& GetValue() const;
+        void SetValue(std::string value);
 
         bool GetWrap() const;
         void SetWrap(bool value);
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         bool m_wrap;
         bool m_isMultiSelect;
         std::string m_value;
@@ -61,5 +60,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
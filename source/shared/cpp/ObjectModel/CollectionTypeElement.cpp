@@ -6,9 +6,16 @@
 
 using namespace AdaptiveSharedNamespace;
 
+static_assert(sizeof(CollectionTypeElement) <=
+                  UnpaddedSize(sizeof(BaseCardElement) + 2 * sizeof(std::shared_ptr<BaseElement>) + sizeof(ContainerStyle) +
+                                   sizeof(VerticalContentAlignment) + sizeof(ContainerBleedDirection) +
+                                   sizeof(unsigned int) + sizeof(InternalId) + 2 * sizeof(bool),
+                               alignof(CollectionTypeElement)),
+              "CollectionTypeElement is larger than its fields, keep them ordered by alignment");
+
 CollectionTypeElement::CollectionTypeElement(CardElementType type, ContainerStyle style, VerticalContentAlignment alignment) :
-    BaseCardElement(type), m_style(style), m_verticalContentAlignment(alignment), m_hasPadding(false),
-    m_hasBleed(false), m_parentalId(), m_bleedDirection(ContainerBleedDirection::BleedAll), m_minHeight(0)
+    BaseCardElement(type), m_style(style), m_verticalContentAlignment(alignment),
+    m_bleedDirection(ContainerBleedDirection::BleedAll), m_minHeight(0), m_parentalId(), m_hasPadding(false), m_hasBleed(false)
 {
 }
 
@@ -163,3 +170,16 @@ Json::Value CollectionTypeElement::SerializeToJsonValue() const
 
     return root;
 }
+
+void CollectionTypeElement::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    if (m_backgroundImage)
+    {
+        m_backgroundImage->AccumulateMemoryUsage(usage);
+    }
+    if (m_selectAction)
+    {
+        m_selectAction->AccumulateMemoryUsage(usage);
+    }
+}
@@ -62,11 +62,16 @@ namespace AdaptiveSharedNamespace
         template<typename T>
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo,
                                     const std::vector<std::shared_ptr<T>>& elements);
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
         virtual void DeserializeChildren(AdaptiveCards::ParseContext& context, const Json::Value& value) = 0;
 
         Json::Value SerializeToJsonValue() const override;
         template<typename T> static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& value);
+        // Walks the properties every collection has with a ParsePolicy, for the parsers of the collection types. The
+        // children are walked by the static T::ParseChildren, with the same policy.
+        template<typename T, typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& value);
 
     private:
         // Applies padding flag When appropriate
@@ -75,62 +80,78 @@ namespace AdaptiveSharedNamespace
         void ConfigBleed(const AdaptiveCards::ParseContext& context);
         void SetBleedDirection(const ContainerBleedDirection bleedDirection) { m_bleedDirection = bleedDirection; }
 
+        std::shared_ptr<BackgroundImage> m_backgroundImage;
+        std::shared_ptr<BaseActionElement> m_selectAction;
+
         ContainerStyle m_style;
         VerticalContentAlignment m_verticalContentAlignment;
         ContainerBleedDirection m_bleedDirection;
-
         unsigned int m_minHeight;
-        bool m_hasPadding;
-        bool m_hasBleed;
         // id refers to parent to where bleed property should target
         AdaptiveSharedNamespace::InternalId m_parentalId;
-
-        std::shared_ptr<BackgroundImage> m_backgroundImage;
-        std::shared_ptr<BaseActionElement> m_selectAction;
+        bool m_hasPadding;
+        bool m_hasBleed;
     };
 
     template<typename T>
     std::shared_ptr<T> CollectionTypeElement::Deserialize(ParseContext& context, const Json::Value& value)
     {
-        auto collection = BaseCardElement::Deserialize<T>(context, value);
-
-        auto backgroundImage = ParseUtil::GetBackgroundImage(value);
-        collection->SetBackgroundImage(backgroundImage);
-
-        bool canFallbackToAncestor = context.GetCanFallbackToAncestor();
-        context.SetCanFallbackToAncestor(canFallbackToAncestor || (collection->GetFallbackType() != FallbackType::None));
-        collection->SetCanFallbackToAncestor(canFallbackToAncestor);
-
-        collection->SetStyle(
-            ParseUtil::GetEnumValue<ContainerStyle>(value, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString));
-
-        collection->SetVerticalContentAlignment(ParseUtil::GetEnumValue<VerticalContentAlignment>(
-            value, AdaptiveCardSchemaKey::VerticalContentAlignment, VerticalContentAlignment::Top, VerticalContentAlignmentFromString));
-
-        collection->SetBleed(ParseUtil::GetBool(value, AdaptiveCardSchemaKey::Bleed, false));
-
-        collection->SetMinHeight(
-            ParseSizeForPixelSize(ParseUtil::GetString(value, AdaptiveCardSchemaKey::MinHeight), &context.warnings));
+        std::shared_ptr<T> collection = std::make_shared<T>();
+        ParseProperties<T>(BuildPolicy<T>(*collection), context, value);
+        return collection;
+    }
 
-        // configures for cotainer style
-        collection->ConfigForContainerStyle(context);
+    template<typename T, typename TPolicy>
+    void CollectionTypeElement::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& value)
+    {
+        BaseCardElement::ParseProperties(policy, context, value);
+
+        policy.BackgroundImage(value, &CollectionTypeElement::SetBackgroundImage);
+
+        // The fallback has been checked, so the collection has one if the property is there
+        const bool canFallbackToAncestor = context.GetCanFallbackToAncestor();
+        const auto& fallbackValue = ParseUtil::ExtractJsonValue(value, AdaptiveCardSchemaKey::Fallback, false);
+        context.SetCanFallbackToAncestor(canFallbackToAncestor || !fallbackValue.empty());
+        policy.Set(&CollectionTypeElement::SetCanFallbackToAncestor, canFallbackToAncestor);
+
+        policy.Enum(value,
+                    AdaptiveCardSchemaKey::Style,
+                    ContainerStyle::None,
+                    ContainerStyleFromString,
+                    &CollectionTypeElement::SetStyle);
+        policy.Enum(value,
+                    AdaptiveCardSchemaKey::VerticalContentAlignment,
+                    VerticalContentAlignment::Top,
+                    VerticalContentAlignmentFromString,
+                    &CollectionTypeElement::SetVerticalContentAlignment);
+        policy.Bool(value, AdaptiveCardSchemaKey::Bleed, false, &CollectionTypeElement::SetBleed);
+        policy.Set(&CollectionTypeElement::SetMinHeight,
+                   ParseSizeForPixelSize(ParseUtil::GetString(value, AdaptiveCardSchemaKey::MinHeight), context));
+
+        CollectionTypeElement* collection = policy.Object();
+        if (collection)
+        {
+            // configures for cotainer style
+            collection->ConfigForContainerStyle(context);
 
-        // we walk parse tree dfs, so we need to save current style,
-        // before we walk back up to a parent.
-        context.SaveContextForCollectionTypeElement(*collection);
+            // we walk parse tree dfs, so we need to save current style,
+            // before we walk back up to a parent.
+            context.SaveContextForCollectionTypeElement(*collection);
+        }
 
         // Parse Items
-        collection->DeserializeChildren(context, value);
+        T::ParseChildren(policy, context, value);
 
-        // since we are walking dfs, we have to restore the style before we back up
-        context.RestoreContextForCollectionTypeElement(*collection);
+        if (collection)
+        {
+            // since we are walking dfs, we have to restore the style before we back up
+            context.RestoreContextForCollectionTypeElement(*collection);
+        }
 
         context.SetCanFallbackToAncestor(canFallbackToAncestor);
 
         // Parse optional selectAction
-        collection->SetSelectAction(ParseUtil::GetAction(context, value, AdaptiveCardSchemaKey::SelectAction, false));
-
-        return collection;
+        policy.Action(context, value, AdaptiveCardSchemaKey::SelectAction, &CollectionTypeElement::SetSelectAction);
     }
 
     template<typename T>
@@ -10,10 +10,9 @@ using namespace AdaptiveSharedNamespace;
 
 Column::Column() : CollectionTypeElement(CardElementType::Column), m_width("Auto"), m_pixelWidth(0)
 {
-    PopulateKnownPropertiesSet();
 }
 
-std::string Column::GetWidth() const
+const std::string& Column::GetWidth() const
 {
     return m_width;
 }
@@ -30,6 +29,12 @@ void Column::SetWidth(const std::string& value,
     m_pixelWidth = ParseSizeForPixelSize(m_width, warnings);
 }
 
+void Column::SetWidth(const std::string& value, ParseContext& context)
+{
+    m_width = ParseUtil::ToLowercase(value);
+    m_pixelWidth = ParseSizeForPixelSize(m_width, context);
+}
+
 // explicit width takes precedence over relative width
 int Column::GetPixelWidth() const
 {
@@ -78,15 +83,6 @@ Json::Value Column::SerializeToJsonValue() const
     return root;
 }
 
-void Column::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment)});
-}
-
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
     auto columnItems = GetItems();
@@ -94,43 +90,63 @@ void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& reso
     return;
 }
 
-void Column::DeserializeChildren(ParseContext& context, const Json::Value& value)
+template<typename TPolicy>
+void Column::ParseChildren(const TPolicy& policy, ParseContext& context, const Json::Value& value)
 {
     // Parse Items
-    auto cardElements = ParseUtil::GetElementCollection<BaseCardElement>(true, // isTopToBottomContainer
-                                                                         context,
-                                                                         value,
-                                                                         AdaptiveCardSchemaKey::Items,
-                                                                         false); // isRequired
-    m_items = std::move(cardElements);
+    policy.template Elements<BaseCardElement>(true, // isTopToBottomContainer
+                                              context,
+                                              value,
+                                              AdaptiveCardSchemaKey::Items,
+                                              &Column::m_items,
+                                              false); // isRequired
 }
 
-std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context, const Json::Value& value)
+void Column::DeserializeChildren(ParseContext& context, const Json::Value& value)
 {
-    auto column = CollectionTypeElement::Deserialize<Column>(context, value);
+    ParseChildren(BuildPolicy<Column>(*this), context, value);
+}
 
-    auto fallbackElement = column->GetFallbackContent();
-    if (fallbackElement)
+void Column::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(Column));
+    CollectionTypeElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_width);
+    usage.AddObjects(m_items);
+}
+
+template<typename TPolicy>
+void ColumnParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    CollectionTypeElement::ParseProperties<Column>(policy, context, json);
+
+    const auto& fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+    if (fallbackValue.isObject() &&
+        CardElementTypeFromString(ParseUtil::GetTypeAsString(fallbackValue)) != CardElementType::Column)
     {
-        if (CardElementTypeFromString(fallbackElement->GetElementTypeString()) != CardElementType::Column)
-        {
-            context.warnings.emplace_back(
-                std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::UnknownElementType,
-                                                           "Column Fallback must be a Column. Fallback content dropped."));
-
-            column->SetFallbackContent(nullptr);
-            column->SetFallbackType(FallbackType::None);
-        }
+        context.AddWarning(WarningStatusCode::UnknownElementType,
+                           "Column Fallback must be a Column. Fallback content dropped.");
+
+        policy.Set(&Column::SetFallbackContent, nullptr);
+        policy.Set(&Column::SetFallbackType, FallbackType::None);
     }
 
-    std::string columnWidth = ParseUtil::GetValueAsString(value, AdaptiveCardSchemaKey::Width);
+    std::string columnWidth = ParseUtil::GetValueAsString(json, AdaptiveCardSchemaKey::Width);
     if (columnWidth == "")
     {
         // Look in "size" for back-compat with pre V1.0 cards
-        columnWidth = ParseUtil::GetValueAsString(value, AdaptiveCardSchemaKey::Size);
+        columnWidth = ParseUtil::GetValueAsString(json, AdaptiveCardSchemaKey::Size);
     }
 
-    column->SetWidth(ParseUtil::ToLowercase(columnWidth), &context.warnings);
+    std::string width = ParseUtil::ToLowercase(columnWidth);
+    policy.Set(&Column::m_pixelWidth, ParseSizeForPixelSize(width, context));
+    policy.Set(&Column::m_width, std::move(width));
+}
+
+std::shared_ptr<BaseCardElement> ColumnParser::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    auto column = std::make_shared<Column>();
+    ParseProperties(BuildPolicy<Column>(*column), context, value);
 
     return column;
 }
@@ -139,3 +155,10 @@ std::shared_ptr<BaseCardElement> ColumnParser::DeserializeFromString(ParseContex
 {
     return ColumnParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+bool ColumnParser::Validate(ParseContext& context, const Json::Value& value)
+{
+    ParseProperties(ValidatePolicy<Column>(), context, value);
+
+    return true;
+}
@@ -14,6 +14,8 @@ namespace AdaptiveSharedNamespace
 
     class Column : public CollectionTypeElement
     {
+        friend class ColumnParser;
+
     public:
         Column();
 
@@ -21,11 +23,15 @@ namespace AdaptiveSharedNamespace
         Json::Value SerializeToJsonValue() const override;
 
         void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
+        // Walks the children with a ParsePolicy, for CollectionTypeElement::ParseProperties
+        template<typename TPolicy>
+        static void ParseChildren(const TPolicy& policy, ParseContext& context, const Json::Value& value);
 
-        std::string GetWidth() const;
+        const std::string& GetWidth() const;
         void SetWidth(const std::string& value);
         void SetWidth(const std::string& value,
                       std::vector<std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCardParseWarning>>* warnings);
+        void SetWidth(const std::string& value, ParseContext& context);
 
         // explicit width takes precedence over relative width
         int GetPixelWidth() const;
@@ -35,9 +41,9 @@ namespace AdaptiveSharedNamespace
         const std::vector<std::shared_ptr<BaseCardElement>>& GetItems() const;
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
         std::string m_width;
         unsigned int m_pixelWidth;
         std::vector<std::shared_ptr<AdaptiveSharedNamespace::BaseCardElement>> m_items;
@@ -55,5 +61,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -12,7 +12,6 @@ using namespace AdaptiveSharedNamespace;
 
 ColumnSet::ColumnSet() : CollectionTypeElement(CardElementType::ColumnSet)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns() const
@@ -39,22 +38,21 @@ Json::Value ColumnSet::SerializeToJsonValue() const
     return root;
 }
 
-void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& value)
+template<typename TPolicy>
+void ColumnSet::ParseChildren(const TPolicy& policy, ParseContext& context, const Json::Value& value)
 {
-    m_columns = ParseUtil::GetElementCollection<Column>(false, // isTopToBottomContainer
-                                                        context,
-                                                        value,
-                                                        AdaptiveCardSchemaKey::Columns,
-                                                        false,     // isRequired
-                                                        CardElementTypeToString(CardElementType::Column)); // impliedType
+    policy.template Elements<Column>(false, // isTopToBottomContainer
+                                     context,
+                                     value,
+                                     AdaptiveCardSchemaKey::Columns,
+                                     &ColumnSet::m_columns,
+                                     false,     // isRequired
+                                     CardElementTypeToString(CardElementType::Column)); // impliedType
 }
 
-void ColumnSet::PopulateKnownPropertiesSet()
+void ColumnSet::DeserializeChildren(ParseContext& context, const Json::Value& value)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
+    ParseChildren(BuildPolicy<ColumnSet>(*this), context, value);
 }
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
@@ -64,11 +62,25 @@ void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& r
     return;
 }
 
-std::shared_ptr<BaseCardElement> ColumnSetParser::Deserialize(ParseContext& context, const Json::Value& value)
+void ColumnSet::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    ParseUtil::ExpectTypeString(value, CardElementType::ColumnSet);
+    usage.AddObject(sizeof(ColumnSet));
+    CollectionTypeElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_columns);
+}
+
+template<typename TPolicy>
+void ColumnSetParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    ParseUtil::ExpectTypeString(json, CardElementType::ColumnSet);
+
+    CollectionTypeElement::ParseProperties<ColumnSet>(policy, context, json);
+}
 
-    auto container = CollectionTypeElement::Deserialize<ColumnSet>(context, value);
+std::shared_ptr<BaseCardElement> ColumnSetParser::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    auto container = std::make_shared<ColumnSet>();
+    ParseProperties(BuildPolicy<ColumnSet>(*container), context, value);
 
     return container;
 }
@@ -77,3 +89,10 @@ std::shared_ptr<BaseCardElement> ColumnSetParser::DeserializeFromString(ParseCon
 {
     return ColumnSetParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+bool ColumnSetParser::Validate(ParseContext& context, const Json::Value& value)
+{
+    ParseProperties(ValidatePolicy<ColumnSet>(), context, value);
+
+    return true;
+}
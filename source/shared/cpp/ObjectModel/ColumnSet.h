@@ -23,15 +23,17 @@ namespace AdaptiveSharedNamespace
 
         Json::Value SerializeToJsonValue() const override;
         void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
+        // Walks the children with a ParsePolicy, for CollectionTypeElement::ParseProperties
+        template<typename TPolicy>
+        static void ParseChildren(const TPolicy& policy, ParseContext& context, const Json::Value& value);
 
         std::vector<std::shared_ptr<Column>>& GetColumns();
         const std::vector<std::shared_ptr<Column>>& GetColumns() const;
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::vector<std::shared_ptr<Column>> m_columns;
     };
 
@@ -47,5 +49,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -11,7 +11,6 @@ using namespace AdaptiveSharedNamespace;
 
 Container::Container() : CollectionTypeElement(CardElementType::Container)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<BaseCardElement>>& Container::GetItems() const
@@ -37,24 +36,44 @@ Json::Value Container::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<BaseCardElement> ContainerParser::Deserialize(ParseContext& context, const Json::Value& value)
+void Container::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(Container));
+    CollectionTypeElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_items);
+}
+
+template<typename TPolicy>
+void Container::ParseChildren(const TPolicy& policy, ParseContext& context, const Json::Value& value)
+{
+    // Parse items
+    policy.template Elements<BaseCardElement>(true, // isTopToBottomContainer
+                                              context,
+                                              value,
+                                              AdaptiveCardSchemaKey::Items,
+                                              &Container::m_items,
+                                              false); // isRequired
+}
+
+template<typename TPolicy>
+void ContainerParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
-    ParseUtil::ExpectTypeString(value, CardElementType::Container);
+    ParseUtil::ExpectTypeString(json, CardElementType::Container);
 
-    auto container = CollectionTypeElement::Deserialize<Container>(context, value);
+    CollectionTypeElement::ParseProperties<Container>(policy, context, json);
+}
+
+std::shared_ptr<BaseCardElement> ContainerParser::Deserialize(ParseContext& context, const Json::Value& value)
+{
+    auto container = std::make_shared<Container>();
+    ParseProperties(BuildPolicy<Container>(*container), context, value);
 
     return container;
 }
 
 void Container::DeserializeChildren(ParseContext& context, const Json::Value& value)
 {
-    // Parse items
-    auto cardElements = ParseUtil::GetElementCollection<BaseCardElement>(true, // isTopToBottomContainer
-                                                                         context,
-                                                                         value,
-                                                                         AdaptiveCardSchemaKey::Items,
-                                                                         false); // isRequired
-    m_items = std::move(cardElements);
+    ParseChildren(BuildPolicy<Container>(*this), context, value);
 }
 
 std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseContext& context, const std::string& jsonString)
@@ -62,13 +81,11 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
     return ContainerParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void Container::PopulateKnownPropertiesSet()
+bool ContainerParser::Validate(ParseContext& context, const Json::Value& value)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Bleed),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items)});
+    ParseProperties(ValidatePolicy<Container>(), context, value);
+
+    return true;
 }
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
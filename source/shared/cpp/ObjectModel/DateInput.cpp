@@ -9,7 +9,6 @@ using namespace AdaptiveSharedNamespace;
 
 DateInput::DateInput() : BaseInputElement(CardElementType::DateInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value DateInput::SerializeToJsonValue() const
@@ -39,56 +38,73 @@ Json::Value DateInput::SerializeToJsonValue() const
     return root;
 }
 
-std::string DateInput::GetMax() const
+const std::string& DateInput::GetMax() const
 {
     return m_max;
 }
 
-void DateInput::SetMax(const std::string& value)
+void DateInput::SetMax(std::string value)
 {
-    m_max = value;
+    m_max = std::move(value);
 }
 
-std::string DateInput::GetMin() const
+const std::string& DateInput::GetMin() const
 {
     return m_min;
 }
 
-void DateInput::SetMin(const std::string& value)
+void DateInput::SetMin(std::string value)
 {
-    m_min = value;
+    m_min = std::move(value);
 }
 
-std::string DateInput::GetPlaceholder() const
+const std::string& DateInput::GetPlaceholder() const
 {
     return m_placeholder;
 }
 
-void DateInput::SetPlaceholder(const std::string& value)
+void DateInput::SetPlaceholder(std::string value)
 {
-    m_placeholder = value;
+    m_placeholder = std::move(value);
 }
 
-std::string DateInput::GetValue() const
+const std::string& DateInput::GetValue() const
 {
     return m_value;
 }
 
-void DateInput::SetValue(const std::string& value)
+void DateInput::SetValue(std::string value)
 {
-    m_value = value;
+    m_value = std::move(value);
 }
 
-std::shared_ptr<BaseCardElement> DateInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+void DateInput::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(DateInput));
+    BaseInputElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_max);
+    usage.AddString(m_min);
+    usage.AddString(m_placeholder);
+    usage.AddString(m_value);
+}
+
+template<typename TPolicy>
+void DateInputParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::DateInput);
 
-    std::shared_ptr<DateInput> dateInput = BaseInputElement::Deserialize<DateInput>(context, json);
+    BaseInputElement::ParseProperties(policy, context, json);
 
-    dateInput->SetMax(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Max));
-    dateInput->SetMin(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Min));
-    dateInput->SetPlaceholder(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Placeholder));
-    dateInput->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value));
+    policy.String(json, AdaptiveCardSchemaKey::Max, &DateInput::SetMax);
+    policy.String(json, AdaptiveCardSchemaKey::Min, &DateInput::SetMin);
+    policy.String(json, AdaptiveCardSchemaKey::Placeholder, &DateInput::SetPlaceholder);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &DateInput::SetValue);
+}
+
+std::shared_ptr<BaseCardElement> DateInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto dateInput = std::make_shared<DateInput>();
+    ParseProperties(BuildPolicy<DateInput>(*dateInput), context, json);
 
     return dateInput;
 }
@@ -98,10 +114,9 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
     return DateInputParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void DateInput::PopulateKnownPropertiesSet()
+bool DateInputParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
+    ParseProperties(ValidatePolicy<DateInput>(), context, json);
+
+    return true;
 }
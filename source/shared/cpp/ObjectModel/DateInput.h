@@ -18,22 +18,21 @@ namespace AdaptiveSharedNamespace
         ~DateInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
-        std::string GetMax() const;
-        void SetMax(const std::string& value);
+        const std::string& GetMax() const;
+        void SetMax(std::string value);
 
-        std::string GetMin() const;
-        void SetMin(const std::string& value);
+        const std::string& GetMin() const;
+        void SetMin(std::string value);
 
-        std::string GetPlaceholder() const;
-        void SetPlaceholder(const std::string& value);
+        const std::string& GetPlaceholder() const;
+        void SetPlaceholder(std::string value);
 
-        std::string GetValue() const;
-        void SetValue(const std::string& value);
+        const std::string& GetValue() const;
+        void SetValue(std::string value);
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::string m_max;
         std::string m_min;
         std::string m_placeholder;
@@ -52,5 +51,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
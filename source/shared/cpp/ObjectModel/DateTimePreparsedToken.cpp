@@ -20,7 +20,7 @@ DateTimePreparsedToken::DateTimePreparsedToken(std::string const& text, struct t
 {
 }
 
-std::string DateTimePreparsedToken::GetText() const
+const std::string& DateTimePreparsedToken::GetText() const
 {
     return m_text;
 }
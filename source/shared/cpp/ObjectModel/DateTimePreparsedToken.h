@@ -12,7 +12,7 @@ namespace AdaptiveSharedNamespace
         DateTimePreparsedToken(std::string const& text, DateTimePreparsedTokenFormat format);
         DateTimePreparsedToken(std::string const& text, struct tm date, DateTimePreparsedTokenFormat format);
 
-        std::string GetText() const;
+        const std::string& GetText() const;
         DateTimePreparsedTokenFormat GetFormat() const;
         // returns values 1-31
         int GetDay() const;
@@ -13,6 +13,8 @@
 #include "BaseCardElement.h"
 #include "ElementParserRegistration.h"
 #include "DateTimePreparser.h"
+#include "ParseObserver.h"
+#include <cstring>
 #include <iomanip>
 
 using namespace AdaptiveSharedNamespace;
@@ -21,14 +23,34 @@ DateTimePreparser::DateTimePreparser() : m_hasDateTokens(false)
 {
 }
 
-DateTimePreparser::DateTimePreparser(std::string const& in) : m_hasDateTokens(false)
+DateTimePreparser::DateTimePreparser(std::string const& in) : m_text(in), m_hasDateTokens(false)
 {
-    ParseDateTime(in);
+    ParseObserver::Observe(ParseEventKind::DateTimePreparse, in.length(), [this]() { ParseDateTime(); });
 }
 
 std::vector<std::shared_ptr<DateTimePreparsedToken>> DateTimePreparser::GetTextTokens() const
 {
-    return m_textTokenCollection;
+    std::vector<std::shared_ptr<DateTimePreparsedToken>> tokens;
+    tokens.reserve(m_tokens.size());
+    for (const auto& token : m_tokens)
+    {
+        if (token.isTime)
+        {
+            std::ostringstream parsedTime;
+            parsedTime << std::put_time(&token.date, "%I:%M %p");
+            tokens.emplace_back(std::make_shared<DateTimePreparsedToken>(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString));
+        }
+        else if (token.format == DateTimePreparsedTokenFormat::RegularString)
+        {
+            tokens.emplace_back(std::make_shared<DateTimePreparsedToken>(m_text.substr(token.offset, token.length), token.format));
+        }
+        else
+        {
+            tokens.emplace_back(
+                std::make_shared<DateTimePreparsedToken>(m_text.substr(token.offset, token.length), token.date, token.format));
+        }
+    }
+    return tokens;
 }
 
 bool DateTimePreparser::HasDateTokens() const
@@ -36,28 +58,23 @@ bool DateTimePreparser::HasDateTokens() const
     return m_hasDateTokens;
 }
 
-void DateTimePreparser::AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddTextToken(size_t offset, size_t length)
 {
-    if (!text.empty())
+    if (length != 0)
     {
-        m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, format));
+        m_tokens.push_back({offset, length, DateTimePreparsedTokenFormat::RegularString, false, {}});
     }
 }
 
-void DateTimePreparser::AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format)
+void DateTimePreparser::AddDateToken(size_t offset, size_t length, const struct tm& date, DateTimePreparsedTokenFormat format)
 {
-    m_textTokenCollection.emplace_back(std::make_shared<DateTimePreparsedToken>(text, date, format));
+    m_tokens.push_back({offset, length, format, false, date});
     m_hasDateTokens = true;
 }
 
-std::string DateTimePreparser::Concatenate() const
+void DateTimePreparser::AddTimeToken(size_t offset, size_t length, const struct tm& time)
 {
-    std::string formedString;
-    for (const auto& piece : m_textTokenCollection)
-    {
-        formedString += piece->GetText();
-    }
-    return formedString;
+    m_tokens.push_back({offset, length, DateTimePreparsedTokenFormat::RegularString, true, time});
 }
 
 bool DateTimePreparser::IsValidDate(const int year, const int month, const int day)
@@ -88,12 +105,6 @@ bool DateTimePreparser::IsValidTime(const int hours, const int minutes, const in
     return (hours <= 24 && minutes <= 60 && seconds <= 60);
 }
 
-bool DateTimePreparser::IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes)
-{
-    return IsValidDate(parsedTm.tm_year, parsedTm.tm_mon, parsedTm.tm_mday) &&
-        IsValidTime(parsedTm.tm_hour, parsedTm.tm_min, parsedTm.tm_sec) && IsValidTime(hours, minutes, 0);
-}
-
 constexpr time_t IntToTimeT(int timeToConvert)
 {
 #pragma warning(push)
@@ -103,193 +114,253 @@ constexpr time_t IntToTimeT(int timeToConvert)
 #pragma warning(pop)
 }
 
-void DateTimePreparser::ParseDateTime(const std::string& in)
+namespace
 {
-    if (in.find("{{") != std::string::npos)
+    // Parses exactly count ASCII digits starting at position
+    bool TryParseDigits(const std::string& string, size_t position, size_t count, unsigned int& value)
     {
-        static const std::regex pattern(
-            "\\{\\{((DATE)|(TIME))\\((\\d{4})-{1}(\\d{2})-{1}(\\d{2})T(\\d{2}):{1}(\\d{2}):{1}(\\d{2})(Z|(([+-])(\\d{2}):{1}(\\d{2})))((((, ?SHORT)|(, ?LONG))|(, ?COMPACT))|)\\)\\}\\}");
-        std::smatch matches;
-        std::string text = in;
-        enum MatchIndex
+        if (position + count > string.length())
         {
-            IsDate = 2,
-            Year = 4,
-            Month,
-            Day,
-            Hour,
-            Min,
-            Sec,
-            TimeZone = 12,
-            TZHr,
-            TZMn,
-            Format,
-            Style,
-        };
-        std::vector<int> indexer = {Year, Month, Day, Hour, Min, Sec, TZHr, TZMn};
+            return false;
+        }
 
-        while (std::regex_search(text, matches, pattern))
+        value = 0;
+        for (size_t i = position; i < position + count; ++i)
         {
-            int formatStyle{};
-            // Date is matched
-            const bool isDate = matches[IsDate].matched;
-            int hours{}, minutes{};
-            struct tm parsedTm
-            {
-            };
-            std::vector<int*> addrs = {
-                &parsedTm.tm_year, &parsedTm.tm_mon, &parsedTm.tm_mday, &parsedTm.tm_hour, &parsedTm.tm_min, &parsedTm.tm_sec, &hours, &minutes};
-
-            if (matches[Style].matched)
+            if (string[i] < '0' || string[i] > '9')
             {
-                // match for long/short/compact
-                bool formatHasSpace = matches[Format].str().at(1) == ' ';
-                const int formatStartIndex = formatHasSpace ? 2 : 1;
-                formatStyle = matches[Format].str().at(formatStartIndex);
+                return false;
             }
+            value = value * 10 + (string[i] - '0');
+        }
+        return true;
+    }
 
-            AddTextToken(matches.prefix().str(), DateTimePreparsedTokenFormat::RegularString);
+    bool TryMatch(const std::string& string, size_t& position, char expected)
+    {
+        if (position < string.length() && string[position] == expected)
+        {
+            ++position;
+            return true;
+        }
+        return false;
+    }
 
-            if (!isDate && formatStyle)
+    bool TryMatch(const std::string& string, size_t& position, const char* expected)
+    {
+        const size_t length = strlen(expected);
+        if (string.compare(position, length, expected) == 0)
+        {
+            position += length;
+            return true;
+        }
+        return false;
+    }
+
+    struct DateTimeToken
+    {
+        bool isDate;
+        unsigned int year, month, day, hours, minutes, seconds;
+        // Sign of the time zone in the token ('Z' for UTC) and its magnitude
+        char timeZone;
+        unsigned int timeZoneHours, timeZoneMinutes;
+        // 'S'hort, 'L'ong, 'C'ompact or 0 when no style was given
+        char style;
+    };
+
+    // Matches {{DATE(YYYY-MM-DDTHH:MM:SS(Z|+HH:MM|-HH:MM)(, ?SHORT|, ?LONG|, ?COMPACT)?)}} (or TIME) starting at
+    // position, which must be the start of a "{{". On success, end is set to the position just past the closing "}}".
+    bool TryMatchDateTimeToken(const std::string& in, size_t position, DateTimeToken& token, size_t& end)
+    {
+        size_t current = position + 2;
+        if (TryMatch(in, current, "DATE("))
+        {
+            token.isDate = true;
+        }
+        else if (TryMatch(in, current, "TIME("))
+        {
+            token.isDate = false;
+        }
+        else
+        {
+            return false;
+        }
+
+        if (!(TryParseDigits(in, current, 4, token.year) && TryMatch(in, (current += 4), '-') &&
+              TryParseDigits(in, current, 2, token.month) && TryMatch(in, (current += 2), '-') &&
+              TryParseDigits(in, current, 2, token.day) && TryMatch(in, (current += 2), 'T') &&
+              TryParseDigits(in, current, 2, token.hours) && TryMatch(in, (current += 2), ':') &&
+              TryParseDigits(in, current, 2, token.minutes) && TryMatch(in, (current += 2), ':') &&
+              TryParseDigits(in, current, 2, token.seconds)))
+        {
+            return false;
+        }
+        current += 2;
+
+        token.timeZoneHours = 0;
+        token.timeZoneMinutes = 0;
+        if (TryMatch(in, current, 'Z'))
+        {
+            token.timeZone = 'Z';
+        }
+        else if (current < in.length() && (in[current] == '+' || in[current] == '-'))
+        {
+            token.timeZone = in[current++];
+            if (!(TryParseDigits(in, current, 2, token.timeZoneHours) && TryMatch(in, (current += 2), ':') &&
+                  TryParseDigits(in, current, 2, token.timeZoneMinutes)))
             {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
-                text = matches.suffix().str();
-                continue;
+                return false;
             }
+            current += 2;
+        }
+        else
+        {
+            return false;
+        }
 
-            for (unsigned int idx = 0; idx < indexer.size(); idx++)
+        token.style = 0;
+        if (TryMatch(in, current, ','))
+        {
+            TryMatch(in, current, ' ');
+            if (TryMatch(in, current, "SHORT"))
             {
-                if (matches[indexer.at(idx)].matched)
-                {
-                    // get indexes for time attributes to index into corresponding matches
-                    // and convert it to string
-                    *(addrs.at(idx)) = stoi(matches[indexer.at(idx)]);
-                }
+                token.style = 'S';
             }
-
-            // check for date and time validation
-            if (IsValidTimeAndDate(parsedTm, hours, minutes))
+            else if (TryMatch(in, current, "LONG"))
             {
-                time_t offset{};
-                // maches offset sign,
-                // Z == UTC,
-                // + == time added from UTC
-                // - == time subtracted from UTC
-                if (matches[TimeZone].matched)
-                {
-                    // converts to seconds
-                    hours *= 3600;
-                    minutes *= 60;
-                    offset = IntToTimeT(hours) + IntToTimeT(minutes);
-
-                    wchar_t zone = matches[TimeZone].str().at(0);
-                    // time zone offset calculation
-                    if (zone == '+')
-                    {
-                        offset *= -1;
-                    }
-                }
-
-                // measured from year 1900
-                parsedTm.tm_year -= 1900;
-                parsedTm.tm_mon -= 1;
-
-                time_t utc{};
-                // converts to ticks in UTC
-                utc = mktime(&parsedTm);
-                if (utc == -1)
-                {
-                    AddTextToken(matches[0], DateTimePreparsedTokenFormat::RegularString);
-                }
-
-// Disable "array to pointer decay" check for tzOffsetBuff since we can't change strftime's signature
-#pragma warning(push)
-#pragma warning(disable : 26485)
-                char tzOffsetBuff[6]{};
-                // gets local time zone offset
-                strftime(tzOffsetBuff, 6, "%z", &parsedTm);
-                std::string localTimeZoneOffsetStr(tzOffsetBuff);
-                const time_t nTzOffset = IntToTimeT(std::stoi(localTimeZoneOffsetStr));
-                offset += ((nTzOffset / 100) * 3600 + (nTzOffset % 100) * 60);
-                // add offset to utc
-                utc += offset;
-                struct tm result
-                {
-                };
-#pragma warning(pop)
-
-                // converts to local time from utc
-                if (!LOCALTIME(&result, &utc))
-                {
-                    // localtime() set dst, put_time adjusts time accordingly which is not what we want since
-                    // we have already taken cared of it in our calculation
-                    if (result.tm_isdst == 1)
-                    {
-                        result.tm_hour -= 1;
-                    }
-
-                    if (isDate)
-                    {
-                        switch (formatStyle)
-                        {
-                        // SHORT Style
-                        case 'S':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateShort);
-                            break;
-                        // LONG Style
-                        case 'L':
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateLong);
-                            break;
-                        // COMPACT or DEFAULT Style
-                        case 'C':
-                        default:
-                            AddDateToken(matches[0].str(), result, DateTimePreparsedTokenFormat::DateCompact);
-                            break;
-                        }
-                    }
-                    else
-                    {
-                        std::ostringstream parsedTime;
-                        parsedTime << std::put_time(&result, "%I:%M %p");
-                        AddTextToken(parsedTime.str(), DateTimePreparsedTokenFormat::RegularString);
-                    }
-                }
+                token.style = 'L';
+            }
+            else if (TryMatch(in, current, "COMPACT"))
+            {
+                token.style = 'C';
             }
             else
             {
-                AddTextToken(matches[0].str(), DateTimePreparsedTokenFormat::RegularString);
+                return false;
             }
-
-            text = matches.suffix().str();
         }
 
-        AddTextToken(text, DateTimePreparsedTokenFormat::RegularString);
+        if (!TryMatch(in, current, ")}}"))
+        {
+            return false;
+        }
+        end = current;
+        return true;
     }
-    else
+
+    // Seconds since the epoch of a UTC date and time. Out of range fields (month 0, day 0, hour 24...) roll over into
+    // the neighbouring ones as they would with mktime.
+    time_t ToEpochSeconds(const DateTimeToken& token)
     {
-        AddTextToken(in, DateTimePreparsedTokenFormat::RegularString);
+        // Days since 1970-01-01 in the proleptic Gregorian calendar, counting years from March
+        long long year = static_cast<long long>(token.year) + (static_cast<long long>(token.month) + 11) / 12 - 1;
+        const long long month = (static_cast<long long>(token.month) + 11) % 12 + 1;
+        year -= (month <= 2) ? 1 : 0;
+        const long long era = (year >= 0 ? year : year - 399) / 400;
+        const long long yearOfEra = year - era * 400;
+        const long long dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5;
+        const long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+        const long long days = era * 146097 + dayOfEra - 719468 + static_cast<long long>(token.day) - 1;
+
+        return static_cast<time_t>(days * 86400 + token.hours * 3600 + token.minutes * 60 + token.seconds);
     }
 }
 
-// Parses a time of the form HH:MM
-bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes)
+void DateTimePreparser::ParseDateTime()
 {
-    std::smatch subMatches;
-    static const std::regex timeMatch(R"regex(^(\d{2}):(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, timeMatch))
+    const std::string& in = m_text;
+    size_t textStart = 0;
+    for (size_t position = in.find("{{"); position != std::string::npos; position = in.find("{{", position + 1))
     {
-        if (subMatches[1].matched && subMatches[2].matched)
+        DateTimeToken token;
+        size_t end;
+        if (!TryMatchDateTimeToken(in, position, token, end))
+        {
+            continue;
+        }
+
+        AddTextToken(textStart, position - textStart);
+        const size_t matchStart = position;
+        const size_t matchLength = end - position;
+        textStart = end;
+        // the loop increment resumes the search at the end of the match
+        position = end - 1;
+
+        // styles only apply to dates
+        if (!token.isDate && token.style)
+        {
+            AddTextToken(matchStart, matchLength);
+            continue;
+        }
+
+        if (!(IsValidDate(token.year, token.month, token.day) && IsValidTime(token.hours, token.minutes, token.seconds) &&
+              IsValidTime(token.timeZoneHours, token.timeZoneMinutes, 0)))
+        {
+            AddTextToken(matchStart, matchLength);
+            continue;
+        }
+
+        // Z == UTC, + == time added from UTC, - == time subtracted from UTC
+        time_t utc = ToEpochSeconds(token);
+        const time_t offset = IntToTimeT(token.timeZoneHours * 3600 + token.timeZoneMinutes * 60);
+        if (token.timeZone == '+')
+        {
+            utc -= offset;
+        }
+        else if (token.timeZone == '-')
         {
-            unsigned int parsedHours = std::stoul(subMatches[1]);
-            unsigned int parsedMinutes = std::stoul(subMatches[2]);
+            utc += offset;
+        }
+
+        // converts to local time (including any daylight saving offset in effect at that time) from utc
+        struct tm result
+        {
+        };
+        if (LOCALTIME(&result, &utc))
+        {
+            AddTextToken(matchStart, matchLength);
+            continue;
+        }
 
-            if (IsValidTime(parsedHours, parsedMinutes, 0))
+        if (token.isDate)
+        {
+            switch (token.style)
             {
-                hours = parsedHours;
-                minutes = parsedMinutes;
-                return true;
+            // SHORT Style
+            case 'S':
+                AddDateToken(matchStart, matchLength, result, DateTimePreparsedTokenFormat::DateShort);
+                break;
+            // LONG Style
+            case 'L':
+                AddDateToken(matchStart, matchLength, result, DateTimePreparsedTokenFormat::DateLong);
+                break;
+            // COMPACT or DEFAULT Style
+            case 'C':
+            default:
+                AddDateToken(matchStart, matchLength, result, DateTimePreparsedTokenFormat::DateCompact);
+                break;
             }
         }
+        else
+        {
+            AddTimeToken(matchStart, matchLength, result);
+        }
+    }
+
+    AddTextToken(textStart, in.length() - textStart);
+}
+
+// Parses a time of the form HH:MM
+bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes)
+{
+    unsigned int parsedHours;
+    unsigned int parsedMinutes;
+    if (string.length() == 5 && string[2] == ':' && TryParseDigits(string, 0, 2, parsedHours) &&
+        TryParseDigits(string, 3, 2, parsedMinutes) && IsValidTime(parsedHours, parsedMinutes, 0))
+    {
+        hours = parsedHours;
+        minutes = parsedMinutes;
+        return true;
     }
     return false;
 }
@@ -297,24 +368,17 @@ bool DateTimePreparser::TryParseSimpleTime(const std::string& string, unsigned i
 // Parses a date of the form YYYY-MM-DD
 bool DateTimePreparser::TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day)
 {
-    std::smatch subMatches;
-    static const std::regex dateMatch(R"regex(^(\d{4})-(\d{2})-(\d{2})$)regex");
-    if (std::regex_match(string, subMatches, dateMatch))
+    unsigned int parsedYear;
+    unsigned int parsedMonth;
+    unsigned int parsedDay;
+    if (string.length() == 10 && string[4] == '-' && string[7] == '-' && TryParseDigits(string, 0, 4, parsedYear) &&
+        TryParseDigits(string, 5, 2, parsedMonth) && TryParseDigits(string, 8, 2, parsedDay) &&
+        IsValidDate(parsedYear, parsedMonth, parsedDay))
     {
-        if (subMatches[1].matched && subMatches[2].matched && subMatches[3].matched)
-        {
-            unsigned int parsedYear = std::stoul(subMatches[1]);
-            unsigned int parsedMonth = std::stoul(subMatches[2]);
-            unsigned int parsedDay = std::stoul(subMatches[3]);
-
-            if (IsValidDate(parsedYear, parsedMonth, parsedDay))
-            {
-                year = parsedYear;
-                month = parsedMonth;
-                day = parsedDay;
-                return true;
-            }
-        }
+        year = parsedYear;
+        month = parsedMonth;
+        day = parsedDay;
+        return true;
     }
     return false;
 }
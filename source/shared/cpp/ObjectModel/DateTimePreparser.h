@@ -12,21 +12,33 @@ namespace AdaptiveSharedNamespace
     public:
         DateTimePreparser();
         DateTimePreparser(const std::string& in);
+        // Builds the tokens from the spans found by the parse, so their strings are only made when asked for
         std::vector<std::shared_ptr<DateTimePreparsedToken>> GetTextTokens() const;
         bool HasDateTokens() const;
         static bool TryParseSimpleTime(const std::string& string, unsigned int& hours, unsigned int& minutes);
         static bool TryParseSimpleDate(const std::string& string, unsigned int& year, unsigned int& month, unsigned int& day);
 
     private:
-        void AddTextToken(const std::string& text, DateTimePreparsedTokenFormat format);
-        void AddDateToken(const std::string& text, struct tm& date, DateTimePreparsedTokenFormat format);
-        std::string Concatenate() const;
-        void ParseDateTime(const std::string& in);
+        // A token of the text: a span of it, which is a date if the format isn't RegularString, or a time in it
+        struct TokenSpan
+        {
+            size_t offset;
+            size_t length;
+            DateTimePreparsedTokenFormat format;
+            bool isTime;
+            // The local date or time of date and time tokens
+            struct tm date;
+        };
+
+        void AddTextToken(size_t offset, size_t length);
+        void AddDateToken(size_t offset, size_t length, const struct tm& date, DateTimePreparsedTokenFormat format);
+        void AddTimeToken(size_t offset, size_t length, const struct tm& time);
+        void ParseDateTime();
         static inline bool IsValidDate(const int year, const int month, const int day);
         static inline bool IsValidTime(const int hours, const int minutes, const int seconds);
-        static inline bool IsValidTimeAndDate(const struct tm& parsedTm, const int hours, const int minutes);
 
-        std::vector<std::shared_ptr<DateTimePreparsedToken>> m_textTokenCollection;
+        std::string m_text;
+        std::vector<TokenSpan> m_tokens;
         bool m_hasDateTokens;
     };
 }
@@ -22,6 +22,38 @@
 
 namespace AdaptiveSharedNamespace
 {
+    namespace
+    {
+        const std::unordered_set<std::string>& GetKnownElements()
+        {
+            static const std::unordered_set<std::string> knownElements{
+                CardElementTypeToString(CardElementType::ActionSet),
+                CardElementTypeToString(CardElementType::Container),
+                CardElementTypeToString(CardElementType::Column),
+                CardElementTypeToString(CardElementType::ColumnSet),
+                CardElementTypeToString(CardElementType::FactSet),
+                CardElementTypeToString(CardElementType::Image),
+                CardElementTypeToString(CardElementType::ImageSet),
+                CardElementTypeToString(CardElementType::ChoiceSetInput),
+                CardElementTypeToString(CardElementType::DateInput),
+                CardElementTypeToString(CardElementType::Media),
+                CardElementTypeToString(CardElementType::NumberInput),
+                CardElementTypeToString(CardElementType::RichTextBlock),
+                CardElementTypeToString(CardElementType::TextBlock),
+                CardElementTypeToString(CardElementType::TextInput),
+                CardElementTypeToString(CardElementType::TimeInput),
+                CardElementTypeToString(CardElementType::ToggleInput),
+                CardElementTypeToString(CardElementType::Unknown),
+            };
+            return knownElements;
+        }
+    }
+
+    bool BaseCardElementParser::Validate(ParseContext& context, const Json::Value& value)
+    {
+        return Deserialize(context, value) != nullptr;
+    }
+
     BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseCardElementParser> parserToWrap) :
         m_parser{parserToWrap}
     {
@@ -32,65 +64,67 @@ namespace AdaptiveSharedNamespace
         const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
         const InternalId internalId = InternalId::Next();
 
-        context.PushElement(idProperty, internalId);
-        std::shared_ptr<BaseCardElement> element = m_parser->Deserialize(context, value);
-        context.PopElement();
+        std::shared_ptr<BaseCardElement> element = context.Observe(ParseEventKind::Element, value, [&]() {
+            context.PushElement(idProperty, internalId);
+            auto parsedElement = m_parser->Deserialize(context, value);
+            context.PopElement(parsedElement);
+            return parsedElement;
+        });
 
         return element;
     }
 
     std::shared_ptr<BaseCardElement> BaseCardElementParserWrapper::DeserializeFromString(ParseContext& context, const std::string& value)
     {
-        return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+        return Deserialize(context, context.Observe(ParseEventKind::JsonRead, value.size(), [&]() {
+            return ParseUtil::GetJsonValueFromString(value);
+        }));
     }
 
-    ElementParserRegistration::ElementParserRegistration()
+    bool BaseCardElementParserWrapper::Validate(ParseContext& context, const Json::Value& value)
     {
-        m_knownElements.insert({
-            CardElementTypeToString(CardElementType::ActionSet),
-            CardElementTypeToString(CardElementType::Container),
-            CardElementTypeToString(CardElementType::Column),
-            CardElementTypeToString(CardElementType::ColumnSet),
-            CardElementTypeToString(CardElementType::FactSet),
-            CardElementTypeToString(CardElementType::Image),
-            CardElementTypeToString(CardElementType::ImageSet),
-            CardElementTypeToString(CardElementType::ChoiceSetInput),
-            CardElementTypeToString(CardElementType::DateInput),
-            CardElementTypeToString(CardElementType::Media),
-            CardElementTypeToString(CardElementType::NumberInput),
-            CardElementTypeToString(CardElementType::RichTextBlock),
-            CardElementTypeToString(CardElementType::TextBlock),
-            CardElementTypeToString(CardElementType::TextInput),
-            CardElementTypeToString(CardElementType::TimeInput),
-            CardElementTypeToString(CardElementType::ToggleInput),
-            CardElementTypeToString(CardElementType::Unknown),
-        });
+        const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
+        const InternalId internalId = InternalId::Next();
+        context.PushElement(idProperty, internalId);
+        const bool isValid = m_parser->Validate(context, value);
+        context.PopElement();
+        return isValid;
+    }
+
+    ElementParserRegistration::ElementParserRegistration() : m_cardElementParsers{GetBuiltInParsers()}
+    {
+    }
 
-        m_cardElementParsers.insert(
-            {{CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
-             {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
-             {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
-             {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
-             {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
-             {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
-             {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
-             {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
-             {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
-             {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
-             {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
-             {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
-             {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
-             {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
-             {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
-             {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
-             {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+    const std::shared_ptr<const ElementParserRegistration::ParserMap>& ElementParserRegistration::GetBuiltInParsers()
+    {
+        static const std::shared_ptr<const ParserMap> builtInParsers = std::make_shared<const ParserMap>(ParserMap{
+            {CardElementTypeToString(CardElementType::ActionSet), std::make_shared<ActionSetParser>()},
+            {CardElementTypeToString(CardElementType::Container), std::make_shared<ContainerParser>()},
+            {CardElementTypeToString(CardElementType::Column), std::make_shared<ColumnParser>()},
+            {CardElementTypeToString(CardElementType::ColumnSet), std::make_shared<ColumnSetParser>()},
+            {CardElementTypeToString(CardElementType::FactSet), std::make_shared<FactSetParser>()},
+            {CardElementTypeToString(CardElementType::Image), std::make_shared<ImageParser>()},
+            {CardElementTypeToString(CardElementType::ImageSet), std::make_shared<ImageSetParser>()},
+            {CardElementTypeToString(CardElementType::ChoiceSetInput), std::make_shared<ChoiceSetInputParser>()},
+            {CardElementTypeToString(CardElementType::DateInput), std::make_shared<DateInputParser>()},
+            {CardElementTypeToString(CardElementType::Media), std::make_shared<MediaParser>()},
+            {CardElementTypeToString(CardElementType::NumberInput), std::make_shared<NumberInputParser>()},
+            {CardElementTypeToString(CardElementType::RichTextBlock), std::make_shared<RichTextBlockParser>()},
+            {CardElementTypeToString(CardElementType::TextBlock), std::make_shared<TextBlockParser>()},
+            {CardElementTypeToString(CardElementType::TextInput), std::make_shared<TextInputParser>()},
+            {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
+            {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
+            {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+        return builtInParsers;
     }
 
     void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
     {
-        if (m_knownElements.find(elementType) == m_knownElements.end())
+        if (GetKnownElements().find(elementType) == GetKnownElements().end())
         {
-            ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+            auto parsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+            (*parsers)[elementType] = parser;
+            m_cardElementParsers = std::move(parsers);
         }
         else
         {
@@ -101,9 +135,11 @@ namespace AdaptiveSharedNamespace
 
     void ElementParserRegistration::RemoveParser(std::string const& elementType)
     {
-        if (m_knownElements.find(elementType) == m_knownElements.end())
+        if (GetKnownElements().find(elementType) == GetKnownElements().end())
         {
-            ElementParserRegistration::m_cardElementParsers.erase(elementType);
+            auto parsers = std::make_shared<ParserMap>(*m_cardElementParsers);
+            parsers->erase(elementType);
+            m_cardElementParsers = std::move(parsers);
         }
         else
         {
@@ -114,8 +150,8 @@ namespace AdaptiveSharedNamespace
 
     std::shared_ptr<BaseCardElementParser> ElementParserRegistration::GetParser(std::string const& elementType) const
     {
-        auto parser = m_cardElementParsers.find(elementType);
-        if (parser != ElementParserRegistration::m_cardElementParsers.end())
+        auto parser = m_cardElementParsers->find(elementType);
+        if (parser != m_cardElementParsers->end())
         {
             // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
             // collision detection. We *could* do this within the implementation of parsers themselves, but that would
@@ -130,4 +166,10 @@ namespace AdaptiveSharedNamespace
             return std::shared_ptr<BaseCardElementParser>(nullptr);
         }
     }
+
+    std::shared_ptr<BaseCardElementParser> ElementParserRegistration::FindParser(std::string const& elementType) const
+    {
+        auto parser = m_cardElementParsers->find(elementType);
+        return parser != m_cardElementParsers->end() ? parser->second : nullptr;
+    }
 }
@@ -53,7 +53,7 @@ namespace AdaptiveSharedNamespace
                 _GenerateStringToEnumMap();
             }
 
-            const std::string toString(T t) const { return _enumToString.at(t); }
+            const std::string& toString(T t) const { return _enumToString.at(t); }
             T fromString(const std::string& str) const { return _stringToEnum.at(str); }
 
         private:
@@ -3,6 +3,8 @@
 #include "pch.h"
 #include "Fact.h"
 #include "DateTimePreparser.h"
+#include "TextProcessingCache.h"
+#include "ParsePolicy.h"
 #include "ParseUtil.h"
 
 using namespace AdaptiveSharedNamespace;
@@ -11,17 +13,22 @@ Fact::Fact()
 {
 }
 
-Fact::Fact(std::string const& title, std::string const& value) : m_title(title), m_value(value)
+Fact::Fact(std::string title, std::string value) : m_title(std::move(title)), m_value(std::move(value))
 {
 }
 
-std::shared_ptr<Fact> Fact::Deserialize(const ParseContext& context, const Json::Value& json)
+template<typename TPolicy>
+void Fact::ParseProperties(const TPolicy& policy, const ParseContext& context, const Json::Value& json)
 {
-    std::string title = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true);
-    std::string value = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, true);
+    policy.String(json, AdaptiveCardSchemaKey::Title, &Fact::SetTitle, true);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &Fact::SetValue, true);
+    policy.Set(&Fact::m_language, context.GetInternedLanguage());
+}
 
-    auto fact = std::make_shared<Fact>(title, value);
-    fact->SetLanguage(context.GetLanguage());
+std::shared_ptr<Fact> Fact::Deserialize(const ParseContext& context, const Json::Value& json)
+{
+    auto fact = std::make_shared<Fact>();
+    ParseProperties(BuildPolicy<Fact>(*fact), context, json);
 
     return fact;
 }
@@ -31,6 +38,11 @@ std::shared_ptr<Fact> Fact::DeserializeFromString(const ParseContext& context, c
     return Fact::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
+void Fact::Validate(ParseContext& context, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<Fact>(), context, json);
+}
+
 std::string Fact::Serialize()
 {
     return ParseUtil::JsonToString(SerializeToJsonValue());
@@ -45,42 +57,51 @@ Json::Value Fact::SerializeToJsonValue()
     return root;
 }
 
-std::string Fact::GetTitle() const
+const std::string& Fact::GetTitle() const
 {
     return m_title;
 }
 
-void Fact::SetTitle(const std::string& value)
+void Fact::SetTitle(std::string value)
 {
-    m_title = value;
+    m_title = std::move(value);
+    m_titleForDateParsing.reset();
 }
 
-std::string Fact::GetValue() const
+const std::string& Fact::GetValue() const
 {
     return m_value;
 }
 
-void Fact::SetValue(const std::string& value)
+void Fact::SetValue(std::string value)
+{
+    m_value = std::move(value);
+    m_valueForDateParsing.reset();
+}
+
+const DateTimePreparser& Fact::GetTitleForDateParsing() const
 {
-    m_value = value;
+    return TextProcessingCache::GetDateTimePreparser(m_titleForDateParsing, m_title);
 }
 
-DateTimePreparser Fact::GetTitleForDateParsing() const
+const DateTimePreparser& Fact::GetValueForDateParsing() const
 {
-    return DateTimePreparser(m_title);
+    return TextProcessingCache::GetDateTimePreparser(m_valueForDateParsing, m_value);
 }
 
-DateTimePreparser Fact::GetValueForDateParsing() const
+const std::string& Fact::GetLanguage() const
 {
-    return DateTimePreparser(m_value);
+    return m_language.Get();
 }
 
-std::string Fact::GetLanguage() const
+void Fact::SetLanguage(std::string value)
 {
-    return m_language;
+    m_language = InternedString(std::move(value));
 }
 
-void Fact::SetLanguage(const std::string& value)
+void Fact::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    m_language = value;
+    usage.AddObject(sizeof(Fact));
+    usage.AddString(m_title);
+    usage.AddString(m_value);
 }
@@ -5,6 +5,8 @@
 #include "pch.h"
 #include "ElementParserRegistration.h"
 #include "DateTimePreparser.h"
+#include "StringPool.h"
+#include "MemoryUsage.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -12,28 +14,38 @@ namespace AdaptiveSharedNamespace
     {
     public:
         Fact();
-        Fact(std::string const& title, std::string const& value);
+        Fact(std::string title, std::string value);
 
         std::string Serialize();
         Json::Value SerializeToJsonValue();
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
-        std::string GetTitle() const;
-        void SetTitle(const std::string& value);
+        const std::string& GetTitle() const;
+        void SetTitle(std::string value);
 
-        std::string GetValue() const;
-        void SetValue(const std::string& value);
-        DateTimePreparser GetTitleForDateParsing() const;
-        DateTimePreparser GetValueForDateParsing() const;
+        const std::string& GetValue() const;
+        void SetValue(std::string value);
+        // The preparsed title and value are cached until the title or value changes, and shared through the default
+        // TextProcessingCache when it's enabled. They may be read on several threads at once. The reference is valid
+        // until the title or value changes, which must not happen while another thread reads them.
+        const DateTimePreparser& GetTitleForDateParsing() const;
+        const DateTimePreparser& GetValueForDateParsing() const;
 
-        void SetLanguage(const std::string& value);
-        std::string GetLanguage() const;
+        void SetLanguage(std::string value);
+        const std::string& GetLanguage() const;
 
         static std::shared_ptr<Fact> Deserialize(const ParseContext& context, const Json::Value& root);
         static std::shared_ptr<Fact> DeserializeFromString(const ParseContext& context, const std::string& jsonString);
+        static void Validate(ParseContext& context, const Json::Value& root);
 
     private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, const ParseContext& context, const Json::Value& json);
+
         std::string m_title;
         std::string m_value;
-        std::string m_language;
+        InternedString m_language;
+        mutable std::shared_ptr<const DateTimePreparser> m_titleForDateParsing;
+        mutable std::shared_ptr<const DateTimePreparser> m_valueForDateParsing;
     };
 }
@@ -10,7 +10,6 @@ using namespace AdaptiveSharedNamespace;
 
 FactSet::FactSet() : BaseCardElement(CardElementType::FactSet)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<Fact>>& FactSet::GetFacts() const
@@ -37,16 +36,28 @@ Json::Value FactSet::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(ParseContext& context, const Json::Value& value)
+void FactSet::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    ParseUtil::ExpectTypeString(value, CardElementType::FactSet);
+    usage.AddObject(sizeof(FactSet));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_facts);
+}
+
+template<typename TPolicy>
+void FactSetParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    ParseUtil::ExpectTypeString(json, CardElementType::FactSet);
 
-    auto factSet = BaseCardElement::Deserialize<FactSet>(context, value);
+    BaseCardElement::ParseProperties(policy, context, json);
 
     // Parse Facts
-    auto facts =
-        ParseUtil::GetElementCollectionOfSingleType<Fact>(context, value, AdaptiveCardSchemaKey::Facts, Fact::Deserialize, true);
-    factSet->m_facts = std::move(facts);
+    policy.template Items<Fact>(context, json, AdaptiveCardSchemaKey::Facts, &FactSet::m_facts, true);
+}
+
+std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto factSet = std::make_shared<FactSet>();
+    ParseProperties(BuildPolicy<FactSet>(*factSet), context, json);
 
     return factSet;
 }
@@ -56,7 +67,9 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
     return FactSetParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void FactSet::PopulateKnownPropertiesSet()
+bool FactSetParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
+    ParseProperties(ValidatePolicy<FactSet>(), context, json);
+
+    return true;
 }
@@ -23,13 +23,12 @@ namespace AdaptiveSharedNamespace
         ~FactSet() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
         std::vector<std::shared_ptr<Fact>>& GetFacts();
         const std::vector<std::shared_ptr<Fact>>& GetFacts() const;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::vector<std::shared_ptr<Fact>> m_facts;
     };
 
@@ -45,5 +44,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
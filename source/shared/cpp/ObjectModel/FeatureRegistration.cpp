@@ -9,27 +9,28 @@
 namespace AdaptiveSharedNamespace
 {
     FeatureRegistration::FeatureRegistration() :
-        m_supportedFeatures{{AdaptiveSharedNamespace::c_adaptiveCardsFeature, c_sharedModelVersion}}
+        m_supportedFeatures{{AdaptiveSharedNamespace::c_adaptiveCardsFeature,
+                             {c_sharedModelVersion, SemanticVersion(c_sharedModelVersion), false}}}
     {
     }
 
     void FeatureRegistration::AddFeature(std::string const& featureName, const std::string& featureVersion)
     {
         // first, validate the version string. we only support "*" or a semantic version string (e.g. "1.0", or "1.2.3.4")
-        if (featureVersion != "*")
-        {
-            // the below will throw if the version is invalid
-            const SemanticVersion version(featureVersion);
-        }
+        const bool anyVersion = (featureVersion == "*");
+
+        // the below will throw if the version is invalid
+        const SemanticVersion version(anyVersion ? "0" : featureVersion);
 
-        if (m_supportedFeatures.find(featureName) == m_supportedFeatures.end())
+        const auto feature = m_supportedFeatures.find(featureName);
+        if (feature == m_supportedFeatures.end())
         {
-            m_supportedFeatures[featureName] = featureVersion;
+            m_supportedFeatures.emplace(featureName, FeatureVersion{featureVersion, version, anyVersion});
         }
         else
         {
             // only allow a duplicate add attempt if the version is the same.
-            if (m_supportedFeatures[featureName] != featureVersion)
+            if (feature->second.version != featureVersion)
             {
                 throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
                                                  "Attempting to add a feature with a differing version");
@@ -50,19 +51,30 @@ namespace AdaptiveSharedNamespace
 
     SemanticVersion FeatureRegistration::GetAdaptiveCardsVersion() const
     {
-        SemanticVersion adaptiveCardsVersion{GetFeatureVersion(AdaptiveSharedNamespace::c_adaptiveCardsFeature)};
-        return adaptiveCardsVersion;
+        return m_supportedFeatures.at(AdaptiveSharedNamespace::c_adaptiveCardsFeature).parsedVersion;
     }
 
     std::string FeatureRegistration::GetFeatureVersion(const std::string& featureName) const
     {
-        if (m_supportedFeatures.find(featureName) != m_supportedFeatures.end())
+        const auto feature = m_supportedFeatures.find(featureName);
+        if (feature != m_supportedFeatures.end())
         {
-            return m_supportedFeatures.at(featureName);
+            return feature->second.version;
         }
         else
         {
             return "";
         }
     }
+
+    bool FeatureRegistration::ProvidesFeature(const std::string& featureName, const SemanticVersion& minimumVersion) const
+    {
+        const auto feature = m_supportedFeatures.find(featureName);
+        if (feature == m_supportedFeatures.end())
+        {
+            return false;
+        }
+
+        return feature->second.anyVersion || !(feature->second.parsedVersion < minimumVersion);
+    }
 }
@@ -3,12 +3,12 @@
 #pragma once
 
 #include "pch.h"
+#include "SemanticVersion.h"
 
 namespace AdaptiveSharedNamespace
 {
     constexpr const char* const c_adaptiveCardsFeature = "adaptiveCards";
 
-    class SemanticVersion;
     class FeatureRegistration
     {
     public:
@@ -19,7 +19,18 @@ namespace AdaptiveSharedNamespace
         SemanticVersion GetAdaptiveCardsVersion() const;
         std::string GetFeatureVersion(const std::string& featureName) const;
 
+        // Whether the host provides featureName at minimumVersion or later. Versions are parsed once when features are
+        // added, so this doesn't allocate or parse; a feature registered as "*" satisfies any version.
+        bool ProvidesFeature(const std::string& featureName, const SemanticVersion& minimumVersion) const;
+
     private:
-        std::unordered_map<std::string, std::string> m_supportedFeatures;
+        struct FeatureVersion
+        {
+            std::string version;
+            SemanticVersion parsedVersion;
+            bool anyVersion;
+        };
+
+        std::unordered_map<std::string, FeatureVersion> m_supportedFeatures;
     };
 }
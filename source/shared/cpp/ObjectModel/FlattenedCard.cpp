@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "FlattenedCard.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+
+using namespace AdaptiveSharedNamespace;
+
+FlattenedCard::FlattenedCard(std::shared_ptr<AdaptiveCard> card) : m_card(card)
+{
+    AddCard(*m_card, NoIndex, 0);
+}
+
+unsigned int FlattenedCard::GetFirstChild(unsigned int index) const
+{
+    return m_elements[index].childCount ? index + 1 : NoIndex;
+}
+
+unsigned int FlattenedCard::GetNextSibling(unsigned int index) const
+{
+    const unsigned int next = index + m_elements[index].subtreeSize;
+    if (next < m_elements.size() && m_elements[next].parentIndex == m_elements[index].parentIndex)
+    {
+        return next;
+    }
+    return NoIndex;
+}
+
+unsigned int FlattenedCard::FindByInternalId(InternalId internalId) const
+{
+    for (unsigned int i = 0; i < m_elements.size(); ++i)
+    {
+        if (m_elements[i].internalId == internalId)
+        {
+            return i;
+        }
+    }
+    return NoIndex;
+}
+
+template<typename T>
+void FlattenedCard::AddChildren(const std::vector<std::shared_ptr<T>>& children, unsigned int parentIndex, unsigned int depth)
+{
+    for (const auto& child : children)
+    {
+        AddElement(*child, child->GetElementType(), ActionType::Unsupported, parentIndex, depth);
+    }
+}
+
+void FlattenedCard::AddChildren(const std::vector<std::shared_ptr<BaseActionElement>>& actions, unsigned int parentIndex, unsigned int depth)
+{
+    for (const auto& action : actions)
+    {
+        AddElement(*action, CardElementType::Unknown, action->GetElementType(), parentIndex, depth);
+    }
+}
+
+void FlattenedCard::AddCard(const AdaptiveCard& card, unsigned int parentIndex, unsigned int depth)
+{
+    AddChildren(card.GetBody(), parentIndex, depth);
+    AddChildren(card.GetActions(), parentIndex, depth);
+}
+
+void FlattenedCard::AddElement(BaseElement& element,
+                               CardElementType elementType,
+                               ActionType actionType,
+                               unsigned int parentIndex,
+                               unsigned int depth)
+{
+    const unsigned int index = static_cast<unsigned int>(m_elements.size());
+    m_elements.push_back({&element, element.GetInternalId(), elementType, actionType, parentIndex, 1, 0, depth});
+    if (parentIndex != NoIndex)
+    {
+        ++m_elements[parentIndex].childCount;
+    }
+
+    switch (elementType)
+    {
+    case CardElementType::Container:
+        AddChildren(static_cast<Container&>(element).GetItems(), index, depth + 1);
+        break;
+    case CardElementType::Column:
+        AddChildren(static_cast<Column&>(element).GetItems(), index, depth + 1);
+        break;
+    case CardElementType::ColumnSet:
+        AddChildren(static_cast<ColumnSet&>(element).GetColumns(), index, depth + 1);
+        break;
+    case CardElementType::ImageSet:
+        AddChildren(static_cast<ImageSet&>(element).GetImages(), index, depth + 1);
+        break;
+    case CardElementType::ActionSet:
+        AddChildren(static_cast<ActionSet&>(element).GetActions(), index, depth + 1);
+        break;
+    default:
+        if (actionType == ActionType::ShowCard)
+        {
+            const auto card = static_cast<ShowCardAction&>(element).GetCard();
+            if (card != nullptr)
+            {
+                AddCard(*card, index, depth + 1);
+            }
+        }
+        break;
+    }
+
+    // m_elements may have grown (and moved) while adding the children
+    m_elements[index].subtreeSize = static_cast<unsigned int>(m_elements.size()) - index;
+}
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BaseElement.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+
+    // A single element of a FlattenedCard. The subtree rooted at the element at index i occupies the contiguous range
+    // [i, i + subtreeSize), and its first child (if any) is at i + 1.
+    struct FlattenedElement
+    {
+        // Points into the card owned by the FlattenedCard
+        BaseElement* element;
+        InternalId internalId;
+
+        // CardElementType::Unknown for actions, ActionType::Unsupported for card elements
+        CardElementType elementType;
+        ActionType actionType;
+
+        unsigned int parentIndex;
+        unsigned int subtreeSize;
+        unsigned int childCount;
+        unsigned int depth;
+    };
+
+    // Contiguous preorder view of a parsed card, for passes that visit every element (layout, hit testing, search,
+    // serialization) and would otherwise chase shared_ptrs through the virtual collection accessors.
+    //
+    // Top level body elements come first, followed by the card's actions, both at depth 0. Children of a Container,
+    // Column, ColumnSet, ImageSet and ActionSet follow their parent, and the body and actions of an Action.ShowCard card
+    // are children of the action. Fallback content and select actions aren't part of the view.
+    //
+    // The view reflects the card at the time it was built; it must be rebuilt if elements are added or removed.
+    class FlattenedCard
+    {
+    public:
+        static constexpr unsigned int NoIndex = ~0U;
+
+        FlattenedCard(std::shared_ptr<AdaptiveCard> card);
+
+        std::shared_ptr<AdaptiveCard> GetCard() const { return m_card; }
+        const std::vector<FlattenedElement>& GetElements() const { return m_elements; }
+        size_t GetCount() const { return m_elements.size(); }
+        const FlattenedElement& operator[](size_t index) const { return m_elements[index]; }
+
+        unsigned int GetFirstChild(unsigned int index) const;
+        unsigned int GetNextSibling(unsigned int index) const;
+        unsigned int FindByInternalId(InternalId internalId) const;
+
+    private:
+        void AddCard(const AdaptiveCard& card, unsigned int parentIndex, unsigned int depth);
+        void AddElement(BaseElement& element,
+                        CardElementType elementType,
+                        ActionType actionType,
+                        unsigned int parentIndex,
+                        unsigned int depth);
+        template<typename T>
+        void AddChildren(const std::vector<std::shared_ptr<T>>& children, unsigned int parentIndex, unsigned int depth);
+        void AddChildren(const std::vector<std::shared_ptr<BaseActionElement>>& actions, unsigned int parentIndex, unsigned int depth);
+
+        std::shared_ptr<AdaptiveCard> m_card;
+        std::vector<FlattenedElement> m_elements;
+    };
+}
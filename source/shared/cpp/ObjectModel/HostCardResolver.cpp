@@ -0,0 +1,493 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "HostCardResolver.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ElementParserRegistration.h"
+#include "FeatureRegistration.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "ParseResult.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "ToggleVisibilityAction.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    // ColumnSets only hold Columns and ImageSets only hold Images, so fallback content of any other type is dropped
+    bool IsOfType(const BaseCardElement&, const BaseCardElement*) { return true; }
+    bool IsOfType(const BaseCardElement& element, const Column*) { return element.GetElementType() == CardElementType::Column; }
+    bool IsOfType(const BaseCardElement& element, const Image*) { return element.GetElementType() == CardElementType::Image; }
+    bool IsOfType(const BaseActionElement&, const BaseActionElement*) { return true; }
+
+    template<typename T>
+    using ResolvedType = typename std::conditional<std::is_base_of<BaseActionElement, T>::value, BaseActionElement, BaseCardElement>::type;
+}
+
+namespace AdaptiveSharedNamespace
+{
+    std::shared_ptr<ParseResult> ResolveForHost(const std::shared_ptr<AdaptiveCard>& card,
+                                                const FeatureRegistration& featureRegistration,
+                                                const ElementParserRegistration& elementRegistration)
+    {
+        HostCardResolver resolver(featureRegistration, elementRegistration);
+        const auto resolvedCard = resolver.ResolveCard(card);
+
+        std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+        resolver.GetWarningSink().Flush(warnings);
+        return std::make_shared<ParseResult>(resolvedCard, warnings);
+    }
+
+    HostCardResolver::HostCardResolver(const FeatureRegistration& featureRegistration,
+                                       const ElementParserRegistration& elementRegistration) :
+        m_featureRegistration(featureRegistration),
+        m_elementRegistration(elementRegistration)
+    {
+    }
+
+    std::shared_ptr<AdaptiveCard> HostCardResolver::ResolveCard(const std::shared_ptr<AdaptiveCard>& card)
+    {
+        const auto resolvedCard = ResolveCardContents(card);
+        if (resolvedCard == card)
+        {
+            return card;
+        }
+
+        // The targets of the toggle visibility actions still refer to the elements of the source card, which may have
+        // been copied or dropped. The resolved card gets its own copies of the actions, whose targets are resolved
+        // against its index.
+        const auto copiedCard = CopyToggleVisibilityActions(resolvedCard);
+        for (const auto& target : m_copiedTargets)
+        {
+            const auto element = copiedCard->m_elementIdIndex.find(target->GetElementId());
+            target->SetElement(element != copiedCard->m_elementIdIndex.end() ? element->second : nullptr);
+        }
+        m_copiedTargets.clear();
+
+        return copiedCard;
+    }
+
+    std::shared_ptr<AdaptiveCard> HostCardResolver::ResolveCardContents(const std::shared_ptr<AdaptiveCard>& card)
+    {
+        // Elements of a card can't fall back to the element showing the card
+        std::vector<std::shared_ptr<BaseCardElement>> body;
+        std::vector<std::shared_ptr<BaseActionElement>> actions;
+        ResolveList(card->GetBody(), false, body);
+        ResolveList(card->GetActions(), false, actions);
+
+        if (body == card->GetBody() && actions == card->GetActions())
+        {
+            return card;
+        }
+
+        auto resolvedCard = std::make_shared<AdaptiveCard>(*card);
+        resolvedCard->m_body = std::move(body);
+        resolvedCard->m_actions = std::move(actions);
+
+        resolvedCard->m_elementIdIndex.clear();
+        IndexCard(*resolvedCard, *resolvedCard);
+
+        return resolvedCard;
+    }
+
+    bool HostCardResolver::IsSupported(const BaseCardElement& element) const
+    {
+        return element.GetElementType() != CardElementType::Unknown &&
+            m_elementRegistration.GetParser(element.GetElementTypeString()) != nullptr &&
+            element.MeetsRequirements(m_featureRegistration);
+    }
+
+    bool HostCardResolver::IsSupported(const BaseActionElement& action) const
+    {
+        return action.GetElementType() != ActionType::UnknownAction && action.MeetsRequirements(m_featureRegistration);
+    }
+
+    template<typename T>
+    HostCardResolver::Resolution HostCardResolver::ResolveElement(const std::shared_ptr<T>& element,
+                                                                  bool ancestorHasFallback,
+                                                                  std::shared_ptr<T>& resolved)
+    {
+        if (IsSupported(*element))
+        {
+            // Children may fall back to this element or to any of its ancestors
+            const bool hasFallback = ancestorHasFallback || element->GetFallbackType() != FallbackType::None;
+            if (ResolveChildren(element, hasFallback, resolved))
+            {
+                return Resolution::Keep;
+            }
+        }
+
+        return PerformFallback(element, ancestorHasFallback, resolved);
+    }
+
+    template<typename T>
+    HostCardResolver::Resolution HostCardResolver::PerformFallback(const std::shared_ptr<T>& element,
+                                                                   bool ancestorHasFallback,
+                                                                   std::shared_ptr<T>& resolved)
+    {
+        switch (element->GetFallbackType())
+        {
+        case FallbackType::Content:
+            m_warnings.AddWarning(WarningStatusCode::NoRendererForType,
+                                  "Performing fallback for element of type: ",
+                                  element->GetElementTypeString());
+            return ResolveElement(std::static_pointer_cast<T>(element->GetFallbackContent()), ancestorHasFallback, resolved);
+        case FallbackType::Drop:
+            m_warnings.AddWarning(WarningStatusCode::NoRendererForType,
+                                  "Dropping element for fallback of type: ",
+                                  element->GetElementTypeString());
+            return Resolution::Drop;
+        default:
+            if (ancestorHasFallback)
+            {
+                return Resolution::FallbackToAncestor;
+            }
+            m_warnings.AddWarning(WarningStatusCode::NoRendererForType, "No Renderer found for type: ", element->GetElementTypeString());
+            return Resolution::Drop;
+        }
+    }
+
+    bool HostCardResolver::ResolveChildren(const std::shared_ptr<BaseCardElement>& element,
+                                           bool hasFallback,
+                                           std::shared_ptr<BaseCardElement>& resolved)
+    {
+        switch (element->GetElementType())
+        {
+        case CardElementType::Container:
+            return ResolveCollection<Container>(element, [](auto& container) -> auto& { return container.GetItems(); }, hasFallback, resolved);
+        case CardElementType::Column:
+            return ResolveCollection<Column>(element, [](auto& column) -> auto& { return column.GetItems(); }, hasFallback, resolved);
+        case CardElementType::ColumnSet:
+            return ResolveCollection<ColumnSet>(element, [](auto& columnSet) -> auto& { return columnSet.GetColumns(); }, hasFallback, resolved);
+        case CardElementType::ImageSet:
+            return ResolveCollection<ImageSet>(element, [](auto& imageSet) -> auto& { return imageSet.GetImages(); }, hasFallback, resolved);
+        case CardElementType::ActionSet:
+            return ResolveCollection<ActionSet>(element, [](auto& actionSet) -> auto& { return actionSet.GetActions(); }, hasFallback, resolved);
+        default:
+            resolved = element;
+            return true;
+        }
+    }
+
+    bool HostCardResolver::ResolveChildren(const std::shared_ptr<BaseActionElement>& action,
+                                           bool /*hasFallback*/,
+                                           std::shared_ptr<BaseActionElement>& resolved)
+    {
+        resolved = action;
+        if (action->GetElementType() == ActionType::ShowCard)
+        {
+            const auto& showCardAction = static_cast<const ShowCardAction&>(*action);
+            const auto card = showCardAction.GetCard();
+            if (card != nullptr)
+            {
+                const auto resolvedCard = ResolveCardContents(card);
+                if (resolvedCard != card)
+                {
+                    auto resolvedAction = std::make_shared<ShowCardAction>(showCardAction);
+                    resolvedAction->SetCard(resolvedCard);
+                    resolved = resolvedAction;
+                }
+            }
+        }
+        return true;
+    }
+
+    template<typename T, typename TGetChildren>
+    bool HostCardResolver::ResolveCollection(const std::shared_ptr<BaseCardElement>& element,
+                                             TGetChildren getChildren,
+                                             bool hasFallback,
+                                             std::shared_ptr<BaseCardElement>& resolved)
+    {
+        const T& collection = static_cast<const T&>(*element);
+        typename std::decay<decltype(getChildren(collection))>::type children;
+        if (!ResolveList(getChildren(collection), hasFallback, children))
+        {
+            return false;
+        }
+
+        if (children == getChildren(collection))
+        {
+            resolved = element;
+        }
+        else
+        {
+            auto resolvedCollection = std::make_shared<T>(collection);
+            getChildren(*resolvedCollection) = std::move(children);
+            resolved = resolvedCollection;
+        }
+        return true;
+    }
+
+    template<typename T>
+    bool HostCardResolver::ResolveList(const std::vector<std::shared_ptr<T>>& children,
+                                       bool ancestorHasFallback,
+                                       std::vector<std::shared_ptr<T>>& resolved)
+    {
+        resolved.reserve(children.size());
+        for (const auto& child : children)
+        {
+            std::shared_ptr<ResolvedType<T>> resolvedChild;
+            switch (ResolveElement(std::shared_ptr<ResolvedType<T>>(child), ancestorHasFallback, resolvedChild))
+            {
+            case Resolution::Keep:
+                if (IsOfType(*resolvedChild, static_cast<const T*>(nullptr)))
+                {
+                    resolved.push_back(std::static_pointer_cast<T>(resolvedChild));
+                }
+                else
+                {
+                    m_warnings.AddWarning(WarningStatusCode::NoRendererForType,
+                                          "Dropping fallback content of unexpected type: ",
+                                          resolvedChild->GetElementTypeString());
+                }
+                break;
+            case Resolution::Drop:
+                break;
+            case Resolution::FallbackToAncestor:
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::shared_ptr<AdaptiveCard> HostCardResolver::CopyToggleVisibilityActions(const std::shared_ptr<AdaptiveCard>& card)
+    {
+        std::vector<std::shared_ptr<BaseCardElement>> body;
+        std::vector<std::shared_ptr<BaseActionElement>> actions;
+        const bool bodyCopied = CopyToggleVisibilityActions(card->m_body, body);
+        const bool actionsCopied = CopyToggleVisibilityActions(card->m_actions, actions);
+        const auto selectAction = card->m_selectAction ? CopyToggleVisibilityActions(card->m_selectAction) : nullptr;
+        if (!bodyCopied && !actionsCopied && selectAction == card->m_selectAction)
+        {
+            return card;
+        }
+
+        auto copiedCard = std::make_shared<AdaptiveCard>(*card);
+        if (bodyCopied)
+        {
+            copiedCard->m_body = std::move(body);
+        }
+        if (actionsCopied)
+        {
+            copiedCard->m_actions = std::move(actions);
+        }
+        copiedCard->m_selectAction = selectAction;
+
+        copiedCard->m_elementIdIndex.clear();
+        IndexCard(*copiedCard, *copiedCard);
+        return copiedCard;
+    }
+
+    std::shared_ptr<BaseCardElement> HostCardResolver::CopyToggleVisibilityActions(const std::shared_ptr<BaseCardElement>& element)
+    {
+        switch (element->GetElementType())
+        {
+        case CardElementType::Container:
+            return CopySelectAction<Container>(element, CopyChildren<Container>(element, [](auto& container) -> auto& {
+                                                   return container.GetItems();
+                                               }));
+        case CardElementType::Column:
+            return CopySelectAction<Column>(element, CopyChildren<Column>(element, [](auto& column) -> auto& {
+                                                return column.GetItems();
+                                            }));
+        case CardElementType::ColumnSet:
+            return CopySelectAction<ColumnSet>(element, CopyChildren<ColumnSet>(element, [](auto& columnSet) -> auto& {
+                                                   return columnSet.GetColumns();
+                                               }));
+        case CardElementType::ImageSet:
+            return CopyChildren<ImageSet>(element, [](auto& imageSet) -> auto& { return imageSet.GetImages(); });
+        case CardElementType::ActionSet:
+            return CopyChildren<ActionSet>(element, [](auto& actionSet) -> auto& { return actionSet.GetActions(); });
+        case CardElementType::RichTextBlock:
+            return CopyChildren<RichTextBlock>(element, [](auto& richTextBlock) -> auto& { return richTextBlock.GetInlines(); });
+        case CardElementType::Image:
+            return CopySelectAction<Image>(element, element);
+        default:
+            return element;
+        }
+    }
+
+    std::shared_ptr<BaseActionElement> HostCardResolver::CopyToggleVisibilityActions(const std::shared_ptr<BaseActionElement>& action)
+    {
+        switch (action->GetElementType())
+        {
+        case ActionType::ToggleVisibility:
+        {
+            auto copiedAction = std::make_shared<ToggleVisibilityAction>(static_cast<const ToggleVisibilityAction&>(*action));
+            for (auto& target : copiedAction->GetTargetElements())
+            {
+                target = std::make_shared<ToggleVisibilityTarget>(*target);
+                m_copiedTargets.push_back(target);
+            }
+            return copiedAction;
+        }
+        case ActionType::ShowCard:
+        {
+            const auto& showCardAction = static_cast<const ShowCardAction&>(*action);
+            const auto card = showCardAction.GetCard();
+            const auto copiedCard = card ? CopyToggleVisibilityActions(card) : nullptr;
+            if (copiedCard == card)
+            {
+                return action;
+            }
+
+            auto copiedAction = std::make_shared<ShowCardAction>(showCardAction);
+            copiedAction->SetCard(copiedCard);
+            return copiedAction;
+        }
+        default:
+            return action;
+        }
+    }
+
+    std::shared_ptr<Inline> HostCardResolver::CopyToggleVisibilityActions(const std::shared_ptr<Inline>& inlineElement)
+    {
+        if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+        {
+            return CopySelectAction<TextRun>(inlineElement, inlineElement);
+        }
+        return inlineElement;
+    }
+
+    template<typename T>
+    bool HostCardResolver::CopyToggleVisibilityActions(const std::vector<std::shared_ptr<T>>& elements,
+                                                       std::vector<std::shared_ptr<T>>& copies)
+    {
+        bool copied = false;
+        copies.reserve(elements.size());
+        for (const auto& element : elements)
+        {
+            copies.push_back(std::static_pointer_cast<T>(CopyToggleVisibilityActions(element)));
+            copied = copied || copies.back() != element;
+        }
+        return copied;
+    }
+
+    template<typename T, typename TGetChildren>
+    std::shared_ptr<BaseCardElement> HostCardResolver::CopyChildren(const std::shared_ptr<BaseCardElement>& element,
+                                                                    TGetChildren getChildren)
+    {
+        const T& parent = static_cast<const T&>(*element);
+        typename std::decay<decltype(getChildren(parent))>::type children;
+        if (!CopyToggleVisibilityActions(getChildren(parent), children))
+        {
+            return element;
+        }
+
+        auto copiedParent = std::make_shared<T>(parent);
+        getChildren(*copiedParent) = std::move(children);
+        return copiedParent;
+    }
+
+    template<typename T, typename TBase>
+    std::shared_ptr<TBase> HostCardResolver::CopySelectAction(const std::shared_ptr<TBase>& original, std::shared_ptr<TBase> copy)
+    {
+        const auto selectAction = static_cast<const T&>(*original).GetSelectAction();
+        const auto copiedAction = selectAction ? CopyToggleVisibilityActions(selectAction) : nullptr;
+        if (copiedAction == selectAction)
+        {
+            return copy;
+        }
+
+        if (copy == original)
+        {
+            copy = std::make_shared<T>(static_cast<const T&>(*original));
+        }
+        static_cast<T&>(*copy).SetSelectAction(copiedAction);
+        return copy;
+    }
+
+    template<typename T> void HostCardResolver::IndexElements(const std::vector<std::shared_ptr<T>>& elements, AdaptiveCard& card) const
+    {
+        for (const auto& element : elements)
+        {
+            IndexElement(element, card);
+        }
+    }
+
+    void HostCardResolver::IndexCard(const AdaptiveCard& source, AdaptiveCard& card) const
+    {
+        IndexElements(source.GetBody(), card);
+        IndexElements(source.GetActions(), card);
+        IndexElement(source.GetSelectAction(), card);
+    }
+
+    void HostCardResolver::IndexElement(const std::shared_ptr<BaseCardElement>& element, AdaptiveCard& card) const
+    {
+        if (!element->GetId().empty())
+        {
+            card.m_elementIdIndex.emplace(element->GetId(), element);
+        }
+
+        switch (element->GetElementType())
+        {
+        case CardElementType::Container:
+            IndexElements(static_cast<const Container&>(*element).GetItems(), card);
+            IndexElement(static_cast<const Container&>(*element).GetSelectAction(), card);
+            break;
+        case CardElementType::Column:
+            IndexElements(static_cast<const Column&>(*element).GetItems(), card);
+            IndexElement(static_cast<const Column&>(*element).GetSelectAction(), card);
+            break;
+        case CardElementType::ColumnSet:
+            IndexElements(static_cast<const ColumnSet&>(*element).GetColumns(), card);
+            IndexElement(static_cast<const ColumnSet&>(*element).GetSelectAction(), card);
+            break;
+        case CardElementType::ImageSet:
+            IndexElements(static_cast<const ImageSet&>(*element).GetImages(), card);
+            break;
+        case CardElementType::ActionSet:
+            IndexElements(static_cast<const ActionSet&>(*element).GetActions(), card);
+            break;
+        case CardElementType::RichTextBlock:
+            IndexElements(static_cast<const RichTextBlock&>(*element).GetInlines(), card);
+            break;
+        case CardElementType::Image:
+            IndexElement(static_cast<const Image&>(*element).GetSelectAction(), card);
+            break;
+        case CardElementType::TextInput:
+            IndexElement(static_cast<const TextInput&>(*element).GetInlineAction(), card);
+            break;
+        default:
+            break;
+        }
+    }
+
+    void HostCardResolver::IndexElement(const std::shared_ptr<BaseActionElement>& action, AdaptiveCard& card) const
+    {
+        if (action == nullptr)
+        {
+            return;
+        }
+
+        if (!action->GetId().empty())
+        {
+            card.m_elementIdIndex.emplace(action->GetId(), action);
+        }
+
+        if (action->GetElementType() == ActionType::ShowCard)
+        {
+            const auto showCard = static_cast<const ShowCardAction&>(*action).GetCard();
+            if (showCard != nullptr)
+            {
+                IndexCard(*showCard, card);
+            }
+        }
+    }
+
+    void HostCardResolver::IndexElement(const std::shared_ptr<Inline>& inlineElement, AdaptiveCard& card) const
+    {
+        if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+        {
+            IndexElement(static_cast<const TextRun&>(*inlineElement).GetSelectAction(), card);
+        }
+    }
+}
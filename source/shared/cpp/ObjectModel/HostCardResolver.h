@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BaseActionElement.h"
+#include "BaseCardElement.h"
+#include "ParseWarningSink.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class ElementParserRegistration;
+    class FeatureRegistration;
+    class Inline;
+    class ParseResult;
+    class ToggleVisibilityTarget;
+
+    // Performs fallback for a host ahead of rendering. Every element of the returned card is one the host supports
+    // (its type is registered and its requirements are met), so repeated renders of the card for the same host don't
+    // need to evaluate requirements or fallback again.
+    //
+    // Fallback follows the rules renderers apply while rendering: an unsupported element is replaced by its fallback
+    // content (which is resolved the same way), dropped when its fallback is "drop", and otherwise makes the nearest
+    // ancestor with fallback fall back in turn. Elements with no such ancestor are dropped with a warning.
+    //
+    // The source card isn't modified. Elements that don't change are shared with it, and collection elements and
+    // Action.ShowCard cards with changed children are copied. The element id index of the resolved card only contains
+    // the elements that remain. Action.ToggleVisibility actions (and the elements holding them) are copied too, so that
+    // their ToggleVisibilityTarget element handles refer to the elements of the resolved card.
+    std::shared_ptr<ParseResult> ResolveForHost(const std::shared_ptr<AdaptiveCard>& card,
+                                                const FeatureRegistration& featureRegistration,
+                                                const ElementParserRegistration& elementRegistration);
+
+    class HostCardResolver
+    {
+    public:
+        HostCardResolver(const FeatureRegistration& featureRegistration, const ElementParserRegistration& elementRegistration);
+
+        std::shared_ptr<AdaptiveCard> ResolveCard(const std::shared_ptr<AdaptiveCard>& card);
+        ParseWarningSink& GetWarningSink() { return m_warnings; }
+
+    private:
+        enum class Resolution
+        {
+            Keep,
+            Drop,
+            FallbackToAncestor
+        };
+
+        std::shared_ptr<AdaptiveCard> ResolveCardContents(const std::shared_ptr<AdaptiveCard>& card);
+
+        bool IsSupported(const BaseCardElement& element) const;
+        bool IsSupported(const BaseActionElement& action) const;
+
+        template<typename T>
+        Resolution ResolveElement(const std::shared_ptr<T>& element, bool ancestorHasFallback, std::shared_ptr<T>& resolved);
+        template<typename T>
+        Resolution PerformFallback(const std::shared_ptr<T>& element, bool ancestorHasFallback, std::shared_ptr<T>& resolved);
+
+        // Return false when one of the children requires the element to fall back
+        bool ResolveChildren(const std::shared_ptr<BaseCardElement>& element, bool hasFallback, std::shared_ptr<BaseCardElement>& resolved);
+        bool ResolveChildren(const std::shared_ptr<BaseActionElement>& action, bool hasFallback, std::shared_ptr<BaseActionElement>& resolved);
+        template<typename T, typename TGetChildren>
+        bool ResolveCollection(const std::shared_ptr<BaseCardElement>& element,
+                               TGetChildren getChildren,
+                               bool hasFallback,
+                               std::shared_ptr<BaseCardElement>& resolved);
+        template<typename T>
+        bool ResolveList(const std::vector<std::shared_ptr<T>>& children, bool ancestorHasFallback, std::vector<std::shared_ptr<T>>& resolved);
+
+        // Return a copy of the element with copies of the toggle visibility actions it holds, or the element itself if
+        // it holds none. The targets of the copied actions are added to m_copiedTargets.
+        std::shared_ptr<AdaptiveCard> CopyToggleVisibilityActions(const std::shared_ptr<AdaptiveCard>& card);
+        std::shared_ptr<BaseCardElement> CopyToggleVisibilityActions(const std::shared_ptr<BaseCardElement>& element);
+        std::shared_ptr<BaseActionElement> CopyToggleVisibilityActions(const std::shared_ptr<BaseActionElement>& action);
+        std::shared_ptr<Inline> CopyToggleVisibilityActions(const std::shared_ptr<Inline>& inlineElement);
+        // Return whether any of the elements was copied
+        template<typename T>
+        bool CopyToggleVisibilityActions(const std::vector<std::shared_ptr<T>>& elements, std::vector<std::shared_ptr<T>>& copies);
+        template<typename T, typename TGetChildren>
+        std::shared_ptr<BaseCardElement> CopyChildren(const std::shared_ptr<BaseCardElement>& element, TGetChildren getChildren);
+        // copy is either original or a copy of it made already
+        template<typename T, typename TBase>
+        std::shared_ptr<TBase> CopySelectAction(const std::shared_ptr<TBase>& original, std::shared_ptr<TBase> copy);
+
+        // Indexes the elements and actions of source into card, select and inline actions included, as parsing does
+        void IndexCard(const AdaptiveCard& source, AdaptiveCard& card) const;
+        void IndexElement(const std::shared_ptr<BaseCardElement>& element, AdaptiveCard& card) const;
+        void IndexElement(const std::shared_ptr<BaseActionElement>& action, AdaptiveCard& card) const;
+        void IndexElement(const std::shared_ptr<Inline>& inlineElement, AdaptiveCard& card) const;
+        template<typename T> void IndexElements(const std::vector<std::shared_ptr<T>>& elements, AdaptiveCard& card) const;
+
+        const FeatureRegistration& m_featureRegistration;
+        const ElementParserRegistration& m_elementRegistration;
+        ParseWarningSink m_warnings;
+        std::vector<std::shared_ptr<ToggleVisibilityTarget>> m_copiedTargets;
+    };
+}
@@ -3,15 +3,25 @@
 #include "pch.h"
 #include "HostConfig.h"
 #include "ParseUtil.h"
+#include "ParseObserver.h"
 
 using namespace AdaptiveSharedNamespace;
 
 HostConfig HostConfig::DeserializeFromString(const std::string& jsonString)
 {
-    return HostConfig::Deserialize(ParseUtil::GetJsonValueFromString(jsonString));
+    const auto json = ParseObserver::Observe(ParseEventKind::JsonRead, jsonString.size(), [&]() {
+        return ParseUtil::GetJsonValueFromString(jsonString);
+    });
+    return HostConfig::Deserialize(json);
 }
 
 HostConfig HostConfig::Deserialize(const Json::Value& json)
+{
+    const size_t bytes = (json.getOffsetLimit() > json.getOffsetStart()) ? json.getOffsetLimit() - json.getOffsetStart() : 0;
+    return ParseObserver::Observe(ParseEventKind::HostConfig, bytes, [&]() { return DeserializeOverDefaults(json); });
+}
+
+HostConfig HostConfig::DeserializeOverDefaults(const Json::Value& json)
 {
     HostConfig result;
     std::string fontFamily = ParseUtil::GetString(json, AdaptiveCardSchemaKey::FontFamily);
@@ -667,14 +677,14 @@ unsigned int HostConfig::GetBorderThickness(ContainerStyle style) const
     return GetContainerStyle(style).borderThickness;
 }
 
-std::string HostConfig::GetFontFamily() const
+const std::string& HostConfig::GetFontFamily() const
 {
     return _fontFamily;
 }
 
-void HostConfig::SetFontFamily(const std::string& value)
+void HostConfig::SetFontFamily(std::string value)
 {
-    _fontFamily = value;
+    _fontFamily = std::move(value);
 }
 
 FontSizesConfig HostConfig::GetFontSizes() const
@@ -717,14 +727,14 @@ void HostConfig::SetSupportsInteractivity(const bool value)
     _supportsInteractivity = value;
 }
 
-std::string HostConfig::GetImageBaseUrl() const
+const std::string& HostConfig::GetImageBaseUrl() const
 {
     return _imageBaseUrl;
 }
 
-void HostConfig::SetImageBaseUrl(const std::string& value)
+void HostConfig::SetImageBaseUrl(std::string value)
 {
-    _imageBaseUrl = value;
+    _imageBaseUrl = std::move(value);
 }
 
 ImageSizesConfig HostConfig::GetImageSizes() const
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "pch.h"
+#include <climits>
 
 namespace AdaptiveSharedNamespace
 {
@@ -316,8 +317,8 @@ namespace AdaptiveSharedNamespace
         std::string GetBorderColor(ContainerStyle style) const;
         unsigned int GetBorderThickness(ContainerStyle style) const;
 
-        std::string GetFontFamily() const;
-        void SetFontFamily(const std::string& value);
+        const std::string& GetFontFamily() const;
+        void SetFontFamily(std::string value);
 
         FontSizesConfig GetFontSizes() const;
         void SetFontSizes(const FontSizesConfig value);
@@ -331,8 +332,8 @@ namespace AdaptiveSharedNamespace
         bool GetSupportsInteractivity() const;
         void SetSupportsInteractivity(const bool value);
 
-        std::string GetImageBaseUrl() const;
-        void SetImageBaseUrl(const std::string& value);
+        const std::string& GetImageBaseUrl() const;
+        void SetImageBaseUrl(std::string value);
 
         ImageSizesConfig GetImageSizes() const;
         void SetImageSizes(const ImageSizesConfig value);
@@ -365,6 +366,8 @@ namespace AdaptiveSharedNamespace
         void SetMedia(const MediaConfig value);
 
     private:
+        static HostConfig DeserializeOverDefaults(const Json::Value& json);
+
         const ContainerStyleDefinition& GetContainerStyle(ContainerStyle style) const;
         const ColorConfig& GetContainerColorConfig(const ColorsConfig& colors, ForegroundColor color) const;
 
@@ -12,7 +12,6 @@ Image::Image() :
     BaseCardElement(CardElementType::Image), m_imageStyle(ImageStyle::Default), m_imageSize(ImageSize::None),
     m_pixelWidth(0), m_pixelHeight(0), m_hAlignment(HorizontalAlignment::Left)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value Image::SerializeToJsonValue() const
@@ -57,7 +56,7 @@ Json::Value Image::SerializeToJsonValue() const
 
     if (!m_backgroundColor.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor)] = m_backgroundColor;
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor)] = m_backgroundColor.Get();
     }
 
     if (m_hAlignment != HorizontalAlignment::Left)
@@ -79,24 +78,29 @@ Json::Value Image::SerializeToJsonValue() const
     return root;
 }
 
-std::string Image::GetUrl() const
+const std::string& Image::GetUrl() const
 {
     return m_url;
 }
 
-void Image::SetUrl(const std::string& value)
+void Image::SetUrl(std::string value)
 {
-    m_url = value;
+    m_url = std::move(value);
 }
 
-std::string Image::GetBackgroundColor() const
+const std::string& Image::GetBackgroundColor() const
 {
-    return m_backgroundColor;
+    return m_backgroundColor.Get();
 }
 
-void Image::SetBackgroundColor(const std::string& value)
+void Image::SetBackgroundColor(std::string value)
 {
-    m_backgroundColor = value;
+    m_backgroundColor = InternedString(std::move(value));
+}
+
+void Image::SetBackgroundColor(InternedString value)
+{
+    m_backgroundColor = std::move(value);
 }
 
 ImageStyle Image::GetImageStyle() const
@@ -119,14 +123,14 @@ void Image::SetImageSize(const ImageSize value)
     m_imageSize = value;
 }
 
-std::string Image::GetAltText() const
+const std::string& Image::GetAltText() const
 {
     return m_altText;
 }
 
-void Image::SetAltText(const std::string& value)
+void Image::SetAltText(std::string value)
 {
-    m_altText = value;
+    m_altText = std::move(value);
 }
 
 HorizontalAlignment Image::GetHorizontalAlignment() const
@@ -169,6 +173,55 @@ void Image::SetPixelHeight(unsigned int value)
     m_pixelHeight = value;
 }
 
+void Image::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(Image));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_url);
+    usage.AddString(m_altText);
+    if (m_selectAction)
+    {
+        m_selectAction->AccumulateMemoryUsage(usage);
+    }
+}
+
+template<typename TPolicy>
+void ImageParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    BaseCardElement::ParseProperties(policy, context, json);
+
+    policy.String(json, AdaptiveCardSchemaKey::Url, &Image::SetUrl, true);
+    // Invalid colors are warned about whether or not the image is built
+    std::string backgroundColor =
+        ValidateColor(ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundColor), context);
+    if (Image* image = policy.Object())
+    {
+        image->SetBackgroundColor(context.Intern(std::move(backgroundColor)));
+    }
+    policy.Enum(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleFromString, &Image::SetImageStyle);
+    policy.String(json, AdaptiveCardSchemaKey::AltText, &Image::SetAltText);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::HorizontalAlignment,
+                HorizontalAlignment::Left,
+                HorizontalAlignmentFromString,
+                &Image::SetHorizontalAlignment);
+
+    const int pixelWidth = ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Width), context);
+    const int pixelHeight = ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Height), context);
+    if (pixelWidth != 0 || pixelHeight != 0)
+    {
+        policy.Set(&Image::SetPixelWidth, pixelWidth);
+        policy.Set(&Image::SetPixelHeight, pixelHeight);
+    }
+    else
+    {
+        policy.Enum(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeFromString, &Image::SetImageSize);
+    }
+
+    // Parse optional selectAction
+    policy.Action(context, json, AdaptiveCardSchemaKey::SelectAction, &Image::SetSelectAction);
+}
+
 std::shared_ptr<BaseCardElement> ImageParser::DeserializeFromString(ParseContext& context, const std::string& jsonString)
 {
     return ImageParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
@@ -180,62 +233,27 @@ std::shared_ptr<BaseCardElement> ImageParser::Deserialize(ParseContext& context,
     return ImageParser::DeserializeWithoutCheckingType(context, json);
 }
 
-std::shared_ptr<BaseCardElement>
-ImageParser::DeserializeWithoutCheckingType(ParseContext& context, const Json::Value& json)
+bool ImageParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<Image> image = BaseCardElement::Deserialize<Image>(context, json);
-
-    image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
-    image->SetBackgroundColor(ValidateColor(ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundColor), context.warnings));
-    image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleFromString));
-    image->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText));
-    image->SetHorizontalAlignment(ParseUtil::GetEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentFromString));
-
-    std::vector<std::string> requestedDimensions;
-    requestedDimensions.push_back(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Width));
-    requestedDimensions.push_back(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Height));
-    std::vector<int> parsedDimensions;
-
-    for (auto eachDimension : requestedDimensions)
-    {
-        const int parsedDimension = ParseSizeForPixelSize(eachDimension, &context.warnings);
-        parsedDimensions.push_back(parsedDimension);
-    }
-
-    if (parsedDimensions.at(0) != 0 || parsedDimensions.at(1) != 0)
+    // The images of an ImageSet are validated without the type they imply
+    if (!json.isObject() || json.isMember(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)))
     {
-        image->SetPixelWidth(parsedDimensions.at(0));
-        image->SetPixelHeight(parsedDimensions.at(1));
-    }
-    else
-    {
-        image->SetImageSize(ParseUtil::GetEnumValue<ImageSize>(json, AdaptiveCardSchemaKey::Size, ImageSize::None, ImageSizeFromString));
+        ParseUtil::ExpectTypeString(json, CardElementType::Image);
     }
 
-    // Parse optional selectAction
-    image->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
-    return image;
+    ParseProperties(ValidatePolicy<Image>(), context, json);
+    return true;
 }
 
-void Image::PopulateKnownPropertiesSet()
+std::shared_ptr<BaseCardElement>
+ImageParser::DeserializeWithoutCheckingType(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction)});
+    std::shared_ptr<Image> image = std::make_shared<Image>();
+    ParseProperties(BuildPolicy<Image>(*image), context, json);
+    return image;
 }
 
 void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    RemoteResourceInformation imageResourceInfo;
-    imageResourceInfo.url = GetUrl();
-    imageResourceInfo.mimeType = "image";
-    resourceInfo.push_back(imageResourceInfo);
-    return;
+    resourceInfo.push_back({m_url, "image"});
 }
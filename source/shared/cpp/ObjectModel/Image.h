@@ -21,11 +21,12 @@ namespace AdaptiveSharedNamespace
 
         Json::Value SerializeToJsonValue() const override;
 
-        std::string GetUrl() const;
-        void SetUrl(const std::string& value);
+        const std::string& GetUrl() const;
+        void SetUrl(std::string value);
 
-        std::string GetBackgroundColor() const;
-        void SetBackgroundColor(const std::string& value);
+        const std::string& GetBackgroundColor() const;
+        void SetBackgroundColor(std::string value);
+        void SetBackgroundColor(InternedString value);
 
         ImageStyle GetImageStyle() const;
         void SetImageStyle(const ImageStyle value);
@@ -33,8 +34,8 @@ namespace AdaptiveSharedNamespace
         ImageSize GetImageSize() const;
         void SetImageSize(const ImageSize value);
 
-        std::string GetAltText() const;
-        void SetAltText(const std::string& value);
+        const std::string& GetAltText() const;
+        void SetAltText(std::string value);
 
         HorizontalAlignment GetHorizontalAlignment() const;
         void SetHorizontalAlignment(const HorizontalAlignment value);
@@ -49,12 +50,11 @@ namespace AdaptiveSharedNamespace
         void SetPixelHeight(unsigned int value);
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::string m_url;
-        std::string m_backgroundColor;
+        InternedString m_backgroundColor;
         ImageStyle m_imageStyle;
         ImageSize m_imageSize;
         unsigned int m_pixelWidth;
@@ -77,5 +77,10 @@ namespace AdaptiveSharedNamespace
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeWithoutCheckingType(ParseContext& context, const Json::Value& root);
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
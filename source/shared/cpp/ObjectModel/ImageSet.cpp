@@ -10,7 +10,6 @@ using namespace AdaptiveSharedNamespace;
 
 ImageSet::ImageSet() : BaseCardElement(CardElementType::ImageSet), m_imageSize(ImageSize::None)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ImageSize ImageSet::GetImageSize() const
@@ -52,23 +51,36 @@ Json::Value ImageSet::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& context, const Json::Value& value)
+void ImageSet::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    ParseUtil::ExpectTypeString(value, CardElementType::ImageSet);
+    usage.AddObject(sizeof(ImageSet));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_images);
+}
+
+template<typename TPolicy>
+void ImageSetParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    ParseUtil::ExpectTypeString(json, CardElementType::ImageSet);
 
-    auto imageSet = BaseCardElement::Deserialize<ImageSet>(context, value);
+    BaseCardElement::ParseProperties(policy, context, json);
     // Get ImageSize
-    imageSet->m_imageSize =
-        ParseUtil::GetEnumValue<ImageSize>(value, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeFromString);
+    policy.Enum(json, AdaptiveCardSchemaKey::ImageSize, ImageSize::None, ImageSizeFromString, &ImageSet::m_imageSize);
 
     // Parse Images
-    auto images = ParseUtil::GetElementCollection<Image>(
-        true, context, value, AdaptiveCardSchemaKey::Images, true, CardElementTypeToString(CardElementType::Image));
+    policy.template Elements<Image>(true,
+                                    context,
+                                    json,
+                                    AdaptiveCardSchemaKey::Images,
+                                    &ImageSet::m_images,
+                                    true,
+                                    CardElementTypeToString(CardElementType::Image));
+}
 
-    for (auto image : images)
-    {
-        imageSet->m_images.push_back(std::static_pointer_cast<Image>(image));
-    }
+std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto imageSet = std::make_shared<ImageSet>();
+    ParseProperties(BuildPolicy<ImageSet>(*imageSet), context, json);
 
     return imageSet;
 }
@@ -78,10 +90,11 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
     return ImageSetParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ImageSet::PopulateKnownPropertiesSet()
+bool ImageSetParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
+    ParseProperties(ValidatePolicy<ImageSet>(), context, json);
+
+    return true;
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
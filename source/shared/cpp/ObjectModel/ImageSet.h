@@ -30,10 +30,9 @@ namespace AdaptiveSharedNamespace
         const std::vector<std::shared_ptr<Image>>& GetImages() const;
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::vector<std::shared_ptr<Image>> m_images;
         ImageSize m_imageSize;
     };
@@ -50,5 +49,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -8,7 +8,6 @@ using namespace AdaptiveSharedNamespace;
 
 Inline::Inline(InlineElementType type) : m_type(type)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value Inline::SerializeToJsonValue() const
@@ -35,9 +34,9 @@ Json::Value Inline::GetAdditionalProperties() const
     return m_additionalProperties;
 }
 
-void Inline::SetAdditionalProperties(Json::Value const& value)
+void Inline::SetAdditionalProperties(Json::Value value)
 {
-    m_additionalProperties = value;
+    m_additionalProperties = std::move(value);
 }
 
 std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::Value& json)
@@ -46,7 +45,17 @@ std::shared_ptr<Inline> Inline::Deserialize(ParseContext& context, const Json::V
     return TextRun::Deserialize(context, json);
 }
 
+void Inline::Validate(ParseContext& context, const Json::Value& json)
+{
+    TextRun::Validate(context, json);
+}
+
 void Inline::PopulateKnownPropertiesSet()
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
+}
+
+void Inline::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddStringSet(m_knownProperties);
+    usage.AddJson(m_additionalProperties);
 }
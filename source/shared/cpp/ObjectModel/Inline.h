@@ -21,17 +21,21 @@ namespace AdaptiveSharedNamespace
         virtual ~Inline() = default;
 
         virtual Json::Value SerializeToJsonValue() const;
+        virtual void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
         // Element type
         virtual const InlineElementType GetInlineType() const;
         std::string GetInlineTypeString() const;
 
         static std::shared_ptr<Inline> Deserialize(ParseContext& context, const Json::Value& root);
+        static void Validate(ParseContext& context, const Json::Value& root);
 
         Json::Value GetAdditionalProperties() const;
-        void SetAdditionalProperties(const Json::Value& additionalProperties);
+        void SetAdditionalProperties(Json::Value additionalProperties);
 
     protected:
+        // Like BaseElement::PopulateKnownPropertiesSet, parsing calls this before it collects the additional
+        // properties; the properties of the built-in inlines come from the schema
         virtual void PopulateKnownPropertiesSet();
         std::unordered_set<std::string> m_knownProperties;
         Json::Value m_additionalProperties;
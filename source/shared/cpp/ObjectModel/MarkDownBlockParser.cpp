@@ -1,14 +1,29 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
-#include <iostream>
 #include "MarkDownBlockParser.h"
 
 using namespace AdaptiveSharedNamespace;
 
+namespace
+{
+    // Links and lists hold blocks, which may be links and lists again. Past this depth their syntax is treated as text,
+    // so that a run such as [[[[ or - - - - isn't parsed as deeply as it's long, with each level copying the ones it holds.
+    constexpr unsigned int c_maxNestedBlocks = 16;
+}
+
 // Parses according to each key words
-void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
+void MarkDownBlockParser::ParseBlock(MarkDownStream& stream)
 {
+    if (stream.GetNestedBlocks() >= c_maxNestedBlocks &&
+        (stream.peek() == '[' || stream.peek() == '-' || IsDigit(static_cast<char>(stream.peek()))))
+    {
+        MarkDownSpan token;
+        stream.get(token);
+        m_parsedResult.AddNewTokenToParsedResult(token);
+        return;
+    }
+
     switch (stream.peek())
     {
         // parses link
@@ -16,7 +31,9 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     {
         LinkParser linkParser;
         // do syntax check of link
+        stream.EnterNestedBlock();
         linkParser.Match(stream);
+        stream.LeaveNestedBlock();
         // append link result to the rest
         m_parsedResult.AppendParseResult(linkParser.GetParsedResult());
         break;
@@ -27,18 +44,18 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     case ')':
     {
         // add these char as token to code gen list
-        char streamChar;
-        stream.get(streamChar);
-        m_parsedResult.AddNewTokenToParsedResult(streamChar);
+        MarkDownSpan token;
+        stream.get(token);
+        m_parsedResult.AddNewTokenToParsedResult(token);
         break;
     }
     case '\n':
     case '\r':
     {
         // add new line char as token to code gen list
-        char streamChar;
-        stream.get(streamChar);
-        m_parsedResult.AddNewLineTokenToParsedResult(streamChar);
+        MarkDownSpan token;
+        stream.get(token);
+        m_parsedResult.AddNewLineTokenToParsedResult(token);
         break;
     }
     // handles list block
@@ -46,7 +63,9 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     {
         ListParser listParser;
         // do syntax check of list
+        stream.EnterNestedBlock();
         listParser.Match(stream);
+        stream.LeaveNestedBlock();
         // append list result to the rest
         m_parsedResult.AppendParseResult(listParser.GetParsedResult());
         break;
@@ -64,7 +83,9 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     {
         OrderedListParser orderedListParser;
         // do syntax check of list
+        stream.EnterNestedBlock();
         orderedListParser.Match(stream);
+        stream.LeaveNestedBlock();
         // append list result to the rest
         m_parsedResult.AppendParseResult(orderedListParser.GetParsedResult());
         break;
@@ -72,10 +93,13 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
     // everything else is treated as normal text + emphasis
     default:
         EmphasisParser emphasisParser;
+        // text and emphasis are the most common blocks, so rather than appending its result to the rest,
+        // the parser appends its tokens to the rest as they're captured
+        std::swap(emphasisParser.GetParsedResult(), m_parsedResult);
         // do syntax check of normal text + emphasis
         emphasisParser.Match(stream);
-        // append result to the rest
-        m_parsedResult.AppendParseResult(emphasisParser.GetParsedResult());
+        std::swap(emphasisParser.GetParsedResult(), m_parsedResult);
+        m_parsedResult.SetIsCaptured(false);
     }
 }
 
@@ -84,16 +108,17 @@ void MarkDownBlockParser::ParseBlock(std::stringstream& stream)
 // capture until it can't capture anymore.
 // it moves two states, emphasis state and text state,
 // at each transition of state, one token is captured
-void EmphasisParser::Match(std::stringstream& stream)
+void EmphasisParser::Match(MarkDownStream& stream)
 {
     while (m_current_state != EmphasisState::Captured)
     {
-        m_current_state = m_stateMachine.at(m_current_state)(*this, stream, m_current_token);
+        m_current_state = (m_current_state == EmphasisState::Text) ? MatchText(*this, stream, m_current_token) :
+                                                                      MatchEmphasis(*this, stream, m_current_token);
     }
 }
 
 /// captures text until it see emphasis character. When it does, switch to Emphasis state
-EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser, std::stringstream& stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser, MarkDownStream& stream, MarkDownSpan& token)
 {
     const auto currentChar = static_cast<char>(stream.peek());
 
@@ -118,23 +143,26 @@ EmphasisParser::EmphasisState EmphasisParser::MatchText(EmphasisParser& parser,
         }
 
         parser.UpdateCurrentEmphasisRunState(emphasisType);
-        char streamChar;
-        stream.get(streamChar);
-        token += streamChar;
+        stream.get(token);
         return EmphasisState::Emphasis;
     }
     else
     {
-        parser.UpdateLookBehind(currentChar);
-        char streamChar;
-        stream.get(streamChar);
-        token += streamChar;
+        // take the rest of the text up to the next keyword or delimiter in one step
+        auto ch = currentChar;
+        do
+        {
+            parser.UpdateLookBehind(ch);
+            stream.get(token);
+            ch = static_cast<char>(stream.peek());
+        } while (!stream.eof() && ch != '[' && ch != ']' && ch != ')' && ch != '\n' && ch != '\r' &&
+                 !parser.IsMarkDownDelimiter(ch));
         return EmphasisState::Text;
     }
 }
 
 /// captures text until it see non-emphasis character. When it does, switch to text state
-EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& parser, std::stringstream& stream, std::string& token)
+EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& parser, MarkDownStream& stream, MarkDownSpan& token)
 {
     // key word is encountered, flush what is being processed, and have those keyword
     // handled by ParseBlock()
@@ -152,14 +180,17 @@ EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& pars
     if (parser.IsMarkDownDelimiter(currentChar))
     {
         const DelimiterType emphasisType = EmphasisParser::GetDelimiterTypeForChar(currentChar);
-        if (parser.IsEmphasisDelimiterRun(emphasisType))
+        if (!parser.IsEmphasisDelimiterRun(emphasisType))
         {
-            parser.UpdateCurrentEmphasisRunState(emphasisType);
+            // a run of the other delimiter follows, such as _ in *_, so capture the current run before starting it
+            parser.CaptureEmphasisToken(currentChar, token);
+            parser.ResetCurrentEmphasisState();
+            stream.unget();
+            parser.UpdateLookBehind(static_cast<char>(stream.get()));
         }
 
-        char streamChar;
-        stream.get(streamChar);
-        token += streamChar;
+        parser.UpdateCurrentEmphasisRunState(emphasisType);
+        stream.get(token);
     }
     /// delimiter run is ended, capture the current accumulated token as emphasis
     else
@@ -174,9 +205,7 @@ EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& pars
 
         parser.ResetCurrentEmphasisState();
         parser.UpdateLookBehind(static_cast<char>(stream.peek()));
-        char streamChar;
-        stream.get(streamChar);
-        token += streamChar;
+        stream.get(token);
         return EmphasisState::Text;
     }
     return EmphasisState::Emphasis;
@@ -184,7 +213,7 @@ EmphasisParser::EmphasisState EmphasisParser::MatchEmphasis(EmphasisParser& pars
 
 // Captures remaining charaters in given token
 // and causes the emphasis parsing to terminate
-void EmphasisParser::Flush(char ch, std::string& currentToken)
+void EmphasisParser::Flush(char ch, MarkDownSpan& currentToken)
 {
     if (m_current_state == EmphasisState::Emphasis)
     {
@@ -203,16 +232,14 @@ bool EmphasisParser::IsMarkDownDelimiter(char ch) const
     return ((ch == '*' || ch == '_') && (m_lookBehind != DelimiterType::Escape));
 }
 
-void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken(std::string& currentToken)
+void EmphasisParser::CaptureCurrentCollectedStringAsRegularToken(MarkDownSpan& currentToken)
 {
     if (currentToken.empty())
     {
         return;
     }
 
-    std::shared_ptr<MarkDownHtmlGenerator> codeGen = std::make_shared<MarkDownStringHtmlGenerator>(currentToken);
-
-    m_parsedResult.AppendToTokens(codeGen);
+    m_parsedResult.AppendToTokens(MarkDownHtmlGenerator(MarkDownHtmlGenerator::TokenType::Text, currentToken));
 
     currentToken.clear();
 }
@@ -274,25 +301,15 @@ bool EmphasisParser::IsRightEmphasisDelimiter(const char ch) const
     return false;
 }
 
-bool EmphasisParser::TryCapturingRightEmphasisToken(char ch, std::string& currentToken)
+bool EmphasisParser::TryCapturingRightEmphasisToken(char ch, MarkDownSpan& currentToken)
 {
     if (IsRightEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen = nullptr;
-        // right emphasis can be also left emphasis
-        if (IsLeftEmphasisDelimiter(ch))
-        {
-            // since it is both left and right emphasis, create one accordingly
-            codeGen = std::make_shared<MarkDownLeftAndRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-        }
-        else
-        {
-            codeGen = std::make_shared<MarkDownRightEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-        }
-
-        m_parsedResult.AppendToLookUpTable(codeGen);
+        // right emphasis can be also left emphasis, if so, create one accordingly
+        const auto type = IsLeftEmphasisDelimiter(ch) ? MarkDownHtmlGenerator::TokenType::LeftAndRightEmphasis :
+                                                        MarkDownHtmlGenerator::TokenType::RightEmphasis;
 
-        m_parsedResult.AppendToTokens(codeGen);
+        m_parsedResult.AppendEmphasisToken(MarkDownHtmlGenerator(type, currentToken, m_delimiterCnts, m_currentDelimiterType));
 
         currentToken.clear();
 
@@ -301,17 +318,15 @@ bool EmphasisParser::TryCapturingRightEmphasisToken(char ch, std::string& curren
     return false;
 }
 
-bool EmphasisParser::TryCapturingLeftEmphasisToken(char ch, std::string& currentToken)
+bool EmphasisParser::TryCapturingLeftEmphasisToken(char ch, MarkDownSpan& currentToken)
 {
     // left emphasis detected, save emphasis for later reference
     if (IsLeftEmphasisDelimiter(ch))
     {
-        std::shared_ptr<MarkDownEmphasisHtmlGenerator> codeGen =
-            std::make_shared<MarkDownLeftEmphasisHtmlGenerator>(currentToken, m_delimiterCnts, m_currentDelimiterType);
-
-        m_parsedResult.AppendToLookUpTable(codeGen);
-
-        m_parsedResult.AppendToTokens(codeGen);
+        m_parsedResult.AppendEmphasisToken(MarkDownHtmlGenerator(MarkDownHtmlGenerator::TokenType::LeftEmphasis,
+                                                                 currentToken,
+                                                                 m_delimiterCnts,
+                                                                 m_currentDelimiterType));
 
         currentToken.clear();
         return true;
@@ -336,7 +351,7 @@ void EmphasisParser::UpdateLookBehind(char ch)
     }
 }
 
-void EmphasisParser::CaptureEmphasisToken(char ch, std::string& currentToken)
+void EmphasisParser::CaptureEmphasisToken(char ch, MarkDownSpan& currentToken)
 {
     if (!TryCapturingRightEmphasisToken(ch, currentToken) && !TryCapturingLeftEmphasisToken(ch, currentToken) &&
         !currentToken.empty())
@@ -347,7 +362,7 @@ void EmphasisParser::CaptureEmphasisToken(char ch, std::string& currentToken)
     }
 }
 
-void LinkParser::Match(std::stringstream& stream)
+void LinkParser::Match(MarkDownStream& stream)
 {
     // link syntax check, match keyword at each stage
     if (MatchAtLinkInit(stream) && MatchAtLinkTextRun(stream) && MatchAtLinkTextEnd(stream) &&
@@ -359,13 +374,13 @@ void LinkParser::Match(std::stringstream& stream)
 }
 
 // link is in form of [txt](url), this method matches '['
-bool LinkParser::MatchAtLinkInit(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkInit(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == '[')
     {
-        char streamChar;
-        lookahead.get(streamChar);
-        m_linkTextParsedResult.AddNewTokenToParsedResult(streamChar);
+        MarkDownSpan token;
+        lookahead.get(token);
+        m_linkTextParsedResult.AddNewTokenToParsedResult(token);
         return true;
     }
 
@@ -375,13 +390,13 @@ bool LinkParser::MatchAtLinkInit(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches txt
-bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkTextRun(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == ']')
     {
-        char streamChar;
-        lookahead.get(streamChar);
-        m_linkTextParsedResult.AddNewTokenToParsedResult(streamChar);
+        MarkDownSpan token;
+        lookahead.get(token);
+        m_linkTextParsedResult.AddNewTokenToParsedResult(token);
         return true;
     }
     else
@@ -401,9 +416,9 @@ bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
         if (lookahead.peek() == ']')
         {
             // move code gen objects to link text list to further process it
-            char streamChar;
-            lookahead.get(streamChar);
-            m_linkTextParsedResult.AddNewTokenToParsedResult(streamChar);
+            MarkDownSpan token;
+            lookahead.get(token);
+            m_linkTextParsedResult.AddNewTokenToParsedResult(token);
             return true;
         }
 
@@ -413,13 +428,13 @@ bool LinkParser::MatchAtLinkTextRun(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches ']'
-bool LinkParser::MatchAtLinkTextEnd(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkTextEnd(MarkDownStream& lookahead)
 {
     if (lookahead.peek() == '(')
     {
-        char streamChar;
-        lookahead.get(streamChar);
-        m_linkTextParsedResult.AddNewTokenToParsedResult(streamChar);
+        MarkDownSpan token;
+        lookahead.get(token);
+        m_linkTextParsedResult.AddNewTokenToParsedResult(token);
         return true;
     }
 
@@ -428,11 +443,12 @@ bool LinkParser::MatchAtLinkTextEnd(std::stringstream& lookahead)
 }
 
 // link is in form of [txt](url), this method matches '('
-bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkDestinationStart(MarkDownStream& lookahead)
 {
     // if peeked char is EOF or extended char, this isn't a match
     if (lookahead.peek() < 0)
     {
+        m_parsedResult.AppendParseResult(m_linkTextParsedResult);
         return false;
     }
 
@@ -443,9 +459,9 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
         return false;
     }
 
+    // an empty destination, whose ')' is matched next
     if (lookahead.peek() == ')')
     {
-        lookahead.get();
         return true;
     }
 
@@ -457,12 +473,14 @@ bool LinkParser::MatchAtLinkDestinationStart(std::stringstream& lookahead)
         return true;
     }
 
+    // the destination that was parsed follows the link text
+    m_linkTextParsedResult.AppendParseResult(m_parsedResult);
     m_parsedResult.AppendParseResult(m_linkTextParsedResult);
     return false;
 }
 
 // link is in form of [txt](url), this method matches ')'
-bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
+bool LinkParser::MatchAtLinkDestinationRun(MarkDownStream& lookahead)
 {
     if (lookahead.peek() > 0 && (MarkDownBlockParser::IsSpace(static_cast<char>(lookahead.peek())) || MarkDownBlockParser::IsCntrl(static_cast<char>(lookahead.peek()))))
     {
@@ -483,17 +501,11 @@ bool LinkParser::MatchAtLinkDestinationRun(std::stringstream& lookahead)
 
 // this method is called when link syntax check is complete
 // it processes the parsed result from link destination  and link text
-// and build a MarkDownStringHtmlGenerator that will output
-// string in link syntax (text)[destination) will converts to
+// and encloses them in link tokens that will output
+// string in link syntax (text)[destination) as
 // <a href=\destination\>text</a>
 void LinkParser::CaptureLinkToken()
 {
-    std::ostringstream html;
-    html << "<a href=\"";
-    // process link destination
-    html << m_parsedResult.GenerateHtmlString();
-    html << "\">";
-
     // when syntax check is complete, we have seen
     // '[', ']', '(', these keywords are not
     // needed anymore, so pop them from the parse result
@@ -506,23 +518,16 @@ void LinkParser::CaptureLinkToken()
     // translate what is captured in text of link
     // emphasis are processed here
     m_linkTextParsedResult.Translate();
-    html << m_linkTextParsedResult.GenerateHtmlString();
-    html << "</a>";
-
-    std::string html_string = html.str();
-
-    // Generate a MarkDownStringHtmlGenerator object
-    std::shared_ptr<MarkDownHtmlGenerator> codeGen = std::make_shared<MarkDownStringHtmlGenerator>(html_string);
 
-    m_parsedResult.Clear();
+    // enclose link destination and link text in link tokens
+    m_parsedResult.MakeLink(m_linkTextParsedResult);
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
     m_parsedResult.SetIsCaptured(true);
 }
 
 // list marker have form of ^-\s+ or \r-\s+
 // this method matches -\s
-bool ListParser::MatchNewListItem(std::stringstream& stream)
+bool ListParser::MatchNewListItem(MarkDownStream& stream)
 {
     if (IsHyphen(static_cast<char>(stream.peek())))
     {
@@ -543,7 +548,7 @@ bool ListParser::MatchNewListItem(std::stringstream& stream)
 // before calling this method
 // this method will return true, after it mataches new line char
 // at least once.
-bool ListParser::MatchNewBlock(std::stringstream& stream)
+bool ListParser::MatchNewBlock(MarkDownStream& stream)
 {
     if (IsNewLine(static_cast<char>(stream.peek())))
     {
@@ -560,13 +565,11 @@ bool ListParser::MatchNewBlock(std::stringstream& stream)
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
 // this method matches \d+\.
-bool ListParser::MatchNewOrderedListItem(std::stringstream& stream, std::string& number_string)
+bool ListParser::MatchNewOrderedListItem(MarkDownStream& stream, MarkDownSpan& number_string)
 {
     do
     {
-        char streamChar;
-        stream.get(streamChar);
-        number_string += streamChar;
+        stream.get(number_string);
     } while (MarkDownBlockParser::IsDigit(static_cast<char>(stream.peek())));
 
     if (IsDot(static_cast<char>(stream.peek())))
@@ -582,18 +585,18 @@ bool ListParser::MatchNewOrderedListItem(std::stringstream& stream, std::string&
 // parse blocks that wasn't captured
 // if what we encounter is one of following items, start of new list, list item, or new block element,
 // we do not include in the current block, we return, and have it handled by the caller
-void ListParser::ParseSubBlocks(std::stringstream& stream)
+void ListParser::ParseSubBlocks(MarkDownStream& stream)
 {
     while (!stream.eof())
     {
         if (IsNewLine(static_cast<char>(stream.peek())))
         {
-            char newLineChar;
+            MarkDownSpan newLineChar;
             stream.get(newLineChar);
             // check if it is the start of new block items
             if (MarkDownBlockParser::IsDigit(static_cast<char>(stream.peek())))
             {
-                std::string number_string = "";
+                MarkDownSpan number_string;
                 if (MatchNewOrderedListItem(stream, number_string))
                 {
                     break;
@@ -614,7 +617,7 @@ void ListParser::ParseSubBlocks(std::stringstream& stream)
     }
 }
 
-bool ListParser::CompleteListParsing(std::stringstream& stream)
+bool ListParser::CompleteListParsing(MarkDownStream& stream)
 {
     // check for - of -\s+ list marker
     if (stream.peek() == ' ')
@@ -637,12 +640,13 @@ bool ListParser::CompleteListParsing(std::stringstream& stream)
 }
 
 // list marker has a form of ^-\s+ or [\r, \n]-\s+, and this method checks the syntax
-void ListParser::Match(std::stringstream& stream)
+void ListParser::Match(MarkDownStream& stream)
 {
     // check for - of -\s+ list marker
     if (IsHyphen(static_cast<char>(stream.peek())))
     {
-        stream.get();
+        MarkDownSpan hyphen;
+        stream.get(hyphen);
         if (CompleteListParsing(stream))
         {
             CaptureListToken();
@@ -650,55 +654,42 @@ void ListParser::Match(std::stringstream& stream)
         else
         {
             // if incorrect syntax, capture what was thrown as a new token.
-            m_parsedResult.AddNewTokenToParsedResult('-');
+            m_parsedResult.AddNewTokenToParsedResult(hyphen);
         }
     }
 }
 
 void ListParser::CaptureListToken()
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    std::string htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
-
-    std::string html_string = html.str();
-    std::shared_ptr<MarkDownListHtmlGenerator> codeGen = std::make_shared<MarkDownListHtmlGenerator>(html_string);
-
-    m_parsedResult.Clear();
+    m_parsedResult.MakeListItem(nullptr);
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
 }
 
 // ordered list marker has form of ^\d+\.\s* or [\r,\n]\d+\.\s*, and this method checks the syntax
-void OrderedListParser::Match(std::stringstream& stream)
+void OrderedListParser::Match(MarkDownStream& stream)
 {
     // used to capture digit char
-    std::string number_string = "";
+    MarkDownSpan number_string;
     if (MarkDownBlockParser::IsDigit(static_cast<char>(stream.peek())))
     {
         do
         {
-            char streamChar;
-            stream.get(streamChar);
-            number_string += streamChar;
+            stream.get(number_string);
         } while (MarkDownBlockParser::IsDigit(static_cast<char>(stream.peek())));
 
         if (IsDot(static_cast<char>(stream.peek())))
         {
             // ordered list syntax check complete
-            stream.get();
+            MarkDownSpan numberAndDot = number_string;
+            stream.get(numberAndDot);
             if (CompleteListParsing(stream))
             {
                 CaptureOrderedListToken(number_string);
             }
             else
             {
-                number_string += '.';
-                m_parsedResult.AddNewTokenToParsedResult(number_string);
+                m_parsedResult.AddNewTokenToParsedResult(numberAndDot);
             }
         }
         else
@@ -709,21 +700,9 @@ void OrderedListParser::Match(std::stringstream& stream)
     }
 }
 
-void OrderedListParser::CaptureOrderedListToken(std::string& number_string)
+void OrderedListParser::CaptureOrderedListToken(const MarkDownSpan& number_string)
 {
-    std::ostringstream html;
     m_parsedResult.Translate();
-    std::string htmlString = m_parsedResult.GenerateHtmlString();
-
-    html << "<li>";
-    html << htmlString;
-    html << "</li>";
-
-    std::string html_string = html.str();
-    std::shared_ptr<MarkDownOrderedListHtmlGenerator> codeGen =
-        std::make_shared<MarkDownOrderedListHtmlGenerator>(html_string, number_string);
-
-    m_parsedResult.Clear();
+    m_parsedResult.MakeListItem(&number_string);
     m_parsedResult.FoundHtmlTags();
-    m_parsedResult.AppendToTokens(codeGen);
 }
@@ -2,48 +2,140 @@
 // Licensed under the MIT License.
 #pragma once
 #include "MarkDownHtmlGenerator.h"
-#include <iomanip>
 #include "BaseCardElement.h"
 #include "MarkDownParsedResult.h"
 
 namespace AdaptiveSharedNamespace
 {
+    // Cursor over the text being parsed. It provides the part of std::istream's interface the parsers use, with the
+    // same behaviour at the end of the text, without copying the text into a stream buffer.
+    class MarkDownStream
+    {
+    public:
+        MarkDownStream(const std::string& text) :
+            m_text(text), m_position(0), m_nestedBlocks(0), m_eof(false), m_fail(false)
+        {
+        }
+
+        // Returns the next char as unsigned char value, or EOF at the end of the text
+        int peek()
+        {
+            if (m_fail)
+            {
+                return EOF;
+            }
+            if (m_position < m_text.length())
+            {
+                return static_cast<unsigned char>(m_text[m_position]);
+            }
+            m_eof = true;
+            return EOF;
+        }
+
+        int get()
+        {
+            char ch;
+            return get(ch) ? static_cast<unsigned char>(ch) : EOF;
+        }
+
+        // Extracts the next char; fails at the end of the text, and every following call fails as well
+        bool get(char& ch)
+        {
+            if (m_fail)
+            {
+                return false;
+            }
+            if (m_position < m_text.length())
+            {
+                ch = m_text[m_position++];
+                return true;
+            }
+            m_eof = true;
+            m_fail = true;
+            return false;
+        }
+
+        // Extracts the next char, extending span by it
+        bool get(MarkDownSpan& span)
+        {
+            char ch;
+            if (get(ch))
+            {
+                span.Extend(m_text.data() + m_position - 1);
+                return true;
+            }
+            return false;
+        }
+
+        void unget()
+        {
+            m_eof = false;
+            if (!m_fail && m_position > 0)
+            {
+                --m_position;
+            }
+            else
+            {
+                m_fail = true;
+            }
+        }
+
+        // Returns current position, or -1 if an extraction failed
+        long long tellg() const { return m_fail ? -1 : static_cast<long long>(m_position); }
+
+        bool eof() const { return m_eof; }
+
+        // Number of links and lists being parsed that hold the current position
+        unsigned int GetNestedBlocks() const { return m_nestedBlocks; }
+        void EnterNestedBlock() { ++m_nestedBlocks; }
+        void LeaveNestedBlock() { --m_nestedBlocks; }
+
+    private:
+        const std::string& m_text;
+        size_t m_position;
+        unsigned int m_nestedBlocks;
+        bool m_eof;
+        bool m_fail;
+    };
+
     class MarkDownBlockParser
     {
     public:
         MarkDownBlockParser(){};
         // Matches each MarkDown's Syntax Form
         // For each match, stream moves to the next char
-        virtual void Match(std::stringstream&) = 0;
+        virtual void Match(MarkDownStream&) = 0;
         // Parses Block
-        void ParseBlock(std::stringstream&);
+        void ParseBlock(MarkDownStream&);
         // Returns Parse result
         MarkDownParsedResult& GetParsedResult() { return m_parsedResult; }
 
     protected:
+        // Char classes of the "C" locale, which the parsers classify every char of the text by. They're checked inline
+        // rather than through the <cctype> functions.
         static constexpr bool IsSpace(const char ch)
         {
-            return (ch > 0) && isspace(ch);
+            return ch == ' ' || (ch >= '\t' && ch <= '\r');
         }
 
         static constexpr bool IsPunct(const char ch)
         {
-            return (ch > 0) && ispunct(ch);
+            return (ch > ' ' && ch < 0x7f) && !IsAlnum(ch);
         }
 
         static constexpr bool IsAlnum(const char ch)
         {
-            return (ch < 0 || isalnum(ch));
+            return ch < 0 || IsDigit(ch) || (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
         }
 
         static constexpr bool IsCntrl(const char ch)
         {
-            return (ch > 0) && iscntrl(ch);
+            return (ch >= 0 && ch < ' ') || ch == 0x7f;
         }
 
         static constexpr bool IsDigit(const char ch)
         {
-            return (ch > 0) && isdigit(ch);
+            return ch >= '0' && ch <= '9';
         }
 
         // Holds parsed results
@@ -67,15 +159,15 @@ namespace AdaptiveSharedNamespace
             Captured  // Emphasis parsing is complete
         };
 
-        void Match(std::stringstream&) override;
+        void Match(MarkDownStream&) override;
 
         // Captures remaining charaters in given token and causes the emphasis parsing to terminate
-        void Flush(char ch, std::string& currentToken);
+        void Flush(char ch, MarkDownSpan& currentToken);
 
         // check if given character is * or _
         bool IsMarkDownDelimiter(char ch) const;
 
-        void CaptureCurrentCollectedStringAsRegularToken(std::string& currentToken);
+        void CaptureCurrentCollectedStringAsRegularToken(MarkDownSpan& currentToken);
         void CaptureCurrentCollectedStringAsRegularToken();
         void UpdateCurrentEmphasisRunState(DelimiterType emphasisType);
         // Check if current delimiter will be considererd as a delimiter run
@@ -87,23 +179,21 @@ namespace AdaptiveSharedNamespace
         bool IsLeftEmphasisDelimiter(const char ch) const;
         bool IsRightEmphasisDelimiter(const char ch) const;
         // Attempt to capture current emphasis as left emphasis
-        bool TryCapturingLeftEmphasisToken(char ch, std::string& currentToken);
+        bool TryCapturingLeftEmphasisToken(char ch, MarkDownSpan& currentToken);
         // Attempt to capture current emphasis as right emphasis
-        bool TryCapturingRightEmphasisToken(char ch, std::string& currentToken);
-        void CaptureEmphasisToken(char ch, std::string& currentToken);
+        bool TryCapturingRightEmphasisToken(char ch, MarkDownSpan& currentToken);
+        void CaptureEmphasisToken(char ch, MarkDownSpan& currentToken);
         void UpdateLookBehind(char ch);
         static constexpr DelimiterType GetDelimiterTypeForChar(const char ch)
         {
             return (ch == '*') ? DelimiterType::Asterisk : DelimiterType::Underscore;
         };
 
-        typedef EmphasisState (*MatchWithChar)(EmphasisParser&, std::stringstream&, std::string&);
-
-        // Callback function that handles the Text State
-        static EmphasisState MatchText(EmphasisParser&, std::stringstream&, std::string&);
+        // Handles the Text State
+        static EmphasisState MatchText(EmphasisParser&, MarkDownStream&, MarkDownSpan&);
 
-        // Callback function that handles the Emphasis State
-        static EmphasisState MatchEmphasis(EmphasisParser&, std::stringstream&, std::string&);
+        // Handles the Emphasis State
+        static EmphasisState MatchEmphasis(EmphasisParser&, MarkDownStream&, MarkDownSpan&);
 
     protected:
         bool m_checkLookAhead = false;
@@ -113,12 +203,8 @@ namespace AdaptiveSharedNamespace
         DelimiterType m_currentDelimiterType = DelimiterType::Init;
         EmphasisState m_current_state = EmphasisState::Text;
 
-        // vector of callback functions that handles state transistions
-        const std::unordered_map<EmphasisState, MatchWithChar> m_stateMachine = {{EmphasisState::Text, MatchText},
-                                                                                 {EmphasisState::Emphasis, MatchEmphasis}};
-
         // holds currently collected token
-        std::string m_current_token;
+        MarkDownSpan m_current_token;
     };
 
     class LinkParser : public MarkDownBlockParser
@@ -131,21 +217,21 @@ namespace AdaptiveSharedNamespace
         LinkParser& operator=(LinkParser&&) = default;
         virtual ~LinkParser() = default;
 
-        void Match(std::stringstream&) override;
+        void Match(MarkDownStream&) override;
 
     private:
         void CaptureLinkToken();
 
         // Matches Initial syntax of link
-        bool MatchAtLinkInit(std::stringstream&);
+        bool MatchAtLinkInit(MarkDownStream&);
         // Matches LinkText Run syntax of link
-        bool MatchAtLinkTextRun(std::stringstream&);
+        bool MatchAtLinkTextRun(MarkDownStream&);
         // Matches LinkText End syntax of link
-        bool MatchAtLinkTextEnd(std::stringstream&);
+        bool MatchAtLinkTextEnd(MarkDownStream&);
         // Matches LinkDestination Start syntax of link
-        bool MatchAtLinkDestinationStart(std::stringstream&);
+        bool MatchAtLinkDestinationStart(MarkDownStream&);
         // Matches LinkDestination Run syntax of link
-        bool MatchAtLinkDestinationRun(std::stringstream&);
+        bool MatchAtLinkDestinationRun(MarkDownStream&);
 
         // holds intermediate result of LinkText
         MarkDownParsedResult m_linkTextParsedResult;
@@ -161,17 +247,17 @@ namespace AdaptiveSharedNamespace
         ListParser& operator=(ListParser&&) = default;
         virtual ~ListParser() = default;
 
-        void Match(std::stringstream&) override;
-        bool MatchNewListItem(std::stringstream&);
-        bool MatchNewBlock(std::stringstream&);
-        bool MatchNewOrderedListItem(std::stringstream&, std::string&);
+        void Match(MarkDownStream&) override;
+        bool MatchNewListItem(MarkDownStream&);
+        bool MatchNewBlock(MarkDownStream&);
+        bool MatchNewOrderedListItem(MarkDownStream&, MarkDownSpan&);
         static constexpr bool IsHyphen(const char ch) { return ch == '-'; };
         static constexpr bool IsDot(const char ch) { return ch == '.'; };
         static constexpr bool IsNewLine(const char ch) { return (ch == '\r') || (ch == '\n'); };
 
     protected:
-        void ParseSubBlocks(std::stringstream&);
-        bool CompleteListParsing(std::stringstream& stream);
+        void ParseSubBlocks(MarkDownStream&);
+        bool CompleteListParsing(MarkDownStream& stream);
 
     private:
         void CaptureListToken();
@@ -187,9 +273,9 @@ namespace AdaptiveSharedNamespace
         OrderedListParser& operator=(OrderedListParser&&) = default;
         ~OrderedListParser() = default;
 
-        void Match(std::stringstream&) override;
+        void Match(MarkDownStream&) override;
 
     private:
-        void CaptureOrderedListToken(std::string&);
+        void CaptureOrderedListToken(const MarkDownSpan&);
     };
 }
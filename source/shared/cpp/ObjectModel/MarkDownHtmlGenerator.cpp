@@ -5,43 +5,162 @@
 
 using namespace AdaptiveSharedNamespace;
 
-std::string MarkDownStringHtmlGenerator::GenerateHtmlString()
+MarkDownHtmlGenerator::MarkDownBlockType MarkDownHtmlGenerator::GetBlockType() const
 {
-    if (m_isHead)
+    switch (m_type)
     {
-        m_token = "<p>" + m_token;
+    case TokenType::ListItemStart:
+    case TokenType::ListItemEnd:
+        return UnorderedList;
+    case TokenType::OrderedListItemStart:
+    case TokenType::OrderedListItemEnd:
+        return OrderedList;
+    default:
+        return ContainerBlock;
     }
+}
 
-    if (m_isTail)
-    {
-        return m_token + "</p>";
+void MarkDownHtmlGenerator::GenerateHtmlString(std::string& html) const
+{
+    switch (m_type)
+    {
+    case TokenType::LeftEmphasis:
+    case TokenType::RightEmphasis:
+    case TokenType::LeftAndRightEmphasis:
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+
+        AppendEmphasis(html);
+
+        if (!m_isHead && m_isTail)
+        {
+            html += "</p>";
+        }
+        break;
+
+    case TokenType::LinkStart:
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+        html += "<a href=\"";
+        break;
+
+    case TokenType::LinkText:
+        html += "\">";
+        break;
+
+    case TokenType::LinkEnd:
+        html += "</a>";
+        if (m_isTail)
+        {
+            html += "</p>";
+        }
+        break;
+
+    case TokenType::ListItemStart:
+        if (m_isHead)
+        {
+            html += "<ul>";
+        }
+        html += "<li>";
+        break;
+
+    case TokenType::ListItemEnd:
+        html += "</li>";
+        if (m_isTail)
+        {
+            html += "</ul>";
+        }
+        break;
+
+    case TokenType::OrderedListItemStart:
+        if (m_isHead)
+        {
+            html += "<ol start=\"";
+            html.append(m_token.text, m_token.length);
+            html += "\">";
+        }
+        html += "<li>";
+        break;
+
+    case TokenType::OrderedListItemEnd:
+        html += "</li>";
+        if (m_isTail)
+        {
+            html += "</ol>";
+        }
+        break;
+
+    default:
+        if (m_isHead)
+        {
+            html += "<p>";
+        }
+        AppendEscapedText(html);
+        if (m_isTail)
+        {
+            html += "</p>";
+        }
+        break;
     }
+}
 
-    return m_token;
+// text is escaped as it's output, escaped chars and the entities that replace them are both punctuation,
+// so escaping before parsing wouldn't change the parse
+void MarkDownHtmlGenerator::AppendEscapedText(std::string& html) const
+{
+    const char* runStart = m_token.text;
+    const char* const end = m_token.text + m_token.length;
+    for (const char* ch = runStart; ch != end; ++ch)
+    {
+        const char* entity = nullptr;
+        switch (*ch)
+        {
+        case '<':
+            entity = "&lt;";
+            break;
+        case '>':
+            entity = "&gt;";
+            break;
+        case '"':
+            entity = "&quot;";
+            break;
+        case '&':
+            entity = "&amp;";
+            break;
+        default:
+            continue;
+        }
+        html.append(runStart, ch - runStart);
+        html += entity;
+        runStart = ch + 1;
+    }
+    html.append(runStart, end - runStart);
 }
 
-//     left and right emphasis tokens are match if
+//     opening and closing emphasis tokens are match if
 //     1. they are same types
 //     2. neither of the emphasis tokens are both left and right emphasis tokens, and
-//        if either or both of them are, then their sum is not multiple of 3
-bool MarkDownEmphasisHtmlGenerator::IsMatch(const MarkDownEmphasisHtmlGenerator& emphasisToken)
+//        if either or both of them are, then the sum of their delimiter runs is not multiple of 3,
+//        unless both runs are
+bool MarkDownHtmlGenerator::IsMatch(const MarkDownHtmlGenerator& closingToken) const
 {
-    if (this->type == emphasisToken.type)
+    if (IsSameType(closingToken))
     {
-        // rule #9 & #10, sum of delimiter count can't be multiple of 3
-        return !((this->IsLeftAndRightEmphasis() || emphasisToken.IsLeftAndRightEmphasis()) &&
-                 (((this->m_numberOfUnusedDelimiters + emphasisToken.m_numberOfUnusedDelimiters) % 3) == 0));
+        // rule #9 & #10, sum of delimiter runs can't be multiple of 3
+        const int openingLength = GetDelimiterRunLength();
+        const int closingLength = closingToken.GetDelimiterRunLength();
+        return !((CanClose() || closingToken.CanOpen()) && ((openingLength + closingLength) % 3 == 0) &&
+                 !(openingLength % 3 == 0 && closingLength % 3 == 0));
     }
     return false;
 }
 
-bool MarkDownEmphasisHtmlGenerator::IsSameType(const MarkDownEmphasisHtmlGenerator& token)
-{
-    return this->type == token.type;
-}
-
 // adjust number of emphasis counts after maching is done
-int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken)
+int MarkDownHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownHtmlGenerator& rightToken)
 {
     int delimiterCount = 0;
     if (leftOver >= 0)
@@ -59,155 +178,68 @@ int MarkDownEmphasisHtmlGenerator::AdjustEmphasisCounts(int leftOver, MarkDownEm
     return delimiterCount;
 }
 
-// generate bold and emphasis html tags
-bool MarkDownEmphasisHtmlGenerator::GenerateTags(MarkDownEmphasisHtmlGenerator& token)
+// generate bold and emphasis html tags; this token opens them, and the closing token closes them
+bool MarkDownHtmlGenerator::GenerateTags(MarkDownHtmlGenerator& closingToken)
 {
     int delimiterCount = 0, leftOver = 0;
-    leftOver = this->m_numberOfUnusedDelimiters - token.m_numberOfUnusedDelimiters;
-    delimiterCount = this->AdjustEmphasisCounts(leftOver, token);
+    leftOver = this->m_numberOfUnusedDelimiters - closingToken.m_numberOfUnusedDelimiters;
+    delimiterCount = this->AdjustEmphasisCounts(leftOver, closingToken);
     const bool hasHtmlTags = (delimiterCount > 0);
 
     // emphasis found
     if (delimiterCount % 2)
     {
-        this->PushItalicTag();
-        token.PushItalicTag();
+        m_tags.push_back('i');
+        closingToken.m_tags.push_back('I');
     }
 
     // strong emphasis found
     for (int i = 0; i < delimiterCount / 2; i++)
     {
-        this->PushBoldTag();
-        token.PushBoldTag();
+        m_tags.push_back('b');
+        closingToken.m_tags.push_back('B');
     }
     return hasHtmlTags;
 }
 
-void MarkDownEmphasisHtmlGenerator::PushItalicTag()
-{
-    m_tags.push_back("<em>");
-}
-
-void MarkDownEmphasisHtmlGenerator::PushBoldTag()
-{
-    m_tags.push_back("<strong>");
-}
-
-std::string MarkDownLeftEmphasisHtmlGenerator::GenerateHtmlString()
-{
-    if (m_numberOfUnusedDelimiters)
-    {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
-    }
-
-    // append tags; since left delims, append it in the reverse order
-    for (auto itr = m_tags.rbegin(); itr != m_tags.rend(); ++itr)
-    {
-        html << *itr;
-    }
-
-    if (m_isHead)
-    {
-        return "<p>" + html.str();
-    }
-
-    if (m_isTail)
-    {
-        return html.str() + "</p>";
-    }
-
-    return html.str();
-}
-
-void MarkDownRightEmphasisHtmlGenerator::PushItalicTag()
+MarkDownSpan MarkDownHtmlGenerator::GetUnusedDelimiters() const
 {
-    m_tags.push_back("</em>");
+    MarkDownSpan unusedDelimiters;
+    unusedDelimiters.text = m_token.text + m_token.length - m_numberOfUnusedDelimiters;
+    unusedDelimiters.length = m_numberOfUnusedDelimiters;
+    return unusedDelimiters;
 }
 
-void MarkDownRightEmphasisHtmlGenerator::PushBoldTag()
+// a token closes tags before it opens any, so its closing tags are appended in the order they were pushed, followed by
+// unused delims, and its opening tags are appended in the reverse order they were pushed, innermost last
+void MarkDownHtmlGenerator::AppendEmphasis(std::string& html) const
 {
-    m_tags.push_back("</strong>");
-}
-
-std::string MarkDownRightEmphasisHtmlGenerator::GenerateHtmlString()
-{
-    // append tags;
-    for (auto itr = m_tags.begin(); itr != m_tags.end(); ++itr)
+    for (const auto tag : m_tags)
     {
-        html << *itr;
+        if (tag == 'I')
+        {
+            html += "</em>";
+        }
+        else if (tag == 'B')
+        {
+            html += "</strong>";
+        }
     }
 
-    // if there are unused emphasis, append them
     if (m_numberOfUnusedDelimiters)
     {
-        const size_t startIdx = m_token.size() - m_numberOfUnusedDelimiters;
-        html << m_token.substr(startIdx, std::string::npos);
-    }
-
-    if (m_isHead)
-    {
-        return "<p>" + html.str();
+        html.append(m_token.text + m_token.length - m_numberOfUnusedDelimiters, m_numberOfUnusedDelimiters);
     }
 
-    if (m_isTail)
+    for (auto tag = m_tags.rbegin(); tag != m_tags.rend(); ++tag)
     {
-        return html.str() + "</p>";
+        if (*tag == 'i')
+        {
+            html += "<em>";
+        }
+        else if (*tag == 'b')
+        {
+            html += "<strong>";
+        }
     }
-
-    return html.str();
-}
-
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushItalicTag()
-{
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<em>");
-    }
-    else
-    {
-        m_tags.push_back("</em>");
-    }
-}
-
-void MarkDownLeftAndRightEmphasisHtmlGenerator::PushBoldTag()
-{
-    if (m_directionType == Left)
-    {
-        m_tags.push_back("<strong>");
-    }
-    else
-    {
-        m_tags.push_back("</strong>");
-    }
-}
-
-std::string MarkDownListHtmlGenerator::GenerateHtmlString()
-{
-    if (m_isHead)
-    {
-        m_token = "<ul>" + m_token;
-    }
-
-    if (m_isTail)
-    {
-        return m_token + "</ul>";
-    }
-
-    return m_token;
-}
-
-std::string MarkDownOrderedListHtmlGenerator::GenerateHtmlString()
-{
-    if (m_isHead)
-    {
-        m_token = "<ol start=\"" + m_numberString + "\">" + m_token;
-    }
-
-    if (m_isTail)
-    {
-        return m_token + "</ol>";
-    }
-
-    return m_token;
 }
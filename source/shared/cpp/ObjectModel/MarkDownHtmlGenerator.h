@@ -2,9 +2,6 @@
 // Licensed under the MIT License.
 #pragma once
 #include <string>
-#include <iomanip>
-#include <vector>
-#include <list>
 #include "BaseCardElement.h"
 
 namespace AdaptiveSharedNamespace
@@ -20,26 +17,47 @@ namespace AdaptiveSharedNamespace
         Asterisk
     };
 
-    // this class knows how to generate html string of their types
-    // - MarkDownStringHtmlGenerator
+    // Run of chars of the text being parsed. Text tokens refer to the text instead of copying it, so the text must
+    // outlive them.
+    struct MarkDownSpan
+    {
+        const char* text = nullptr;
+        size_t length = 0;
+
+        bool empty() const { return length == 0; }
+        void clear() { length = 0; }
+
+        // Extends the span by the char at ch, which must follow the span; an empty span starts at ch
+        void Extend(const char* ch)
+        {
+            if (length == 0)
+            {
+                text = ch;
+            }
+            ++length;
+        }
+    };
+
+    // A token of parsed MarkDown that knows how to generate html string of its type. Tokens are held by value in
+    // MarkDownParsedResult and append their html to a single output string.
+    // - Text
     //   it is the most basic form,
-    //   it simply retains and return text as string
-    // - MarkDownEmphasisHtmlGenerator
-    //   it knows how to handle bold and italic html
-    //   tags and apply those to its text when asked to generate html string
-    // - MarkDownListHtmlGenerator
-    //   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-    //   MarkDownBlockType, this is used in generating html block tags
-    //   list uses block tag of <ul> all others use <p>
+    //   it simply retains a span of the parsed text and outputs it escaped
+    // - NewLine
+    //   text token of new line chars
+    // - LeftEmphasis, RightEmphasis
+    //   they know how to handle bold and italic html tags; left emphasis can open tags and right emphasis can close
+    //   them
+    // - LeftAndRightEmphasis
+    //   it can both close and open tags
+    // - LinkStart, LinkText, LinkEnd
+    //   they enclose the tokens of link destination and link text
+    // - ListItemStart, ListItemEnd, OrderedListItemStart, OrderedListItemEnd
+    //   they enclose the tokens of a list item, and their GetBlockType() returns UnorderedList and OrderedList,
+    //   this is used in generating html block tags; lists use block tags of <ul> and <ol>, all others use <p>
     class MarkDownHtmlGenerator
     {
     public:
-        MarkDownHtmlGenerator(const MarkDownHtmlGenerator&) = default;
-        MarkDownHtmlGenerator(MarkDownHtmlGenerator&&) = default;
-        MarkDownHtmlGenerator& operator=(const MarkDownHtmlGenerator&) = default;
-        MarkDownHtmlGenerator& operator=(MarkDownHtmlGenerator&&) = default;
-        virtual ~MarkDownHtmlGenerator() = default;
-
         enum MarkDownBlockType
         {
             ContainerBlock,
@@ -47,206 +65,80 @@ namespace AdaptiveSharedNamespace
             OrderedList
         };
 
-        MarkDownHtmlGenerator() : m_token(""){};
-        MarkDownHtmlGenerator(std::string& token) : m_token(token){};
-        void MakeItHead() { m_isHead = true; }
-        void MakeItTail() { m_isTail = true; }
-        virtual bool IsNewLine() { return false; }
-        virtual std::string GenerateHtmlString() = 0;
-        virtual MarkDownBlockType GetBlockType() const { return ContainerBlock; };
-
-    protected:
-        std::string m_token;
-        std::ostringstream html;
-        bool m_isHead = false;
-        bool m_isTail = false;
-    };
-
-    // - MarkDownStringHtmlGenerator
-    //   it is the most basic form,
-    //   it simply retains and return text as string
-    class MarkDownStringHtmlGenerator : public MarkDownHtmlGenerator
-    {
-    public:
-        MarkDownStringHtmlGenerator() = delete;
-        MarkDownStringHtmlGenerator(const MarkDownStringHtmlGenerator&) = default;
-        MarkDownStringHtmlGenerator(MarkDownStringHtmlGenerator&&) = default;
-        MarkDownStringHtmlGenerator& operator=(const MarkDownStringHtmlGenerator&) = default;
-        MarkDownStringHtmlGenerator& operator=(MarkDownStringHtmlGenerator&&) = default;
-        ~MarkDownStringHtmlGenerator() = default;
-
-        MarkDownStringHtmlGenerator(std::string& token) : MarkDownHtmlGenerator(token){};
-        std::string GenerateHtmlString() override;
-    };
-
-    // - MarkDownNewLineHtmlGenerator
-    //   it contains new line chars
-    class MarkDownNewLineHtmlGenerator : public MarkDownStringHtmlGenerator
-    {
-    public:
-        MarkDownNewLineHtmlGenerator() = delete;
-        MarkDownNewLineHtmlGenerator(const MarkDownNewLineHtmlGenerator&) = default;
-        MarkDownNewLineHtmlGenerator(MarkDownNewLineHtmlGenerator&&) = default;
-        MarkDownNewLineHtmlGenerator& operator=(const MarkDownNewLineHtmlGenerator&) = default;
-        MarkDownNewLineHtmlGenerator& operator=(MarkDownNewLineHtmlGenerator&&) = default;
-        ~MarkDownNewLineHtmlGenerator() = default;
-
-        MarkDownNewLineHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-        bool IsNewLine() override { return true; }
-    };
-
-    // - MarkDownEmphasisHtmlGenerator
-    //   it knows how to handle bold and italic html
-    //   tags and apply those to its text when asked to generate html string
-    class MarkDownEmphasisHtmlGenerator : public MarkDownHtmlGenerator
-    {
-    public:
-        MarkDownEmphasisHtmlGenerator() = delete;
-        MarkDownEmphasisHtmlGenerator(const MarkDownEmphasisHtmlGenerator&) = default;
-        MarkDownEmphasisHtmlGenerator(MarkDownEmphasisHtmlGenerator&&) = default;
-        MarkDownEmphasisHtmlGenerator& operator=(const MarkDownEmphasisHtmlGenerator&) = default;
-        MarkDownEmphasisHtmlGenerator& operator=(MarkDownEmphasisHtmlGenerator&&) = default;
-        ~MarkDownEmphasisHtmlGenerator() = default;
-
-        MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-            MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type){};
-
-        MarkDownEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type, std::vector<std::string>& tags) :
-            MarkDownHtmlGenerator(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun), type(type), m_tags(tags){};
-
-        virtual bool IsRightEmphasis() const { return false; }
-        virtual bool IsLeftEmphasis() const { return false; }
-        virtual bool IsLeftAndRightEmphasis() const { return false; }
-        virtual void PushItalicTag();
-        virtual void PushBoldTag();
-
-        bool IsMatch(const MarkDownEmphasisHtmlGenerator& token);
-        bool IsSameType(const MarkDownEmphasisHtmlGenerator& token);
-        bool IsDone() const { return m_numberOfUnusedDelimiters == 0; }
-        int GetNumberOfUnusedDelimiters() const { return m_numberOfUnusedDelimiters; };
-        bool GenerateTags(MarkDownEmphasisHtmlGenerator& token);
-        void ReverseDirectionType() { m_directionType = !m_directionType; };
-
-    protected:
-        enum
+        enum class TokenType
         {
-            Left = 0,
-            Right = 1,
+            Text,
+            NewLine,
+            LeftEmphasis,
+            RightEmphasis,
+            LeftAndRightEmphasis,
+            LinkStart,
+            LinkText,
+            LinkEnd,
+            ListItemStart,
+            ListItemEnd,
+            OrderedListItemStart,
+            OrderedListItemEnd
         };
 
-        int AdjustEmphasisCounts(int leftOver, MarkDownEmphasisHtmlGenerator& rightToken);
-        int m_numberOfUnusedDelimiters;
-        int m_directionType = Right;
-        DelimiterType type;
-        std::vector<std::string> m_tags;
-    };
-
-    // - MarkDownLeftEmphasisHtmlGenerator
-    //   it knows how to generates opening italic and bold html tags
-    class MarkDownLeftEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
-    {
-    public:
-        MarkDownLeftEmphasisHtmlGenerator() = delete;
-        MarkDownLeftEmphasisHtmlGenerator(const MarkDownLeftEmphasisHtmlGenerator&) = default;
-        MarkDownLeftEmphasisHtmlGenerator(MarkDownLeftEmphasisHtmlGenerator&&) = default;
-        MarkDownLeftEmphasisHtmlGenerator& operator=(const MarkDownLeftEmphasisHtmlGenerator&) = default;
-        MarkDownLeftEmphasisHtmlGenerator& operator=(MarkDownLeftEmphasisHtmlGenerator&&) = default;
-        ~MarkDownLeftEmphasisHtmlGenerator() = default;
-
-        MarkDownLeftEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-            MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
+        // Link and list item tokens
+        MarkDownHtmlGenerator(TokenType type) : m_type(type) {}
 
-        MarkDownLeftEmphasisHtmlGenerator(std::string& token,
-                                          int sizeOfEmphasisDelimiterRun,
-                                          DelimiterType type,
-                                          std::vector<std::string>& tags) :
-            MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type, tags){};
+        // Text and new line tokens, and ordered list item start tokens with their number
+        MarkDownHtmlGenerator(TokenType type, const MarkDownSpan& token) : m_type(type), m_token(token) {}
 
-        bool IsLeftEmphasis() const override { return true; }
-        std::string GenerateHtmlString() override;
-    };
-
-    // - MarkDownRightEmphasisHtmlGenerator
-    //   it knows how to generates closing italic and bold html tags
-    class MarkDownRightEmphasisHtmlGenerator : public MarkDownEmphasisHtmlGenerator
-    {
-    public:
-        MarkDownRightEmphasisHtmlGenerator() = delete;
-        MarkDownRightEmphasisHtmlGenerator(const MarkDownRightEmphasisHtmlGenerator&) = default;
-        MarkDownRightEmphasisHtmlGenerator(MarkDownRightEmphasisHtmlGenerator&&) = default;
-        MarkDownRightEmphasisHtmlGenerator& operator=(const MarkDownRightEmphasisHtmlGenerator&) = default;
-        MarkDownRightEmphasisHtmlGenerator& operator=(MarkDownRightEmphasisHtmlGenerator&&) = default;
-        ~MarkDownRightEmphasisHtmlGenerator() = default;
-
-        MarkDownRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-            MarkDownEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-
-        void GenerateTags(std::shared_ptr<MarkDownEmphasisHtmlGenerator>& token);
-        bool IsRightEmphasis() const override { return true; }
-        std::string GenerateHtmlString() override;
-        void PushItalicTag() override;
-        void PushBoldTag() override;
-    };
-
-    // - MarkDownLeftAndRightEmphasisHtmlGenerator
-    //   it can have both directions, and its final direction is determined at the later stage
-    class MarkDownLeftAndRightEmphasisHtmlGenerator : public MarkDownRightEmphasisHtmlGenerator
-    {
-    public:
-        MarkDownLeftAndRightEmphasisHtmlGenerator() = delete;
-        MarkDownLeftAndRightEmphasisHtmlGenerator(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = default;
-        MarkDownLeftAndRightEmphasisHtmlGenerator(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = default;
-        MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(const MarkDownLeftAndRightEmphasisHtmlGenerator&) = default;
-        MarkDownLeftAndRightEmphasisHtmlGenerator& operator=(MarkDownLeftAndRightEmphasisHtmlGenerator&&) = default;
-        ~MarkDownLeftAndRightEmphasisHtmlGenerator() = default;
-
-        MarkDownLeftAndRightEmphasisHtmlGenerator(std::string& token, int sizeOfEmphasisDelimiterRun, DelimiterType type) :
-            MarkDownRightEmphasisHtmlGenerator(token, sizeOfEmphasisDelimiterRun, type){};
-        bool IsRightEmphasis() const override { return m_directionType == Right; }
-        bool IsLeftEmphasis() const override { return m_directionType == Left; }
-        bool IsLeftAndRightEmphasis() const override { return true; };
-        void PushItalicTag() override;
-        void PushBoldTag() override;
-    };
-
-    // - MarkDownListHtmlGenerator
-    //   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-    //   UnorderedList type, this is used in generating html block tags <ul>
-    class MarkDownListHtmlGenerator : public MarkDownStringHtmlGenerator
-    {
-    public:
-        MarkDownListHtmlGenerator() = delete;
-        MarkDownListHtmlGenerator(const MarkDownListHtmlGenerator&) = default;
-        MarkDownListHtmlGenerator(MarkDownListHtmlGenerator&&) = default;
-        MarkDownListHtmlGenerator& operator=(const MarkDownListHtmlGenerator&) = default;
-        MarkDownListHtmlGenerator& operator=(MarkDownListHtmlGenerator&&) = default;
-        ~MarkDownListHtmlGenerator() = default;
-
-        MarkDownListHtmlGenerator(std::string& token) : MarkDownStringHtmlGenerator(token){};
-        std::string GenerateHtmlString() override;
-        MarkDownBlockType GetBlockType() const override { return UnorderedList; };
-    };
-
-    // - MarkDownUnorderedListHtmlGenerator
-    //   it functions similarly as MarkDownStringHtmlGenerator, but its GetBlockType() returns
-    //   OrderedList type, this is used in generating html block tags <ol>
-    class MarkDownOrderedListHtmlGenerator : public MarkDownStringHtmlGenerator
-    {
-    public:
-        MarkDownOrderedListHtmlGenerator() = delete;
-        MarkDownOrderedListHtmlGenerator(const MarkDownOrderedListHtmlGenerator&) = default;
-        MarkDownOrderedListHtmlGenerator(MarkDownOrderedListHtmlGenerator&&) = default;
-        MarkDownOrderedListHtmlGenerator& operator=(const MarkDownOrderedListHtmlGenerator&) = default;
-        MarkDownOrderedListHtmlGenerator& operator=(MarkDownOrderedListHtmlGenerator&&) = default;
-        ~MarkDownOrderedListHtmlGenerator() = default;
+        // Emphasis tokens
+        MarkDownHtmlGenerator(TokenType type, const MarkDownSpan& token, int sizeOfEmphasisDelimiterRun, DelimiterType delimiterType) :
+            m_type(type), m_token(token), m_numberOfUnusedDelimiters(sizeOfEmphasisDelimiterRun),
+            m_delimiterRunLength(sizeOfEmphasisDelimiterRun), m_delimiterType(delimiterType)
+        {
+        }
 
-        MarkDownOrderedListHtmlGenerator(std::string& token, std::string& number_string) :
-            MarkDownStringHtmlGenerator(token), m_numberString(number_string){};
-        std::string GenerateHtmlString() override;
-        MarkDownBlockType GetBlockType() const override { return OrderedList; };
+        void MakeItHead() { m_isHead = true; }
+        void MakeItTail() { m_isTail = true; }
+        bool IsNewLine() const { return m_type == TokenType::NewLine; }
+        bool IsHead() const { return m_isHead; }
+        TokenType GetType() const { return m_type; }
+        const MarkDownSpan& GetText() const { return m_token; }
+        MarkDownBlockType GetBlockType() const;
+
+        // Appends html string of this token to html
+        void GenerateHtmlString(std::string& html) const;
+
+        // Emphasis tokens
+        bool IsEmphasis() const { return CanOpen() || CanClose(); }
+        bool CanOpen() const { return m_type == TokenType::LeftEmphasis || m_type == TokenType::LeftAndRightEmphasis; }
+        bool CanClose() const { return m_type == TokenType::RightEmphasis || m_type == TokenType::LeftAndRightEmphasis; }
+        // Whether this opening token matches the closing token
+        bool IsMatch(const MarkDownHtmlGenerator& closingToken) const;
+        bool IsSameType(const MarkDownHtmlGenerator& token) const { return m_delimiterType == token.m_delimiterType; }
+        DelimiterType GetDelimiterType() const { return m_delimiterType; }
+        // Number of delimiters of the run, used or not
+        int GetDelimiterRunLength() const { return m_delimiterRunLength; }
+        bool IsDone() const { return m_numberOfUnusedDelimiters == 0; }
+        int GetNumberOfUnusedDelimiters() const { return m_numberOfUnusedDelimiters; };
+        // Generates tags of this opening token and the closing token
+        bool GenerateTags(MarkDownHtmlGenerator& closingToken);
+        // Unused delimiters are output as text, after closing tags in the order they were pushed and before opening
+        // tags in the reverse order they were pushed.
+        MarkDownSpan GetUnusedDelimiters() const;
+        // Pushed tags, one char per tag; 'i' and 'b' open italic and bold, 'I' and 'B' close them
+        const std::string& GetTags() const { return m_tags; }
 
     private:
-        std::string m_numberString;
+        void AppendEscapedText(std::string& html) const;
+        void AppendEmphasis(std::string& html) const;
+        int AdjustEmphasisCounts(int leftOver, MarkDownHtmlGenerator& rightToken);
+
+        TokenType m_type;
+        // text of text and emphasis tokens, or start number of ordered list items
+        MarkDownSpan m_token;
+        // pushed emphasis tags, one char per tag; lower case chars are opening tags
+        std::string m_tags;
+        int m_numberOfUnusedDelimiters = 0;
+        int m_delimiterRunLength = 0;
+        DelimiterType m_delimiterType = DelimiterType::Init;
+        bool m_isHead = false;
+        bool m_isTail = false;
     };
-
 }
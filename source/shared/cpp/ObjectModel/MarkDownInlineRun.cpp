@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "MarkDownInlineRun.h"
+
+using namespace AdaptiveSharedNamespace;
+
+MarkDownInlineRun::MarkDownInlineRun(Type type) : m_type(type), m_ordinal(0), m_isBold(false), m_isItalic(false)
+{
+}
+
+MarkDownInlineRun::MarkDownInlineRun(std::string text, bool isBold, bool isItalic, std::string url) :
+    m_type(Type::Text), m_text(std::move(text)), m_url(std::move(url)), m_ordinal(0), m_isBold(isBold), m_isItalic(isItalic)
+{
+}
+
+MarkDownInlineRun::MarkDownInlineRun(unsigned int ordinal) :
+    m_type(Type::ListItem), m_ordinal(ordinal), m_isBold(false), m_isItalic(false)
+{
+}
+
+MarkDownInlineRun::Type MarkDownInlineRun::GetType() const
+{
+    return m_type;
+}
+
+const std::string& MarkDownInlineRun::GetText() const
+{
+    return m_text;
+}
+
+bool MarkDownInlineRun::IsBold() const
+{
+    return m_isBold;
+}
+
+bool MarkDownInlineRun::IsItalic() const
+{
+    return m_isItalic;
+}
+
+const std::string& MarkDownInlineRun::GetUrl() const
+{
+    return m_url;
+}
+
+unsigned int MarkDownInlineRun::GetOrdinal() const
+{
+    return m_ordinal;
+}
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // A run of parsed MarkDown. Renderers that build native text can use runs instead of parsing the html generated
+    // from the same parse.
+    // - Text
+    //   unescaped text, which is bold, italic, or part of a link when its tags say so
+    // - ListItem
+    //   starts a list item, the text runs that follow are its content
+    // - ParagraphBreak
+    //   separates blocks, which are paragraphs and lists
+    class MarkDownInlineRun
+    {
+    public:
+        enum class Type
+        {
+            Text,
+            ListItem,
+            ParagraphBreak
+        };
+
+        MarkDownInlineRun(Type type);
+        MarkDownInlineRun(std::string text, bool isBold, bool isItalic, std::string url);
+        MarkDownInlineRun(unsigned int ordinal);
+
+        Type GetType() const;
+        const std::string& GetText() const;
+        bool IsBold() const;
+        bool IsItalic() const;
+        // url of the link the text is part of, or empty
+        const std::string& GetUrl() const;
+        // number of ordered list items, 0 for unordered list items
+        unsigned int GetOrdinal() const;
+
+    private:
+        Type m_type;
+        std::string m_text;
+        std::string m_url;
+        unsigned int m_ordinal;
+        bool m_isBold;
+        bool m_isItalic;
+    };
+}
@@ -1,10 +1,120 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
+#include <climits>
 #include "MarkDownParsedResult.h"
 
 using namespace AdaptiveSharedNamespace;
 
+namespace
+{
+    // Builds inline runs, merging consecutive text of the same format into one run
+    class InlineRunBuilder
+    {
+    public:
+        InlineRunBuilder(std::vector<MarkDownInlineRun>& runs) :
+            m_runs(runs), m_boldCount(0), m_italicCount(0), m_isBold(false), m_isItalic(false)
+        {
+        }
+
+        bool IsEmpty() const { return m_runs.empty() && m_text.empty(); }
+
+        void AppendText(const MarkDownSpan& text)
+        {
+            if (text.empty())
+            {
+                return;
+            }
+
+            const bool isBold = m_boldCount > 0;
+            const bool isItalic = m_italicCount > 0;
+            const std::string* url = m_urls.empty() ? nullptr : &m_urls.back();
+            const bool isSameUrl = url ? (*url == m_url) : m_url.empty();
+            if (!m_text.empty() && (isBold != m_isBold || isItalic != m_isItalic || !isSameUrl))
+            {
+                Flush();
+            }
+
+            if (m_text.empty())
+            {
+                m_isBold = isBold;
+                m_isItalic = isItalic;
+                if (url)
+                {
+                    m_url = *url;
+                }
+            }
+            m_text.append(text.text, text.length);
+        }
+
+        void Append(MarkDownInlineRun&& run)
+        {
+            Flush();
+            m_runs.push_back(std::move(run));
+        }
+
+        void ApplyTag(char tag)
+        {
+            switch (tag)
+            {
+            case 'i':
+                ++m_italicCount;
+                break;
+            case 'I':
+                m_italicCount -= (m_italicCount > 0);
+                break;
+            case 'b':
+                ++m_boldCount;
+                break;
+            case 'B':
+                m_boldCount -= (m_boldCount > 0);
+                break;
+            }
+        }
+
+        void PushUrl(std::string&& url) { m_urls.push_back(std::move(url)); }
+        void PopUrl() { m_urls.pop_back(); }
+
+        void Flush()
+        {
+            if (!m_text.empty())
+            {
+                m_runs.emplace_back(std::move(m_text), m_isBold, m_isItalic, std::move(m_url));
+                m_text.clear();
+                m_url.clear();
+            }
+        }
+
+    private:
+        std::vector<MarkDownInlineRun>& m_runs;
+        // urls of the links being built; links can be nested in link text
+        std::vector<std::string> m_urls;
+        unsigned int m_boldCount;
+        unsigned int m_italicCount;
+
+        // text of the run being built and its format
+        std::string m_text;
+        std::string m_url;
+        bool m_isBold;
+        bool m_isItalic;
+    };
+
+    unsigned int ParseOrdinal(const MarkDownSpan& number)
+    {
+        unsigned int ordinal = 0;
+        for (size_t i = 0; i < number.length; ++i)
+        {
+            const unsigned int digit = static_cast<unsigned int>(number.text[i] - '0');
+            if (ordinal > (UINT_MAX - digit) / 10)
+            {
+                return UINT_MAX;
+            }
+            ordinal = ordinal * 10 + digit;
+        }
+        return ordinal;
+    }
+}
+
 void MarkDownParsedResult::Translate()
 {
     MatchLeftAndRightEmphasises();
@@ -13,25 +123,30 @@ void MarkDownParsedResult::Translate()
 // appends html block tags at head and tail of the list
 void MarkDownParsedResult::AddBlockTags()
 {
+    if (IsEmpty())
+    {
+        return;
+    }
+
     // Parsing is done, let code gen token know who is the head of the list
-    m_codeGenTokens.front()->MakeItHead();
+    begin()->MakeItHead();
 
     // Parsing is done, let code gen token know who is the tail of the list
-    m_codeGenTokens.back()->MakeItTail();
+    m_codeGenTokens.back().MakeItTail();
 }
 
 void MarkDownParsedResult::MarkTags(MarkDownHtmlGenerator& x)
 {
-    if (m_codeGenTokens.back()->GetBlockType() != x.GetBlockType())
+    if (m_codeGenTokens.back().GetBlockType() != x.GetBlockType())
     {
-        if (m_codeGenTokens.back()->IsNewLine())
+        if (m_codeGenTokens.back().IsNewLine())
         {
             m_codeGenTokens.pop_back();
         }
 
-        if (!m_codeGenTokens.empty())
+        if (!IsEmpty())
         {
-            m_codeGenTokens.back()->MakeItTail();
+            m_codeGenTokens.back().MakeItTail();
         }
         x.MakeItHead();
     }
@@ -39,218 +154,303 @@ void MarkDownParsedResult::MarkTags(MarkDownHtmlGenerator& x)
 // append caller's parsed result to callee's parsed result
 void MarkDownParsedResult::AppendParseResult(MarkDownParsedResult& x)
 {
-    if (!m_codeGenTokens.empty() && !x.m_codeGenTokens.empty())
+    if (!IsEmpty() && !x.IsEmpty())
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x.m_codeGenTokens.front()));
+        MarkTags(*x.begin());
+    }
+
+    if (IsEmpty())
+    {
+        // nothing to offset, take over the tokens
+        m_codeGenTokens.swap(x.m_codeGenTokens);
+        m_emphasisLookUpTable.swap(x.m_emphasisLookUpTable);
+        std::swap(m_firstToken, x.m_firstToken);
+        x.Clear();
+    }
+    else
+    {
+        const size_t offset = m_codeGenTokens.size() - x.m_firstToken;
+        m_codeGenTokens.insert(m_codeGenTokens.end(),
+                               std::make_move_iterator(x.begin()),
+                               std::make_move_iterator(x.m_codeGenTokens.end()));
+        for (const auto index : x.m_emphasisLookUpTable)
+        {
+            m_emphasisLookUpTable.push_back(index + offset);
+        }
+        x.Clear();
     }
-    m_codeGenTokens.splice(m_codeGenTokens.end(), x.m_codeGenTokens);
-    m_emphasisLookUpTable.splice(m_emphasisLookUpTable.end(), x.m_emphasisLookUpTable);
+
     m_isHTMLTagsAdded = m_isHTMLTagsAdded || x.HasHtmlTags();
     SetIsCaptured(x.GetIsCaptured());
 }
 
 // append MarkDownHtmlGenerator object to callee's prased result
-void MarkDownParsedResult::AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>& x)
+void MarkDownParsedResult::AppendToTokens(MarkDownHtmlGenerator&& x)
 {
-    if (!m_codeGenTokens.empty())
+    if (!IsEmpty())
     {
         // check if two different block types, then add closing tag followed by the opening tag of new type
-        MarkTags(*(x));
+        MarkTags(x);
     }
-    m_codeGenTokens.push_back(x);
+    m_codeGenTokens.push_back(std::move(x));
 }
 
-void MarkDownParsedResult::AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>& x)
+void MarkDownParsedResult::AppendEmphasisToken(MarkDownHtmlGenerator&& x)
 {
-    m_emphasisLookUpTable.push_back(x);
+    AppendToTokens(std::move(x));
+    m_emphasisLookUpTable.push_back(m_codeGenTokens.size() - 1);
 }
 
+// the tokens of a link are enclosed in link tokens rather than appended one by one, so that their block tags don't
+// change; link text is translated beforehand, and emphasis in link destination isn't translated
+void MarkDownParsedResult::MakeLink(MarkDownParsedResult& linkText)
+{
+    std::vector<MarkDownHtmlGenerator> tokens;
+    tokens.reserve((m_codeGenTokens.end() - begin()) + (linkText.m_codeGenTokens.end() - linkText.begin()) + 3);
+    tokens.emplace_back(MarkDownHtmlGenerator::TokenType::LinkStart);
+    std::move(begin(), m_codeGenTokens.end(), std::back_inserter(tokens));
+    tokens.emplace_back(MarkDownHtmlGenerator::TokenType::LinkText);
+    std::move(linkText.begin(), linkText.m_codeGenTokens.end(), std::back_inserter(tokens));
+    tokens.emplace_back(MarkDownHtmlGenerator::TokenType::LinkEnd);
+
+    m_codeGenTokens.swap(tokens);
+    m_firstToken = 0;
+    m_emphasisLookUpTable.clear();
+    linkText.Clear();
+}
+
+// list items are translated beforehand
+void MarkDownParsedResult::MakeListItem(const MarkDownSpan* number)
+{
+    if (number)
+    {
+        m_codeGenTokens.emplace(begin(), MarkDownHtmlGenerator::TokenType::OrderedListItemStart, *number);
+        m_codeGenTokens.emplace_back(MarkDownHtmlGenerator::TokenType::OrderedListItemEnd);
+    }
+    else
+    {
+        m_codeGenTokens.emplace(begin(), MarkDownHtmlGenerator::TokenType::ListItemStart);
+        m_codeGenTokens.emplace_back(MarkDownHtmlGenerator::TokenType::ListItemEnd);
+    }
+    m_emphasisLookUpTable.clear();
+}
+
+// the popped token stays in place, and the look up table keeps its indices; links pop the '[' token of their text
 void MarkDownParsedResult::PopFront()
 {
-    m_codeGenTokens.pop_front();
+    if (!m_emphasisLookUpTable.empty() && m_emphasisLookUpTable.front() == m_firstToken)
+    {
+        m_emphasisLookUpTable.erase(m_emphasisLookUpTable.begin());
+    }
+    ++m_firstToken;
 }
 
 void MarkDownParsedResult::PopBack()
 {
     m_codeGenTokens.pop_back();
+
+    if (!m_emphasisLookUpTable.empty() && m_emphasisLookUpTable.back() == m_codeGenTokens.size())
+    {
+        m_emphasisLookUpTable.pop_back();
+    }
 }
 
 void MarkDownParsedResult::Clear()
 {
     m_codeGenTokens.clear();
+    m_firstToken = 0;
     m_emphasisLookUpTable.clear();
 }
 
-// create and add new MarkDownStringHtmlGenerator object that has string of ch
-void MarkDownParsedResult::AddNewTokenToParsedResult(char ch)
-{
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
-}
-
-// create and add new MarkDownStringHtmlGenerator object that has string word
-void MarkDownParsedResult::AddNewTokenToParsedResult(std::string& word)
+// create and add new text token
+void MarkDownParsedResult::AddNewTokenToParsedResult(const MarkDownSpan& word)
 {
-    std::shared_ptr<MarkDownStringHtmlGenerator> htmlToken = std::make_shared<MarkDownStringHtmlGenerator>(word);
-    AppendToTokens(htmlToken);
+    AppendToTokens(MarkDownHtmlGenerator(MarkDownHtmlGenerator::TokenType::Text, word));
 }
 
-// create and add new MarkDownSpaceHtmlGenerator object that has string of ch
-void MarkDownParsedResult::AddNewLineTokenToParsedResult(char ch)
+// create and add new new line token
+void MarkDownParsedResult::AddNewLineTokenToParsedResult(const MarkDownSpan& ch)
 {
-    std::string string_token = std::string(1, ch);
-    std::shared_ptr<MarkDownHtmlGenerator> htmlToken = std::make_shared<MarkDownNewLineHtmlGenerator>(string_token);
-    AppendToTokens(htmlToken);
+    AppendToTokens(MarkDownHtmlGenerator(MarkDownHtmlGenerator::TokenType::NewLine, ch));
 }
 
-std::string MarkDownParsedResult::GenerateHtmlString()
+void MarkDownParsedResult::GenerateHtmlString(std::string& html) const
 {
-    // process tags
-    std::ostringstream html;
-
-    for (auto itr = m_codeGenTokens.begin(); itr != m_codeGenTokens.end(); ++itr)
+    for (auto token = begin(); token != m_codeGenTokens.end(); ++token)
     {
-        html << (*itr)->GenerateHtmlString();
+        token->GenerateHtmlString(html);
     }
-
-    return html.str();
 }
 
-// Following the rules speicified in CommonMark (http://spec.commonmark.org/0.27/)
-// It generally supports more stricker version of the rules
-// push left delims to stack, until matching right delim is found,
-// update emphasis counts and type to build string after search is complete
-
-// detects valid emphasis delimiters, when valid delimiters are found, they are added into
-// a new space. each new delimiters that are part of the run is appended, in that way,
-// it builds tokens of vectors
-// each time emphasis tokens are found, they are also added into a lookup table.
-// the look up table stores index of the corresponding token in the token vectors, and
-// emphasis count and its types that are used in html generation
-// add comments -> what it does: generating  n supported features + 1 tokens --> capture them in token class
-void MarkDownParsedResult::MatchLeftAndRightEmphasises()
+void MarkDownParsedResult::GenerateInlineRuns(std::vector<MarkDownInlineRun>& runs) const
 {
-    std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> leftEmphasisToExplore;
-    auto currentEmphasis = m_emphasisLookUpTable.begin();
+    InlineRunBuilder builder(runs);
+    // tokens nested in links and list items don't start paragraphs
+    int depth = 0;
+    unsigned int ordinal = 0;
 
-    while (!(currentEmphasis == m_emphasisLookUpTable.end()))
+    for (size_t i = m_firstToken; i < m_codeGenTokens.size(); ++i)
     {
-        // keep exploring left until right token is found
-        if ((*currentEmphasis)->IsLeftEmphasis() ||
-            ((*currentEmphasis)->IsLeftAndRightEmphasis() && leftEmphasisToExplore.empty()))
+        const auto& token = m_codeGenTokens[i];
+        if (token.IsHead() && depth == 0 && !builder.IsEmpty())
+        {
+            builder.Append(MarkDownInlineRun(MarkDownInlineRun::Type::ParagraphBreak));
+        }
+
+        switch (token.GetType())
         {
-            if ((*currentEmphasis)->IsLeftAndRightEmphasis() && (*currentEmphasis)->IsRightEmphasis())
+        case MarkDownHtmlGenerator::TokenType::LeftEmphasis:
+        case MarkDownHtmlGenerator::TokenType::RightEmphasis:
+        case MarkDownHtmlGenerator::TokenType::LeftAndRightEmphasis:
+        {
+            // same order as html; closing tags, unused delimiters, then opening tags innermost last
+            const auto& tags = token.GetTags();
+            for (const auto tag : tags)
             {
-                // Reverse Direction Type; right empahsis to left emphasis
-                (*currentEmphasis)->ReverseDirectionType();
+                if (tag == 'I' || tag == 'B')
+                {
+                    builder.ApplyTag(tag);
+                }
             }
-
-            leftEmphasisToExplore.push_back(currentEmphasis);
-            ++currentEmphasis;
+            builder.AppendText(token.GetUnusedDelimiters());
+            for (auto tag = tags.rbegin(); tag != tags.rend(); ++tag)
+            {
+                if (*tag == 'i' || *tag == 'b')
+                {
+                    builder.ApplyTag(*tag);
+                }
+            }
+            break;
         }
-        else if (!leftEmphasisToExplore.empty())
+
+        case MarkDownHtmlGenerator::TokenType::LinkStart:
         {
-            auto currentLeftEmphasis = leftEmphasisToExplore.back();
-            // because of rule #9 & #10 and multiple of 3 rule, left delim can jump ahead of right delim,
-            // so need to check this condition.
-
-            // check if matches are found
-            //     mataches are found with left and right emphasis tokens if
-            //     1. they are same types
-            //     2. neigher of the emphasis tokens are both left and right emphasis tokens, and
-            //        if either or both of them are, then their sum is not multipe of 3
-            //
-            //     if matches are not found
-            //     1. search left emphasis tokens first for match because of rule 14 matches on the left side is preferred
-            //        if match is found set left emphasis as the new left emphasis token and proceed to token processing
-            //        any non-matching left emphasis will be poped, in this way it always move forward
-            //        if still no match is found,
-            //     2. search right
-            //        if the right emphasis can be left empahs search matching right emphasis tokens using the right emphasis
-            //        as left emphasis
-            //        else
-            //        use current left emphasis to search, and pop current right emphasis
-            if (!(*currentLeftEmphasis)->IsMatch(*(*currentEmphasis)))
+            // url is the text of the tokens up to the link text
+            std::string url;
+            int nestedLinks = 0;
+            while (++i < m_codeGenTokens.size())
             {
-                std::vector<std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>>::iterator> store;
-                bool isFound = false;
-                // search first if matching left emphasis can be found with the right delim
-                // if match found, set the new left emphasis token as current token, and
-                // process tokens and as of the result, any left emphasis tokens that were searched and not matching
-                // will be no longer considerred in tag processing
-                // pop until matching delim is found
-                while (!leftEmphasisToExplore.empty() && !isFound)
+                const auto& urlToken = m_codeGenTokens[i];
+                const auto type = urlToken.GetType();
+                if (type == MarkDownHtmlGenerator::TokenType::LinkText && nestedLinks == 0)
                 {
-                    auto leftToken = leftEmphasisToExplore.back();
-                    if ((*leftToken)->IsMatch(*(*currentEmphasis)))
-                    {
-                        currentLeftEmphasis = leftToken;
-                        isFound = true;
-                    }
-                    else
-                    {
-                        leftEmphasisToExplore.pop_back();
-                        store.push_back(leftToken);
-                    }
+                    break;
                 }
 
-                // if no match found from the left and the right emphasis is both left and right,
-                // and the sum of their emphasises counts is divisible by 3,
-                // use current right emphasis as
-                // left emphasis, make the right emphasis, as current left
-                // emphasis and start searching from there.
-                // during the search if no match found,
-                // this emphasis tokens will be dropped
-                if (!isFound)
+                if (type == MarkDownHtmlGenerator::TokenType::LinkStart || type == MarkDownHtmlGenerator::TokenType::LinkEnd)
                 {
-                    // restore state
-                    while (!isFound && !store.empty())
-                    {
-                        leftEmphasisToExplore.push_back(store.back());
-                        store.pop_back();
-                    }
-
-                    // check for the reason why we had to backtrack
-                    if ((*leftEmphasisToExplore.back())->IsSameType(*(*currentEmphasis)))
-                    {
-                        // right emphasis becomes left emphasis
-                        /// create new left empahsis html generator from right
-                        (*currentEmphasis)->ReverseDirectionType();
-                    }
-                    else
-                    {
-                        // move to next token for right delim tokens
-                        ++currentEmphasis;
-                    }
-                    // no maching found begin from the start
-                    continue;
+                    nestedLinks += (type == MarkDownHtmlGenerator::TokenType::LinkStart) ? 1 : -1;
+                }
+                else if (type == MarkDownHtmlGenerator::TokenType::Text || type == MarkDownHtmlGenerator::TokenType::NewLine)
+                {
+                    url.append(urlToken.GetText().text, urlToken.GetText().length);
+                }
+                else if (urlToken.IsEmphasis())
+                {
+                    url.append(urlToken.GetUnusedDelimiters().text, urlToken.GetUnusedDelimiters().length);
                 }
             }
-            // check which one has leftover delims
-            m_isHTMLTagsAdded = (*currentLeftEmphasis)->GenerateTags(*(*currentEmphasis)) || m_isHTMLTagsAdded;
+            builder.PushUrl(std::move(url));
+            ++depth;
+            break;
+        }
+        case MarkDownHtmlGenerator::TokenType::LinkEnd:
+            builder.PopUrl();
+            --depth;
+            break;
+
+        case MarkDownHtmlGenerator::TokenType::ListItemStart:
+            builder.Append(MarkDownInlineRun(0U));
+            ++depth;
+            break;
+
+        case MarkDownHtmlGenerator::TokenType::OrderedListItemStart:
+            // like html, the number of the first item of a list is the start number of the list
+            ordinal = token.IsHead() ? ParseOrdinal(token.GetText()) : ordinal + (ordinal < UINT_MAX);
+            builder.Append(MarkDownInlineRun(ordinal));
+            ++depth;
+            break;
+
+        case MarkDownHtmlGenerator::TokenType::ListItemEnd:
+        case MarkDownHtmlGenerator::TokenType::OrderedListItemEnd:
+            --depth;
+            break;
+
+        default:
+            builder.AppendText(token.GetText());
+            break;
+        }
+    }
+    builder.Flush();
+}
+
+// Following the "process emphasis" procedure of CommonMark (http://spec.commonmark.org/0.29/#phase-2-inline-structure)
+// each closing delimiter run is matched with the nearest opening run of the stack that it can match, and the openers
+// between them are dropped; when no opener matches, openers_bottom remembers that openers below the current top can't
+// match closers of the same kind, so no opener is searched twice for the same kind of closer and matching is linear.
+// Unlike CommonMark, a match uses all delimiters that both runs have, generating an em tag when their count is odd and
+// strong tags for the rest
+void MarkDownParsedResult::MatchLeftAndRightEmphasises()
+{
+    // look up table indexes of the runs that can open, bottom of the stack first
+    std::vector<size_t> openers;
 
-            // all right delims used, move to next
-            if ((*currentEmphasis)->IsDone())
+    // closers are of a kind by their delimiter type, their delimiter run length mod 3, and whether they can open,
+    // as these decide which openers they can match
+    size_t openersBottom[2][3][2] = {};
+    const auto clampOpenersBottom = [&openersBottom, &openers]() {
+        for (auto& byLength : openersBottom)
+        {
+            for (auto& byCanOpen : byLength)
             {
-                ++currentEmphasis;
+                for (auto& bottom : byCanOpen)
+                {
+                    bottom = std::min(bottom, openers.size());
+                }
             }
+        }
+    };
 
-            // all left or right delims used, pop
-            if ((*currentLeftEmphasis)->IsDone())
+    for (size_t currentEmphasis = 0; currentEmphasis < m_emphasisLookUpTable.size(); ++currentEmphasis)
+    {
+        auto& closer = m_codeGenTokens[m_emphasisLookUpTable[currentEmphasis]];
+        if (closer.CanClose())
+        {
+            size_t& bottom = openersBottom[closer.GetDelimiterType() == DelimiterType::Underscore]
+                                          [closer.GetDelimiterRunLength() % 3][closer.CanOpen()];
+            while (!closer.IsDone())
             {
-                leftEmphasisToExplore.pop_back();
+                size_t opener = openers.size();
+                while (opener > bottom && !m_codeGenTokens[m_emphasisLookUpTable[openers[opener - 1]]].IsMatch(closer))
+                {
+                    --opener;
+                }
+
+                if (opener == bottom)
+                {
+                    // no opener below the top can match this kind of closer from now on
+                    bottom = openers.size();
+                    break;
+                }
+
+                auto& openerToken = m_codeGenTokens[m_emphasisLookUpTable[openers[opener - 1]]];
+                m_isHTMLTagsAdded = openerToken.GenerateTags(closer) || m_isHTMLTagsAdded;
+
+                // openers between the opener and the closer can't be matched anymore, nor can the opener when done
+                openers.resize(openerToken.IsDone() ? opener - 1 : opener);
+                clampOpenersBottom();
             }
         }
-        else
+
+        if (closer.CanOpen() && !closer.IsDone())
         {
-            ++currentEmphasis;
+            openers.push_back(currentEmphasis);
         }
     }
 }
 
-bool MarkDownParsedResult::HasHtmlTags()
+bool MarkDownParsedResult::HasHtmlTags() const
 {
     return m_isHTMLTagsAdded;
 }
@@ -4,7 +4,7 @@
 
 #include "BaseCardElement.h"
 #include "MarkDownHtmlGenerator.h"
-#include <list>
+#include "MarkDownInlineRun.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -12,46 +12,60 @@ namespace AdaptiveSharedNamespace
     class MarkDownParsedResult
     {
     public:
-        MarkDownParsedResult() : m_isHTMLTagsAdded(false), m_isCaptured(false) {};
+        MarkDownParsedResult() : m_firstToken(0), m_isHTMLTagsAdded(false), m_isCaptured(false) {};
 
         // Translate Intermediate Parsing Result to a form that can be written to html string
         void Translate();
         void AddBlockTags();
 
-        // Write to html string
-        std::string GenerateHtmlString();
+        // Append html string to the given string
+        void GenerateHtmlString(std::string& html) const;
 
-        // Append contents of the given parsing result object
+        // Append inline runs to the given runs
+        void GenerateInlineRuns(std::vector<MarkDownInlineRun>& runs) const;
+
+        // Append contents of the given parsing result object, leaving it empty
         void AppendParseResult(MarkDownParsedResult&);
 
         // Append html code gen object to parse result
-        void AppendToTokens(const std::shared_ptr<MarkDownHtmlGenerator>&);
+        void AppendToTokens(MarkDownHtmlGenerator&&);
 
-        // Append emphasis html code gen object to parse result
-        void AppendToLookUpTable(const std::shared_ptr<MarkDownEmphasisHtmlGenerator>&);
+        // Append emphasis html code gen object to parse result, and add it to the look up table of emphasises
+        void AppendEmphasisToken(MarkDownHtmlGenerator&&);
 
-        // Take a char and convert it html code gen and append it to the result. used to store MarkDown keywords such as
-        // '[', ']', '(', ')'
-        void AddNewTokenToParsedResult(char ch);
+        // Make the parsed link destination a link with the given link text, leaving the link text empty
+        void MakeLink(MarkDownParsedResult& linkText);
 
-        // Take string and convert it html code gen and append it to the result
-        void AddNewTokenToParsedResult(std::string& word);
+        // Make the parsed result a list item; ordered list items have a number
+        void MakeListItem(const MarkDownSpan* number);
+
+        // Take text and convert it html code gen and append it to the result. used to store MarkDown keywords such as
+        // '[', ']', '(', ')'
+        void AddNewTokenToParsedResult(const MarkDownSpan& word);
 
         // Take a new line char and convert it html code gen and append it to the result It is used to store MarkDown
         // keywords such as '\r', '\n'
-        void AddNewLineTokenToParsedResult(char ch);
+        void AddNewLineTokenToParsedResult(const MarkDownSpan& ch);
         void PopFront();
         void PopBack();
         void Clear();
-        bool HasHtmlTags();
+        bool HasHtmlTags() const;
         void FoundHtmlTags();
         bool GetIsCaptured() const { return m_isCaptured; }
         void SetIsCaptured(const bool val) { m_isCaptured = val; }
 
     private:
         void MarkTags(MarkDownHtmlGenerator&);
-        std::list<std::shared_ptr<MarkDownHtmlGenerator>> m_codeGenTokens;
-        std::list<std::shared_ptr<MarkDownEmphasisHtmlGenerator>> m_emphasisLookUpTable;
+        bool IsEmpty() const { return m_firstToken == m_codeGenTokens.size(); }
+        std::vector<MarkDownHtmlGenerator>::iterator begin() { return m_codeGenTokens.begin() + m_firstToken; }
+        std::vector<MarkDownHtmlGenerator>::const_iterator begin() const { return m_codeGenTokens.begin() + m_firstToken; }
+
+        // tokens before m_firstToken have been popped from the front, which leaves them in place rather than moving the
+        // rest of the tokens
+        std::vector<MarkDownHtmlGenerator> m_codeGenTokens;
+        size_t m_firstToken;
+        // indices of emphasis tokens in m_codeGenTokens
+        std::vector<size_t> m_emphasisLookUpTable;
         bool m_isHTMLTagsAdded;
         bool m_isCaptured;
 
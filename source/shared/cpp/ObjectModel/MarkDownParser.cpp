@@ -1,10 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
-#include <vector>
-#include <iomanip>
-#include <iostream>
 #include "MarkDownParser.h"
+#include "ParseObserver.h"
 
 using namespace AdaptiveSharedNamespace;
 
@@ -19,18 +17,32 @@ std::string MarkDownParser::TransformToHtml()
     {
         return "<p></p>";
     }
-    // begin parsing html blocks
-    ParseBlock();
 
-    // process further what is parsed before outputting
-    // html string
-    m_parsedResult.Translate();
+    return ParseObserver::Observe(ParseEventKind::MarkDown, m_text.length(), [this]() {
+        MarkDownParsedResult parsedResult;
+        ParseBlock(parsedResult);
 
-    // add block tags such as <p> <ul>
-    m_parsedResult.AddBlockTags();
+        // block and emphasis tags and escaped chars make html somewhat longer than the text
+        std::string html;
+        html.reserve(m_text.length() + m_text.length() / 2 + 16);
+        parsedResult.GenerateHtmlString(html);
+        return html;
+    });
+}
 
-    m_hasHTMLTag = m_parsedResult.HasHtmlTags();
-    return m_parsedResult.GenerateHtmlString();
+// transforms string to inline runs
+std::vector<MarkDownInlineRun> MarkDownParser::TransformToInlineRuns()
+{
+    std::vector<MarkDownInlineRun> runs;
+    if (!m_text.empty())
+    {
+        ParseObserver::Observe(ParseEventKind::MarkDown, m_text.length(), [this, &runs]() {
+            MarkDownParsedResult parsedResult;
+            ParseBlock(parsedResult);
+            parsedResult.GenerateInlineRuns(runs);
+        });
+    }
+    return runs;
 }
 
 bool MarkDownParser::HasHtmlTags()
@@ -44,46 +56,24 @@ bool MarkDownParser::IsEscaped() const
 }
 
 // MarkDown is consisted of Blocks, this methods parses blocks
-void MarkDownParser::ParseBlock()
+// parsed tokens refer to the text, and html escapes their text as it's generated
+void MarkDownParser::ParseBlock(MarkDownParsedResult& parsedResult)
 {
-    std::stringstream stream(EscapeText());
+    m_isEscaped = (m_text.find_first_of("<>\"&") != std::string::npos);
+
+    MarkDownStream stream(m_text);
     EmphasisParser parser;
     while (!stream.eof())
     {
         parser.ParseBlock(stream);
     }
-    m_parsedResult.AppendParseResult(parser.GetParsedResult());
-}
-
-std::string MarkDownParser::EscapeText()
-{
-    std::string escaped;
-    unsigned int nonEscapedCounts = 0;
+    parsedResult.AppendParseResult(parser.GetParsedResult());
 
-    for (std::string::size_type i = 0; i < m_text.length(); i++)
-    {
-        switch (m_text.at(i))
-        {
-        case '<':
-            escaped += "&lt;";
-            break;
-        case '>':
-            escaped += "&gt;";
-            break;
-        case '"':
-            escaped += "&quot;";
-            break;
-        case '&':
-            escaped += "&amp;";
-            break;
-        default:
-            escaped += m_text.at(i);
-            nonEscapedCounts++;
-            break;
-        }
-    }
+    // process further what is parsed before outputting
+    parsedResult.Translate();
 
-    m_isEscaped = (nonEscapedCounts != m_text.length());
+    // add block tags such as <p> <ul>
+    parsedResult.AddBlockTags();
 
-    return escaped;
+    m_hasHTMLTag = parsedResult.HasHtmlTags();
 }
@@ -7,6 +7,7 @@
 #include "MarkDownParsedResult.h"
 #include "MarkDownBlockParser.h"
 #include "MarkDownHtmlGenerator.h"
+#include "MarkDownInlineRun.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -17,15 +18,17 @@ namespace AdaptiveSharedNamespace
 
         std::string TransformToHtml();
 
+        // Transforms the text to runs of formatted text, for renderers that build their text from runs rather than
+        // from html. Text of the runs isn't escaped.
+        std::vector<MarkDownInlineRun> TransformToInlineRuns();
+
         bool HasHtmlTags();
 
         bool IsEscaped() const;
 
     private:
-        void ParseBlock();
-        std::string EscapeText();
+        void ParseBlock(MarkDownParsedResult& parsedResult);
         std::string m_text;
-        MarkDownParsedResult m_parsedResult;
         bool m_hasHTMLTag;
         bool m_isEscaped;
     };
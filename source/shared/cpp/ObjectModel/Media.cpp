@@ -9,7 +9,6 @@ using namespace AdaptiveSharedNamespace;
 
 Media::Media() : BaseCardElement(CardElementType::Media)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value Media::SerializeToJsonValue() const
@@ -36,24 +35,24 @@ Json::Value Media::SerializeToJsonValue() const
     return root;
 }
 
-std::string Media::GetPoster() const
+const std::string& Media::GetPoster() const
 {
     return m_poster;
 }
 
-void Media::SetPoster(const std::string& value)
+void Media::SetPoster(std::string value)
 {
-    m_poster = value;
+    m_poster = std::move(value);
 }
 
-std::string Media::GetAltText() const
+const std::string& Media::GetAltText() const
 {
     return m_altText;
 }
 
-void Media::SetAltText(const std::string& value)
+void Media::SetAltText(std::string value)
 {
-    m_altText = value;
+    m_altText = std::move(value);
 }
 
 std::vector<std::shared_ptr<MediaSource>>& Media::GetSources()
@@ -61,62 +60,63 @@ std::vector<std::shared_ptr<MediaSource>>& Media::GetSources()
     return m_sources;
 }
 
-void Media::PopulateKnownPropertiesSet()
-{
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
-}
-
 void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    RemoteResourceInformation posterResourceInfo;
-    posterResourceInfo.url = GetPoster();
-    posterResourceInfo.mimeType = "image";
-    resourceInfo.push_back(posterResourceInfo);
+    resourceInfo.push_back({m_poster, "image"});
 
-    auto sources = GetSources();
-    for (auto source : sources)
+    for (const auto& source : m_sources)
     {
         source->GetResourceInformation(resourceInfo);
     }
-    return;
 }
 
-std::shared_ptr<BaseCardElement> MediaParser::Deserialize(ParseContext& context, const Json::Value& json)
+void Media::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(Media));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_poster);
+    usage.AddString(m_altText);
+    usage.AddObjects(m_sources);
+}
+
+template<typename TPolicy>
+bool MediaParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::Media);
 
-    std::shared_ptr<Media> media = BaseCardElement::Deserialize<Media>(context, json);
-    media->SetPoster(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Poster, false));
-    media->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText, false));
+    BaseCardElement::ParseProperties(policy, context, json);
+    policy.String(json, AdaptiveCardSchemaKey::Poster, &Media::SetPoster, false);
+    policy.String(json, AdaptiveCardSchemaKey::AltText, &Media::SetAltText, false);
 
-    auto sources = ParseUtil::GetElementCollectionOfSingleType<MediaSource>(
-        context, json, AdaptiveCardSchemaKey::Sources, MediaSourceParser::Deserialize, true);
+    policy.template Items<MediaSourceParser>(context, json, AdaptiveCardSchemaKey::Sources, &Media::m_sources, true);
 
     std::string mimeBaseType;
-    for (auto source : sources)
+    for (const auto& source : ParseUtil::GetArray(json, AdaptiveCardSchemaKey::Sources, true))
     {
-        std::string currentMimeType = source->GetMimeType();
-
-        std::string slash("/");
-        const size_t slashPosition = currentMimeType.find(slash, 0);
-        std::string currentMimeBaseType = currentMimeType.substr(0, slashPosition);
+        const std::string currentMimeType = ParseUtil::GetString(source, AdaptiveCardSchemaKey::MimeType, false);
+        std::string currentMimeBaseType = currentMimeType.substr(0, currentMimeType.find('/', 0));
 
         if (mimeBaseType.empty())
         {
-            mimeBaseType = currentMimeBaseType;
+            mimeBaseType = std::move(currentMimeBaseType);
         }
         else if (mimeBaseType != currentMimeBaseType)
         {
-            context.warnings.push_back(
-                std::make_shared<AdaptiveCardParseWarning>(AdaptiveSharedNamespace::WarningStatusCode::InvalidMediaMix,
-                                                           "Media element containing a mix of audio and video was dropped"));
-            return nullptr;
+            context.AddWarning(WarningStatusCode::InvalidMediaMix, "Media element containing a mix of audio and video was dropped");
+            return false;
         }
     }
 
-    media->m_sources = std::move(sources);
+    return true;
+}
+
+std::shared_ptr<BaseCardElement> MediaParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    std::shared_ptr<Media> media = std::make_shared<Media>();
+    if (!ParseProperties(BuildPolicy<Media>(*media), context, json))
+    {
+        return nullptr;
+    }
 
     return media;
 }
@@ -125,3 +125,8 @@ std::shared_ptr<BaseCardElement> MediaParser::DeserializeFromString(ParseContext
 {
     return MediaParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+bool MediaParser::Validate(ParseContext& context, const Json::Value& json)
+{
+    return ParseProperties(ValidatePolicy<Media>(), context, json);
+}
@@ -23,22 +23,21 @@ namespace AdaptiveSharedNamespace
 
         Json::Value SerializeToJsonValue() const override;
 
-        std::string GetPoster() const;
-        void SetPoster(const std::string& value);
+        const std::string& GetPoster() const;
+        void SetPoster(std::string value);
 
-        std::string GetAltText() const;
-        void SetAltText(const std::string& value);
+        const std::string& GetAltText() const;
+        void SetAltText(std::string value);
 
         std::vector<std::shared_ptr<MediaSource>>& GetSources();
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
         std::string m_poster;
         std::string m_altText;
         std::vector<std::shared_ptr<MediaSource>> m_sources;
-
-        void PopulateKnownPropertiesSet() override;
     };
 
     class MediaParser : public BaseCardElementParser
@@ -53,5 +52,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static bool ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "MediaSource.h"
+#include "ParsePolicy.h"
 #include "ParseUtil.h"
 
 using namespace AdaptiveSharedNamespace;
@@ -27,42 +28,48 @@ Json::Value MediaSource::SerializeToJsonValue() const
     return root;
 }
 
-std::string MediaSource::GetMimeType() const
+const std::string& MediaSource::GetMimeType() const
 {
     return m_mimeType;
 }
 
-void MediaSource::SetMimeType(const std::string& value)
+void MediaSource::SetMimeType(std::string value)
 {
-    m_mimeType = value;
+    m_mimeType = std::move(value);
 }
 
-std::string MediaSource::GetUrl() const
+const std::string& MediaSource::GetUrl() const
 {
     return m_url;
 }
 
-void MediaSource::SetUrl(const std::string& value)
+void MediaSource::SetUrl(std::string value)
 {
-    m_url = value;
+    m_url = std::move(value);
 }
 
 void MediaSource::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    RemoteResourceInformation sourceInfo;
-    sourceInfo.url = GetUrl();
-    sourceInfo.mimeType = GetMimeType();
+    resourceInfo.push_back({m_url, m_mimeType});
+}
 
-    resourceInfo.push_back(sourceInfo);
-    return;
+void MediaSource::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(MediaSource));
+    usage.AddString(m_mimeType);
+    usage.AddString(m_url);
+}
+
+template<typename TPolicy> void MediaSourceParser::ParseProperties(const TPolicy& policy, const Json::Value& json)
+{
+    policy.String(json, AdaptiveCardSchemaKey::MimeType, &MediaSource::SetMimeType, false);
+    policy.String(json, AdaptiveCardSchemaKey::Url, &MediaSource::SetUrl, false);
 }
 
 std::shared_ptr<MediaSource> MediaSourceParser::Deserialize(ParseContext&, const Json::Value& json)
 {
     std::shared_ptr<MediaSource> mediaSource = std::make_shared<MediaSource>();
-
-    mediaSource->SetMimeType(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MimeType, false));
-    mediaSource->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, false));
+    ParseProperties(BuildPolicy<MediaSource>(*mediaSource), json);
 
     return mediaSource;
 }
@@ -71,3 +78,8 @@ std::shared_ptr<MediaSource> MediaSourceParser::DeserializeFromString(ParseConte
 {
     return MediaSourceParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+void MediaSourceParser::Validate(ParseContext&, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<MediaSource>(), json);
+}
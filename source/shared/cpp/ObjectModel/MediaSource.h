@@ -21,13 +21,14 @@ namespace AdaptiveSharedNamespace
 
         virtual Json::Value SerializeToJsonValue() const;
 
-        std::string GetMimeType() const;
-        void SetMimeType(const std::string& value);
+        const std::string& GetMimeType() const;
+        void SetMimeType(std::string value);
 
-        std::string GetUrl() const;
-        void SetUrl(const std::string& value);
+        const std::string& GetUrl() const;
+        void SetUrl(std::string value);
 
         virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo);
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
     private:
         std::string m_mimeType;
@@ -46,5 +47,9 @@ namespace AdaptiveSharedNamespace
 
         static std::shared_ptr<MediaSource> Deserialize(ParseContext& context, const Json::Value& root);
         static std::shared_ptr<MediaSource> DeserializeFromString(ParseContext& context, const std::string& jsonString);
+        static void Validate(ParseContext& context, const Json::Value& root);
+
+    private:
+        template<typename TPolicy> static void ParseProperties(const TPolicy& policy, const Json::Value& json);
     };
 }
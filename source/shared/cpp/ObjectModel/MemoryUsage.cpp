@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "MemoryUsage.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    // The vtable pointer and the two reference counts of the control block make_shared places next to the object
+    constexpr size_t c_controlBlockSize = sizeof(void*) + 2 * sizeof(int);
+
+    // Red-black tree node of a std::map: three pointers and the color, ahead of the value
+    constexpr size_t c_mapNodeSize = 4 * sizeof(void*);
+
+    size_t GetInPlaceCapacity()
+    {
+        static const size_t capacity = std::string().capacity();
+        return capacity;
+    }
+}
+
+MemoryUsage::MemoryUsage() : elements(0), strings(0), json(0), vectors(0), warnings(0), showCards(0)
+{
+}
+
+size_t MemoryUsage::GetTotal() const
+{
+    return elements + strings + json + vectors + warnings + showCards;
+}
+
+void MemoryUsage::AddObject(size_t size)
+{
+    elements += size + c_controlBlockSize;
+}
+
+void MemoryUsage::AddString(const std::string& value)
+{
+    if (value.capacity() > GetInPlaceCapacity())
+    {
+        strings += value.capacity() + 1;
+    }
+}
+
+void MemoryUsage::AddJson(const Json::Value& value)
+{
+    if (value.isString())
+    {
+        // jsoncpp prefixes strings with their length
+        const char* begin;
+        const char* end;
+        if (value.getString(&begin, &end))
+        {
+            json += sizeof(unsigned int) + (end - begin) + 1;
+        }
+    }
+    else if (value.isObject() || value.isArray())
+    {
+        json += sizeof(Json::Value::ObjectValues);
+        for (auto member = value.begin(); member != value.end(); ++member)
+        {
+            json += c_mapNodeSize + sizeof(Json::Value::ObjectValues::value_type);
+
+            // array indices are stored in place
+            const char* nameEnd;
+            if (const char* name = member.memberName(&nameEnd))
+            {
+                json += (nameEnd - name) + 1;
+            }
+
+            AddJson(*member);
+        }
+    }
+}
+
+void MemoryUsage::AddStringSet(const std::unordered_set<std::string>& value)
+{
+    AddHashTable(value);
+    for (const auto& entry : value)
+    {
+        AddString(entry);
+    }
+}
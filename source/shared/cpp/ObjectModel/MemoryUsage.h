@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // Bytes a parsed card takes, by category. It's computed from the sizes of the objects of the card and of the
+    // buffers they own, as the standard library and jsoncpp lay them out, so it doesn't include the overhead of the
+    // allocator. Strings interned through a StringPool and text processed through the TextProcessingCache aren't
+    // counted, since they're shared with other cards.
+    //
+    // Accumulating usage walks the card without allocating, so it may be used to evict cards by size.
+    struct MemoryUsage
+    {
+        MemoryUsage();
+
+        // Elements, actions, inlines and the other objects of the card, with their shared_ptr control blocks
+        size_t elements;
+        // Buffers of strings too long to be stored in place
+        size_t strings;
+        // Members of Json::Values, such as additional properties and action data
+        size_t json;
+        // Buffers of vectors, and buckets and nodes of sets and maps
+        size_t vectors;
+        // Parse warnings, in the usage of a ParseResult
+        size_t warnings;
+        // Cards of Action.ShowCard actions, all categories included
+        size_t showCards;
+
+        size_t GetTotal() const;
+
+        // Adds an object held by a shared_ptr
+        void AddObject(size_t size);
+        void AddString(const std::string& value);
+        void AddJson(const Json::Value& value);
+        void AddStringSet(const std::unordered_set<std::string>& value);
+
+        template<typename T> void AddVector(const std::vector<T>& value) { vectors += value.capacity() * sizeof(T); }
+
+        // Adds the buckets and nodes of an unordered set or map, but not what its values own
+        template<typename T> void AddHashTable(const T& value)
+        {
+            vectors += (value.bucket_count() > 1 ? value.bucket_count() * sizeof(void*) : 0) +
+                       value.size() * (2 * sizeof(void*) + sizeof(typename T::value_type));
+        }
+
+        // Adds a vector of objects, with the objects
+        template<typename T> void AddObjects(const std::vector<std::shared_ptr<T>>& objects)
+        {
+            AddVector(objects);
+            for (const auto& object : objects)
+            {
+                if (object)
+                {
+                    object->AccumulateMemoryUsage(*this);
+                }
+            }
+        }
+    };
+}
@@ -11,7 +11,6 @@ NumberInput::NumberInput() :
     BaseInputElement(CardElementType::NumberInput), m_value(0), m_max(std::numeric_limits<int>::max()),
     m_min(std::numeric_limits<int>::min())
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value NumberInput::SerializeToJsonValue() const
@@ -41,14 +40,14 @@ Json::Value NumberInput::SerializeToJsonValue() const
     return root;
 }
 
-std::string NumberInput::GetPlaceholder() const
+const std::string& NumberInput::GetPlaceholder() const
 {
     return m_placeholder;
 }
 
-void NumberInput::SetPlaceholder(const std::string& value)
+void NumberInput::SetPlaceholder(std::string value)
 {
-    m_placeholder = value;
+    m_placeholder = std::move(value);
 }
 
 int NumberInput::GetValue() const
@@ -81,16 +80,30 @@ void NumberInput::SetMin(const int value)
     m_min = value;
 }
 
-std::shared_ptr<BaseCardElement> NumberInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+void NumberInput::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(NumberInput));
+    BaseInputElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_placeholder);
+}
+
+template<typename TPolicy>
+void NumberInputParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::NumberInput);
 
-    std::shared_ptr<NumberInput> numberInput = BaseInputElement::Deserialize<NumberInput>(context, json);
+    BaseInputElement::ParseProperties(policy, context, json);
 
-    numberInput->SetPlaceholder(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Placeholder));
-    numberInput->SetValue(ParseUtil::GetInt(json, AdaptiveCardSchemaKey::Value, 0));
-    numberInput->SetMax(ParseUtil::GetInt(json, AdaptiveCardSchemaKey::Max, std::numeric_limits<int>::max()));
-    numberInput->SetMin(ParseUtil::GetInt(json, AdaptiveCardSchemaKey::Min, std::numeric_limits<int>::min()));
+    policy.String(json, AdaptiveCardSchemaKey::Placeholder, &NumberInput::SetPlaceholder);
+    policy.Int(json, AdaptiveCardSchemaKey::Value, 0, &NumberInput::SetValue);
+    policy.Int(json, AdaptiveCardSchemaKey::Max, std::numeric_limits<int>::max(), &NumberInput::SetMax);
+    policy.Int(json, AdaptiveCardSchemaKey::Min, std::numeric_limits<int>::min(), &NumberInput::SetMin);
+}
+
+std::shared_ptr<BaseCardElement> NumberInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto numberInput = std::make_shared<NumberInput>();
+    ParseProperties(BuildPolicy<NumberInput>(*numberInput), context, json);
 
     return numberInput;
 }
@@ -101,10 +114,9 @@ NumberInputParser::DeserializeFromString(ParseContext& context, const std::strin
     return NumberInputParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void NumberInput::PopulateKnownPropertiesSet()
+bool NumberInputParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
+    ParseProperties(ValidatePolicy<NumberInput>(), context, json);
+
+    return true;
 }
@@ -19,9 +19,10 @@ namespace AdaptiveSharedNamespace
         ~NumberInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
-        std::string GetPlaceholder() const;
-        void SetPlaceholder(const std::string& value);
+        const std::string& GetPlaceholder() const;
+        void SetPlaceholder(std::string value);
 
         int GetValue() const;
         void SetValue(const int value);
@@ -33,8 +34,6 @@ namespace AdaptiveSharedNamespace
         void SetMin(const int value);
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::string m_placeholder;
         int m_value;
         int m_max;
@@ -53,5 +52,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
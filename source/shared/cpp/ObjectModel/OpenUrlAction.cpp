@@ -9,7 +9,6 @@ using namespace AdaptiveSharedNamespace;
 
 OpenUrlAction::OpenUrlAction() : BaseActionElement(ActionType::OpenUrl)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value OpenUrlAction::SerializeToJsonValue() const
@@ -21,21 +20,35 @@ Json::Value OpenUrlAction::SerializeToJsonValue() const
     return root;
 }
 
-std::string OpenUrlAction::GetUrl() const
+const std::string& OpenUrlAction::GetUrl() const
 {
     return m_url;
 }
 
-void OpenUrlAction::SetUrl(const std::string& value)
+void OpenUrlAction::SetUrl(std::string value)
 {
-    m_url = value;
+    m_url = std::move(value);
 }
 
-std::shared_ptr<BaseActionElement> OpenUrlActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+void OpenUrlAction::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    std::shared_ptr<OpenUrlAction> openUrlAction = BaseActionElement::Deserialize<OpenUrlAction>(context, json);
+    usage.AddObject(sizeof(OpenUrlAction));
+    BaseActionElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_url);
+}
 
-    openUrlAction->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
+template<typename TPolicy>
+void OpenUrlActionParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    BaseActionElement::ParseProperties(policy, context, json);
+
+    policy.String(json, AdaptiveCardSchemaKey::Url, &OpenUrlAction::SetUrl, true);
+}
+
+std::shared_ptr<BaseActionElement> OpenUrlActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto openUrlAction = std::make_shared<OpenUrlAction>();
+    ParseProperties(BuildPolicy<OpenUrlAction>(*openUrlAction), context, json);
 
     return openUrlAction;
 }
@@ -46,7 +59,9 @@ OpenUrlActionParser::DeserializeFromString(ParseContext& context, const std::str
     return OpenUrlActionParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void OpenUrlAction::PopulateKnownPropertiesSet()
+bool OpenUrlActionParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
+    ParseProperties(ValidatePolicy<OpenUrlAction>(), context, json);
+
+    return true;
 }
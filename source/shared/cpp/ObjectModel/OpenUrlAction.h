@@ -19,13 +19,12 @@ namespace AdaptiveSharedNamespace
         ~OpenUrlAction() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
-        std::string GetUrl() const;
-        void SetUrl(const std::string& value);
+        const std::string& GetUrl() const;
+        void SetUrl(std::string value);
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::string m_url;
     };
 
@@ -41,5 +40,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) override;
         std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
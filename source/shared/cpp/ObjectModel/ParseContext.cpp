@@ -5,24 +5,37 @@
 #include "AdaptiveCardParseException.h"
 #include "BaseElement.h"
 #include "CollectionTypeElement.h"
+#include "ToggleVisibilityAction.h"
 
 namespace AdaptiveSharedNamespace
 {
     ParseContext::ParseContext() :
         elementParserRegistration{std::make_shared<ElementParserRegistration>()},
         actionParserRegistration{std::make_shared<ActionParserRegistration>()}, warnings{}, m_idStack{}, m_elementIds{},
-        m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false)
+        m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{}, m_canFallbackToAncestor(false),
+        m_stringPool(std::shared_ptr<StringPool>(), &StringPool::GetDefault()),
+        m_parseObserver(std::shared_ptr<ParseObserver>(), ParseObserver::GetGlobal())
     {
     }
 
     ParseContext::ParseContext(std::shared_ptr<ElementParserRegistration> elementRegistration, std::shared_ptr<ActionParserRegistration> actionRegistration) :
         warnings{}, m_idStack{}, m_elementIds{}, m_parentalContainerStyles{}, m_parentalPadding{}, m_parentalBleedDirection{},
-        m_canFallbackToAncestor(false)
+        m_canFallbackToAncestor(false), m_stringPool(std::shared_ptr<StringPool>(), &StringPool::GetDefault()),
+        m_parseObserver(std::shared_ptr<ParseObserver>(), ParseObserver::GetGlobal())
     {
         elementParserRegistration = (elementRegistration) ? elementRegistration : std::make_shared<ElementParserRegistration>();
         actionParserRegistration = (actionRegistration) ? actionRegistration : std::make_shared<ActionParserRegistration>();
     }
 
+    void ParseContext::AddWarning(WarningStatusCode statusCode, const char* message, const std::string& payload)
+    {
+        m_warningSink.AddWarning(statusCode, message, payload);
+        if (m_cardScopes.empty())
+        {
+            m_warningSink.Flush(warnings);
+        }
+    }
+
     // Detecting ID collisions
     //
     // A word on nomenclature: There are two identifiers in discussion below. "ID" refers to the value of the "id"
@@ -158,7 +171,7 @@ namespace AdaptiveSharedNamespace
     }
 
     // Pop the last id off our stack and perform validation (see comment above)
-    void ParseContext::PopElement()
+    void ParseContext::PopElement(const std::shared_ptr<BaseElement>& element /*=nullptr*/)
     {
         // about to pop an element off the stack. perform collision list maintenance and detection.
         const auto& idsToPop = m_idStack.back();
@@ -222,11 +235,106 @@ namespace AdaptiveSharedNamespace
             {
                 m_elementIds.emplace(std::make_pair(elementId, nearestFallbackId));
             }
+
+            if (element && !m_cardScopes.empty())
+            {
+                m_elementsWithId.emplace_back(elementId, element, nearestFallbackId != InternalId::Invalid);
+            }
         }
 
         m_idStack.pop_back();
     }
 
+    void ParseContext::AddToggleVisibilityAction(const std::shared_ptr<ToggleVisibilityAction>& action)
+    {
+        if (!m_cardScopes.empty())
+        {
+            m_toggleVisibilityActions.push_back(action);
+        }
+    }
+
+    ParseContext::CardScope::CardScope(ParseContext& context) : m_context(context), m_isPopped(false)
+    {
+        m_context.PushCardScope();
+    }
+
+    ParseContext::CardScope::~CardScope()
+    {
+        if (!m_isPopped)
+        {
+            m_context.DropCardScope();
+        }
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<BaseElement>> ParseContext::CardScope::Pop()
+    {
+        m_isPopped = true;
+        return m_context.PopCardScope();
+    }
+
+    void ParseContext::PushCardScope()
+    {
+        m_cardScopes.emplace_back(m_elementsWithId.size(), m_toggleVisibilityActions.size());
+    }
+
+    std::unordered_map<std::string, std::shared_ptr<BaseElement>> ParseContext::PopCardScope()
+    {
+        const auto scope = m_cardScopes.back();
+        m_cardScopes.pop_back();
+
+        // Fallback content may share an id with the element it's fallback for, in which case the element itself wins.
+        // Fallback content is always popped before its parent, so later non-fallback entries overwrite earlier ones.
+        std::unordered_map<std::string, std::shared_ptr<BaseElement>> index;
+        for (auto entry = m_elementsWithId.cbegin() + scope.first; entry != m_elementsWithId.cend(); ++entry)
+        {
+            if (std::get<2>(*entry))
+            {
+                index.emplace(std::get<0>(*entry), std::get<1>(*entry));
+            }
+            else
+            {
+                index[std::get<0>(*entry)] = std::get<1>(*entry);
+            }
+        }
+
+        // Targets in a nested card may refer to elements of an enclosing card, so they're resolved again (against a
+        // superset of this index) when the enclosing scope is popped.
+        for (auto action = m_toggleVisibilityActions.cbegin() + scope.second; action != m_toggleVisibilityActions.cend(); ++action)
+        {
+            for (const auto& target : (*action)->GetTargetElements())
+            {
+                const auto element = index.find(target->GetElementId());
+                if (element != index.end())
+                {
+                    target->SetElement(element->second);
+                }
+            }
+        }
+
+        // Don't keep elements alive once the outermost card is done
+        if (m_cardScopes.empty())
+        {
+            m_elementsWithId.clear();
+            m_toggleVisibilityActions.clear();
+            m_warningSink.Flush(warnings);
+        }
+
+        return index;
+    }
+
+    void ParseContext::DropCardScope() noexcept
+    {
+        const auto scope = m_cardScopes.back();
+        m_cardScopes.pop_back();
+
+        m_elementsWithId.erase(m_elementsWithId.begin() + scope.first, m_elementsWithId.end());
+        m_toggleVisibilityActions.erase(m_toggleVisibilityActions.begin() + scope.second, m_toggleVisibilityActions.end());
+        if (m_cardScopes.empty())
+        {
+            m_warningSink.Clear();
+        }
+    }
+
     // Walk stack looking for first element to be marked fallback (which isn't the ID we're supposed to skip), then
     // return its internal ID. If none, return an invalid ID. (see comment above)
     const AdaptiveSharedNamespace::InternalId ParseContext::GetNearestFallbackId(const AdaptiveSharedNamespace::InternalId& skipId) const
@@ -323,7 +431,36 @@ namespace AdaptiveSharedNamespace
 
     void ParseContext::PopBleedDirection() { m_parentalBleedDirection.pop_back(); }
 
-    void ParseContext::SetLanguage(const std::string& value) { m_language = value; }
+    void ParseContext::SetLanguage(std::string value) { m_language = Intern(std::move(value)); }
+
+    const std::string& ParseContext::GetLanguage() const { return m_language.Get(); }
+
+    // the default pool isn't owned by any context, so it's referred to by a shared_ptr that doesn't own it either
+    void ParseContext::SetStringPool(std::shared_ptr<StringPool> stringPool)
+    {
+        m_stringPool = stringPool ? std::move(stringPool) : std::shared_ptr<StringPool>(std::shared_ptr<StringPool>(), &StringPool::GetDefault());
+    }
+
+    void ParseContext::SetParseObserver(std::shared_ptr<ParseObserver> observer)
+    {
+        m_parseObserver = observer ? std::move(observer) : std::shared_ptr<ParseObserver>(std::shared_ptr<ParseObserver>(), ParseObserver::GetGlobal());
+    }
 
-    std::string ParseContext::GetLanguage() const { return m_language; }
+    ParseEvent ParseContext::MakeParseEvent(ParseEventKind kind, const Json::Value& json) const
+    {
+        ParseEvent event{kind, "", static_cast<unsigned int>(m_idStack.size()), 0};
+        if (json.isObject())
+        {
+            const auto& type = json[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)];
+            if (type.isString())
+            {
+                event.type = type.asString();
+            }
+        }
+        if (json.getOffsetLimit() > json.getOffsetStart())
+        {
+            event.bytes = static_cast<size_t>(json.getOffsetLimit() - json.getOffsetStart());
+        }
+        return event;
+    }
 }
@@ -7,12 +7,16 @@
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
 #include "AdaptiveCardParseWarning.h"
+#include "ParseObserver.h"
+#include "ParseWarningSink.h"
+#include "StringPool.h"
 
 namespace AdaptiveSharedNamespace
 {
     class BaseElement;
     class InternalId;
     class CollectionTypeElement;
+    class ToggleVisibilityAction;
     class ParseContext
     {
     public:
@@ -23,18 +27,82 @@ namespace AdaptiveSharedNamespace
         std::shared_ptr<ElementParserRegistration> elementParserRegistration;
         std::shared_ptr<ActionParserRegistration> actionParserRegistration;
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings;
+
+        // Warnings raised while a card is being parsed are aggregated in the warning sink, and are formatted into
+        // warnings once the outermost card has been parsed. Outside of a card they're added to warnings right away.
+        void AddWarning(WarningStatusCode statusCode, const char* message, const std::string& payload = "");
+        ParseWarningSink& GetWarningSink() { return m_warningSink; }
+        const ParseWarningSink& GetWarningSink() const { return m_warningSink; }
+
         // Push/PopElement are used during parsing to track the tree structure of a card.
         void PushElement(const std::string& idJsonProperty,
                          const AdaptiveSharedNamespace::InternalId& internalId,
                          const bool isFallback = false);
-        void PopElement();
+        void PopElement(const std::shared_ptr<BaseElement>& element = nullptr);
+
+        // Elements with an id and Action.ToggleVisibility actions are recorded as they're popped, so a card can build
+        // its id index without walking its elements again. A CardScope starts recording for a card as it's
+        // constructed; Pop returns the index of every element recorded since then (including nested Action.ShowCard
+        // cards) and resolves the targets of the toggle visibility actions recorded in that scope. A scope destroyed
+        // without having been popped, as when parsing the card throws, is dropped along with what it recorded.
+        void AddToggleVisibilityAction(const std::shared_ptr<ToggleVisibilityAction>& action);
+
+        class CardScope
+        {
+        public:
+            explicit CardScope(ParseContext& context);
+            CardScope(const CardScope&) = delete;
+            CardScope& operator=(const CardScope&) = delete;
+            ~CardScope();
+
+            std::unordered_map<std::string, std::shared_ptr<BaseElement>> Pop();
+
+        private:
+            ParseContext& m_context;
+            bool m_isPopped;
+        };
 
         // tells if it's possible to fallback to ancestor
         bool GetCanFallbackToAncestor() const { return m_canFallbackToAncestor; }
         void SetCanFallbackToAncestor(bool value) { m_canFallbackToAncestor = value; }
 
-        void SetLanguage(const std::string& value);
-        std::string GetLanguage() const;
+        void SetLanguage(std::string value);
+        const std::string& GetLanguage() const;
+        const InternedString& GetInternedLanguage() const { return m_language; }
+
+        // Strings that repeat across elements are interned in the string pool, which is the process-wide default pool
+        // unless the host sets one for the parse
+        void SetStringPool(std::shared_ptr<StringPool> stringPool);
+        StringPool& GetStringPool() const { return *m_stringPool; }
+        InternedString Intern(std::string value) const { return m_stringPool->Intern(std::move(value)); }
+
+        // The parse notifies the observer, which is the global ParseObserver unless the host sets one for the parse
+        void SetParseObserver(std::shared_ptr<ParseObserver> observer);
+        ParseObserver* GetParseObserver() const { return m_parseObserver.get(); }
+
+        // Runs parse, notifying the observer around it if there is one. The event of an element or action takes its
+        // type and byte span from its json.
+        template<typename TParse> auto Observe(ParseEventKind kind, const Json::Value& json, TParse&& parse) -> decltype(parse())
+        {
+            if (!m_parseObserver)
+            {
+                return parse();
+            }
+
+            ParseObserver::Scope scope(*m_parseObserver, MakeParseEvent(kind, json));
+            return parse();
+        }
+
+        template<typename TParse> auto Observe(ParseEventKind kind, size_t bytes, TParse&& parse) -> decltype(parse())
+        {
+            if (!m_parseObserver)
+            {
+                return parse();
+            }
+
+            ParseObserver::Scope scope(*m_parseObserver, {kind, "", 0, bytes});
+            return parse();
+        }
 
         ContainerStyle GetParentalContainerStyle() const;
         void SetParentalContainerStyle(const ContainerStyle style);
@@ -47,6 +115,11 @@ namespace AdaptiveSharedNamespace
         void PopBleedDirection();
 
     private:
+        void PushCardScope();
+        std::unordered_map<std::string, std::shared_ptr<BaseElement>> PopCardScope();
+        void DropCardScope() noexcept;
+
+        ParseEvent MakeParseEvent(ParseEventKind kind, const Json::Value& json) const;
         const AdaptiveSharedNamespace::InternalId GetNearestFallbackId(const AdaptiveSharedNamespace::InternalId& skipId) const;
         // This enum is just a helper to keep track of the position of contents within the std::tuple used in
         // m_idStack below. We don't use enum class here because we don't want typed values for use in std::get
@@ -72,11 +145,21 @@ namespace AdaptiveSharedNamespace
         //                             (ID,  internal ID, isFallback)[]
         std::vector<std::tuple<std::string, AdaptiveSharedNamespace::InternalId, bool>> m_idStack;
 
+        // Elements with an id in the order they were popped, and whether they were parsed as fallback content. A card
+        // scope is the pair of positions in m_elementsWithId and m_toggleVisibilityActions at the time it was pushed.
+        std::vector<std::tuple<std::string, std::shared_ptr<BaseElement>, bool>> m_elementsWithId;
+        std::vector<std::shared_ptr<ToggleVisibilityAction>> m_toggleVisibilityActions;
+        std::vector<std::pair<size_t, size_t>> m_cardScopes;
+
+        ParseWarningSink m_warningSink;
+
         std::vector<ContainerStyle> m_parentalContainerStyles;
         std::vector<AdaptiveSharedNamespace::InternalId> m_parentalPadding;
         std::vector<ContainerBleedDirection> m_parentalBleedDirection;
 
         bool m_canFallbackToAncestor;
-        std::string m_language;
+        InternedString m_language;
+        std::shared_ptr<StringPool> m_stringPool;
+        std::shared_ptr<ParseObserver> m_parseObserver;
     };
 }
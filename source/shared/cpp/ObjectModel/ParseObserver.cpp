@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseObserver.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    std::shared_ptr<ParseObserver>& GetGlobalOwner()
+    {
+        static std::shared_ptr<ParseObserver> owner;
+        return owner;
+    }
+
+    unsigned int GetBucket(unsigned long long nanoseconds)
+    {
+        unsigned int bucket = 0;
+        while (nanoseconds > 1)
+        {
+            nanoseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+}
+
+std::atomic<ParseObserver*> ParseObserver::s_global{nullptr};
+
+const char* AdaptiveSharedNamespace::ParseEventKindToString(ParseEventKind kind)
+{
+    switch (kind)
+    {
+    case ParseEventKind::JsonRead:
+        return "JsonRead";
+    case ParseEventKind::Element:
+        return "Element";
+    case ParseEventKind::Action:
+        return "Action";
+    case ParseEventKind::MarkDown:
+        return "MarkDown";
+    case ParseEventKind::DateTimePreparse:
+        return "DateTimePreparse";
+    case ParseEventKind::HostConfig:
+        return "HostConfig";
+    }
+    return "";
+}
+
+void ParseObserver::SetGlobal(std::shared_ptr<ParseObserver> observer)
+{
+    s_global = observer.get();
+    GetGlobalOwner() = std::move(observer);
+}
+
+ParseObserver::Scope::Scope(ParseObserver& observer, ParseEvent event) :
+    m_observer(observer), m_event(std::move(event)), m_start(std::chrono::steady_clock::now())
+{
+    m_observer.OnBegin(m_event);
+}
+
+ParseObserver::Scope::~Scope()
+{
+    m_observer.OnEnd(m_event, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start));
+}
+
+ParseHistogram::ParseHistogram() : count(0), totalNanoseconds(0), maxNanoseconds(0), totalBytes(0), maxDepth(0), buckets{}
+{
+}
+
+unsigned long long ParseHistogram::GetPercentileNanoseconds(double fraction) const
+{
+    const double target = fraction * count;
+    unsigned long long seen = 0;
+    for (size_t bucket = 0; bucket < buckets.size(); ++bucket)
+    {
+        seen += buckets[bucket];
+        if (seen > 0 && seen >= target)
+        {
+            return std::min(maxNanoseconds, (2ULL << bucket) - 1);
+        }
+    }
+    return maxNanoseconds;
+}
+
+Json::Value ParseHistogram::SerializeToJsonValue() const
+{
+    Json::Value root;
+    root["count"] = static_cast<Json::UInt64>(count);
+    root["totalNanoseconds"] = static_cast<Json::UInt64>(totalNanoseconds);
+    root["maxNanoseconds"] = static_cast<Json::UInt64>(maxNanoseconds);
+    root["p50Nanoseconds"] = static_cast<Json::UInt64>(GetPercentileNanoseconds(0.5));
+    root["p99Nanoseconds"] = static_cast<Json::UInt64>(GetPercentileNanoseconds(0.99));
+    root["totalBytes"] = static_cast<Json::UInt64>(totalBytes);
+    root["maxDepth"] = maxDepth;
+
+    // buckets up to the last non-empty one
+    size_t end = buckets.size();
+    while (end > 0 && buckets[end - 1] == 0)
+    {
+        --end;
+    }
+    Json::Value bucketsJson(Json::arrayValue);
+    for (size_t bucket = 0; bucket < end; ++bucket)
+    {
+        bucketsJson.append(static_cast<Json::UInt64>(buckets[bucket]));
+    }
+    root["log2NanosecondBuckets"] = bucketsJson;
+    return root;
+}
+
+void ParseHistogramCollector::OnEnd(const ParseEvent& event, std::chrono::nanoseconds duration)
+{
+    const auto nanoseconds = static_cast<unsigned long long>(std::max<std::chrono::nanoseconds::rep>(duration.count(), 0));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& histogram = m_histograms[std::make_pair(event.kind, event.type)];
+    ++histogram.count;
+    histogram.totalNanoseconds += nanoseconds;
+    histogram.maxNanoseconds = std::max(histogram.maxNanoseconds, nanoseconds);
+    histogram.totalBytes += event.bytes;
+    histogram.maxDepth = std::max(histogram.maxDepth, event.depth);
+    ++histogram.buckets[GetBucket(nanoseconds)];
+}
+
+std::map<std::string, ParseHistogram> ParseHistogramCollector::GetHistograms() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::map<std::string, ParseHistogram> histograms;
+    for (const auto& entry : m_histograms)
+    {
+        std::string name = ParseEventKindToString(entry.first.first);
+        if (!entry.first.second.empty())
+        {
+            name += "/" + entry.first.second;
+        }
+        histograms.emplace(std::move(name), entry.second);
+    }
+    return histograms;
+}
+
+Json::Value ParseHistogramCollector::SerializeToJsonValue() const
+{
+    Json::Value root(Json::objectValue);
+    for (const auto& entry : GetHistograms())
+    {
+        root[entry.first] = entry.second.SerializeToJsonValue();
+    }
+    return root;
+}
+
+void ParseHistogramCollector::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_histograms.clear();
+}
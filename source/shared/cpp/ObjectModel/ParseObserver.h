@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+namespace AdaptiveSharedNamespace
+{
+    enum class ParseEventKind
+    {
+        // Reading json text into a Json::Value
+        JsonRead = 0,
+        // Parsing an element, including the elements it holds
+        Element,
+        // Parsing an action, including the card of an Action.ShowCard
+        Action,
+        // Transforming MarkDown to html or to inline runs
+        MarkDown,
+        // Finding the dates and times of a text
+        DateTimePreparse,
+        // Reading a host config over the default host config
+        HostConfig
+    };
+
+    const char* ParseEventKindToString(ParseEventKind kind);
+
+    struct ParseEvent
+    {
+        ParseEventKind kind;
+        // Type of the element or action, such as "TextBlock"; empty for the other kinds
+        std::string type;
+        // Number of elements and actions the element or action is nested in; 0 for the other kinds
+        unsigned int depth;
+        // Length of the json or text that is parsed, when it's known
+        size_t bytes;
+    };
+
+    // Observer of the parsing of cards, host configs, MarkDown and dates, to find out what a slow parse spends its time
+    // on. Events nest: the events of the elements of a container happen between the begin and the end of the event of
+    // the container, and its duration includes theirs. OnEnd is called even when parsing throws.
+    //
+    // Parse contexts notify the observer they're given, or the global observer if they aren't given one. MarkDown,
+    // dates and host configs, which are parsed without a context, notify the global observer. Without an observer,
+    // observing a parse costs a single branch.
+    class ParseObserver
+    {
+    public:
+        virtual ~ParseObserver() = default;
+
+        virtual void OnBegin(const ParseEvent& /*event*/) {}
+        virtual void OnEnd(const ParseEvent& event, std::chrono::nanoseconds duration) = 0;
+
+        // The global observer is used from any thread, so it must be thread safe. It's meant to be set before parsing
+        // starts: it mustn't be replaced while parses may be using it.
+        static void SetGlobal(std::shared_ptr<ParseObserver> observer);
+        static ParseObserver* GetGlobal() { return s_global.load(std::memory_order_relaxed); }
+
+        // Runs parse, notifying the global observer around it if there is one
+        template<typename TParse> static auto Observe(ParseEventKind kind, size_t bytes, TParse&& parse) -> decltype(parse())
+        {
+            ParseObserver* observer = GetGlobal();
+            if (observer == nullptr)
+            {
+                return parse();
+            }
+
+            Scope scope(*observer, {kind, "", 0, bytes});
+            return parse();
+        }
+
+        // Notifies an observer of the begin of an event as it's constructed and of its end as it's destroyed
+        class Scope
+        {
+        public:
+            Scope(ParseObserver& observer, ParseEvent event);
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+            ~Scope();
+
+        private:
+            ParseObserver& m_observer;
+            ParseEvent m_event;
+            std::chrono::steady_clock::time_point m_start;
+        };
+
+    private:
+        static std::atomic<ParseObserver*> s_global;
+    };
+
+    struct ParseHistogram
+    {
+        ParseHistogram();
+
+        unsigned long long count;
+        unsigned long long totalNanoseconds;
+        unsigned long long maxNanoseconds;
+        unsigned long long totalBytes;
+        unsigned int maxDepth;
+        // buckets[i] counts the events that took from 2^i up to 2^(i+1) nanoseconds; buckets[0] also counts those
+        // that took less than a nanosecond
+        std::array<unsigned long long, 64> buckets;
+
+        // Upper bound of the duration of the given fraction of the events, such as 0.99
+        unsigned long long GetPercentileNanoseconds(double fraction) const;
+
+        Json::Value SerializeToJsonValue() const;
+    };
+
+    // Observer that collects a histogram of the durations of the events of each kind and element type
+    class ParseHistogramCollector : public ParseObserver
+    {
+    public:
+        ParseHistogramCollector() = default;
+        ParseHistogramCollector(const ParseHistogramCollector&) = delete;
+        ParseHistogramCollector& operator=(const ParseHistogramCollector&) = delete;
+
+        void OnEnd(const ParseEvent& event, std::chrono::nanoseconds duration) override;
+
+        // Histograms by kind and type, such as "Element/TextBlock", "Action/Action.Submit" or "MarkDown"
+        std::map<std::string, ParseHistogram> GetHistograms() const;
+        Json::Value SerializeToJsonValue() const;
+        void Reset();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::map<std::pair<ParseEventKind, std::string>, ParseHistogram> m_histograms;
+    };
+}
@@ -0,0 +1,271 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "ParseUtil.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class BaseElement;
+
+    // Parsers walk the properties of what they parse once, with one of the policies below, so that deserializing and
+    // validating share their checks. The walk reads each property with the setter that stores it: BuildPolicy reads
+    // it into the object being built, and ValidatePolicy checks it as reading it would (throwing what reading throws)
+    // without copying it out of the json. What only building does, such as interning or updating the context, goes
+    // under "if (auto object = policy.Object())", as ValidatePolicy has no object.
+    //
+    // A setter is a member function, a data member or a callable taking the object and the value.
+    namespace ParsePolicyDetail
+    {
+        template<typename TObject, typename TSetter, typename TValue>
+        void Assign(TObject& object, TSetter setter, TValue&& value)
+        {
+            setter(object, std::forward<TValue>(value));
+        }
+
+        template<typename TObject, typename TClass, typename TMember, typename TValue>
+        void AssignMember(TObject& object, TMember TClass::*setter, TValue&& value, std::true_type /*isMemberFunction*/)
+        {
+            (object.*setter)(std::forward<TValue>(value));
+        }
+
+        template<typename TObject, typename TClass, typename TMember, typename TValue>
+        void AssignMember(TObject& object,
+                          TMember TClass::*member,
+                          TValue&& value,
+                          std::false_type /*isMemberFunction*/)
+        {
+            object.*member = std::forward<TValue>(value);
+        }
+
+        template<typename TObject, typename TClass, typename TMember, typename TValue>
+        void Assign(TObject& object, TMember TClass::*member, TValue&& value)
+        {
+            AssignMember(object, member, std::forward<TValue>(value), std::is_function<TMember>());
+        }
+
+        // The item type of the collections a parser's Deserialize makes items for
+        template<typename TParser>
+        using ItemType = typename decltype(
+            TParser::Deserialize(std::declval<ParseContext&>(), std::declval<const Json::Value&>()))::element_type;
+    }
+
+    template<typename T> class BuildPolicy
+    {
+    public:
+        explicit BuildPolicy(T& object) : m_object(object) {}
+
+        T* Object() const { return &m_object; }
+
+        // The policy for a part of the object, such as its text properties
+        template<typename TPart, typename TClass> BuildPolicy<TPart> Part(TPart TClass::*part) const
+        {
+            return BuildPolicy<TPart>(m_object.*part);
+        }
+
+        template<typename TSetter, typename TValue> void Set(TSetter setter, TValue&& value) const
+        {
+            ParsePolicyDetail::Assign(m_object, setter, std::forward<TValue>(value));
+        }
+
+        template<typename TSetter>
+        void String(const Json::Value& json, AdaptiveCardSchemaKey key, TSetter setter, bool isRequired = false) const
+        {
+            Set(setter, ParseUtil::GetString(json, key, isRequired));
+        }
+
+        template<typename TSetter>
+        void String(const Json::Value& json,
+                    AdaptiveCardSchemaKey key,
+                    const std::string& defaultValue,
+                    TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetString(json, key, defaultValue));
+        }
+
+        template<typename TSetter>
+        void Bool(const Json::Value& json,
+                  AdaptiveCardSchemaKey key,
+                  bool defaultValue,
+                  TSetter setter,
+                  bool isRequired = false) const
+        {
+            Set(setter, ParseUtil::GetBool(json, key, defaultValue, isRequired));
+        }
+
+        template<typename TSetter>
+        void UInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetUInt(json, key, defaultValue));
+        }
+
+        template<typename TSetter>
+        void Int(const Json::Value& json, AdaptiveCardSchemaKey key, int defaultValue, TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetInt(json, key, defaultValue));
+        }
+
+        template<typename TEnum, typename TSetter>
+        void Enum(const Json::Value& json,
+                  AdaptiveCardSchemaKey key,
+                  TEnum defaultValue,
+                  TEnum (*fromString)(const std::string&),
+                  TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetEnumValue<TEnum>(json, key, defaultValue, fromString));
+        }
+
+        template<typename TSetter> void BackgroundImage(const Json::Value& json, TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetBackgroundImage(json));
+        }
+
+        template<typename TElement, typename TSetter>
+        void Elements(bool isTopToBottomContainer,
+                      ParseContext& context,
+                      const Json::Value& json,
+                      AdaptiveCardSchemaKey key,
+                      TSetter setter,
+                      bool isRequired = false,
+                      const std::string& impliedType = std::string()) const
+        {
+            Set(setter,
+                ParseUtil::GetElementCollection<TElement>(
+                    isTopToBottomContainer, context, json, key, isRequired, impliedType));
+        }
+
+        // Items of a single type, which TParser's Deserialize and Validate parse
+        template<typename TParser, typename TSetter>
+        void Items(ParseContext& context,
+                   const Json::Value& json,
+                   AdaptiveCardSchemaKey key,
+                   TSetter setter,
+                   bool isRequired = false) const
+        {
+            Set(setter,
+                ParseUtil::GetElementCollectionOfSingleType<ParsePolicyDetail::ItemType<TParser>>(
+                    context, json, key, TParser::Deserialize, isRequired));
+        }
+
+        template<typename TSetter>
+        void Actions(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetActionCollection(context, json, key));
+        }
+
+        template<typename TSetter>
+        void Action(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, TSetter setter) const
+        {
+            Set(setter, ParseUtil::GetAction(context, json, key));
+        }
+
+        // Parses json as an element of TElementKind (BaseCardElement or BaseActionElement), returning whether it's one
+        template<typename TElementKind>
+        bool Element(ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element) const
+        {
+            TElementKind::ParseJsonObject(context, json, element);
+            return element != nullptr;
+        }
+
+    private:
+        T& m_object;
+    };
+
+    template<typename T> class ValidatePolicy
+    {
+    public:
+        T* Object() const { return nullptr; }
+
+        template<typename TPart, typename TClass> ValidatePolicy<TPart> Part(TPart TClass::*) const
+        {
+            return ValidatePolicy<TPart>();
+        }
+
+        template<typename TSetter, typename TValue> void Set(TSetter, TValue&&) const {}
+
+        template<typename TSetter>
+        void String(const Json::Value& json, AdaptiveCardSchemaKey key, TSetter, bool isRequired = false) const
+        {
+            ParseUtil::ValidateString(json, key, isRequired);
+        }
+
+        template<typename TSetter>
+        void String(const Json::Value& json, AdaptiveCardSchemaKey key, const std::string&, TSetter) const
+        {
+            ParseUtil::ValidateString(json, key);
+        }
+
+        template<typename TSetter>
+        void Bool(const Json::Value& json, AdaptiveCardSchemaKey key, bool, TSetter, bool isRequired = false) const
+        {
+            ParseUtil::ValidateBool(json, key, isRequired);
+        }
+
+        template<typename TSetter>
+        void UInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int, TSetter) const
+        {
+            ParseUtil::ValidateUInt(json, key);
+        }
+
+        template<typename TSetter> void Int(const Json::Value& json, AdaptiveCardSchemaKey key, int, TSetter) const
+        {
+            ParseUtil::ValidateInt(json, key);
+        }
+
+        template<typename TEnum, typename TSetter>
+        void Enum(const Json::Value& json,
+                  AdaptiveCardSchemaKey key,
+                  TEnum,
+                  TEnum (*)(const std::string&),
+                  TSetter) const
+        {
+            ParseUtil::ValidateEnumValue(json, key);
+        }
+
+        template<typename TSetter> void BackgroundImage(const Json::Value& json, TSetter) const
+        {
+            ParseUtil::ValidateBackgroundImage(json);
+        }
+
+        template<typename TElement, typename TSetter>
+        void Elements(bool /*isTopToBottomContainer*/,
+                      ParseContext& context,
+                      const Json::Value& json,
+                      AdaptiveCardSchemaKey key,
+                      TSetter,
+                      bool isRequired = false,
+                      const std::string& impliedType = std::string()) const
+        {
+            ParseUtil::ValidateElementCollection<TElement>(context, json, key, isRequired, impliedType);
+        }
+
+        template<typename TParser, typename TSetter>
+        void Items(ParseContext& context,
+                   const Json::Value& json,
+                   AdaptiveCardSchemaKey key,
+                   TSetter,
+                   bool isRequired = false) const
+        {
+            ParseUtil::ValidateElementCollectionOfSingleType(context, json, key, TParser::Validate, isRequired);
+        }
+
+        template<typename TSetter>
+        void Actions(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, TSetter) const
+        {
+            ParseUtil::ValidateActionCollection(context, json, key);
+        }
+
+        template<typename TSetter>
+        void Action(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, TSetter) const
+        {
+            ParseUtil::ValidateAction(context, json, key);
+        }
+
+        template<typename TElementKind>
+        bool Element(ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>&) const
+        {
+            return TElementKind::ValidateJsonObject(context, json);
+        }
+    };
+}
@@ -4,6 +4,7 @@
 #include "ParseResult.h"
 #include "ParseResult.h"
 #include "SharedAdaptiveCard.h"
+#include "AdaptiveCardParseWarning.h"
 
 using namespace AdaptiveSharedNamespace;
 
@@ -21,3 +22,13 @@ std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ParseResult::GetWarnings(
 {
     return m_warnings;
 }
+
+MemoryUsage ParseResult::GetMemoryUsage() const
+{
+    MemoryUsage usage = m_adaptiveCard ? m_adaptiveCard->GetMemoryUsage() : MemoryUsage();
+
+    MemoryUsage warningsUsage;
+    warningsUsage.AddObjects(m_warnings);
+    usage.warnings += warningsUsage.GetTotal();
+    return usage;
+}
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "pch.h"
+#include "MemoryUsage.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -17,6 +18,9 @@ namespace AdaptiveSharedNamespace
         std::shared_ptr<AdaptiveCard> GetAdaptiveCard() const;
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> GetWarnings() const;
 
+        // Memory usage of the card, with the warnings
+        MemoryUsage GetMemoryUsage() const;
+
     private:
         std::shared_ptr<AdaptiveCard> m_adaptiveCard;
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
@@ -9,6 +9,246 @@
 #include "Container.h"
 #include "ShowCardAction.h"
 
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    // Like Json::Value::get, but returns a reference rather than a copy of the member, and returns null rather than
+    // throwing a Json::LogicError when json isn't an object, such as an array in an array of elements
+    const Json::Value& FindMember(const Json::Value& json, const std::string& name)
+    {
+        if (!json.isObject())
+        {
+            return Json::Value::nullSingleton();
+        }
+
+        const Json::Value* member = json.find(name.data(), name.data() + name.size());
+        return member ? *member : Json::Value::nullSingleton();
+    }
+
+    // AdaptiveCardSchemaKeyToString returns a copy of the name, which allocates for the longer ones
+    const std::string& GetKeyName(AdaptiveCardSchemaKey key)
+    {
+        return EnumHelpers::getAdaptiveCardSchemaKeyEnum().toString(key);
+    }
+
+    bool IsString(const Json::Value& value) { return value.isString(); }
+    bool IsBool(const Json::Value& value) { return value.isBool(); }
+    bool IsUInt(const Json::Value& value) { return value.isUInt(); }
+    bool IsInt(const Json::Value& value) { return value.isInt(); }
+    bool IsConvertibleToString(const Json::Value& value) { return value.isConvertibleTo(Json::stringValue); }
+
+    // Completes "Value for property <name>" when the property has the wrong type
+    constexpr const char* InvalidStringMessage = " was invalid. Expected type string.";
+    constexpr const char* InvalidValueAsStringMessage = " was invalid. Expected a string or a number.";
+    constexpr const char* InvalidBoolMessage = " was invalid. Expected type bool.";
+    constexpr const char* InvalidUIntMessage = " was invalid. Expected type uInt.";
+    constexpr const char* InvalidIntMessage = " was invalid. Expected type int.";
+
+    // The member of json named by key, checked with isOfType. A missing or empty member is null, unless it's required.
+    // The getters and their validation counterparts both throw from here, so they throw the same exceptions.
+    const Json::Value& GetMemberOfType(const Json::Value& json,
+                                       AdaptiveCardSchemaKey key,
+                                       bool isRequired,
+                                       bool (*isOfType)(const Json::Value&),
+                                       const char* invalidTypeMessage)
+    {
+        const std::string& propertyName = GetKeyName(key);
+        const auto& propertyValue = FindMember(json, propertyName);
+        if (propertyValue.empty())
+        {
+            if (isRequired)
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
+                                                 "Property is required but was found empty: " + propertyName);
+            }
+            return Json::Value::nullSingleton();
+        }
+
+        if (!isOfType(propertyValue))
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                             "Value for property " + propertyName + invalidTypeMessage);
+        }
+
+        return propertyValue;
+    }
+
+    bool IsNonEmptyString(const Json::Value& value)
+    {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        return value.isString() && value.getString(&begin, &end) && begin != end;
+    }
+
+    bool IsAsciiAlpha(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+    bool IsAsciiDigit(char c) { return c >= '0' && c <= '9'; }
+    bool IsAsciiAlphanum(char c) { return IsAsciiAlpha(c) || IsAsciiDigit(c); }
+    char ToAsciiLowercase(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+    // A single subtag of a language tag, i.e. the text between two hyphens
+    struct Subtag
+    {
+        const char* begin;
+        size_t length;
+
+        bool IsAlpha(size_t minLength, size_t maxLength) const
+        {
+            return length >= minLength && length <= maxLength && std::all_of(begin, begin + length, IsAsciiAlpha);
+        }
+
+        bool IsDigit(size_t minLength, size_t maxLength) const
+        {
+            return length >= minLength && length <= maxLength && std::all_of(begin, begin + length, IsAsciiDigit);
+        }
+
+        bool IsAlphanum(size_t minLength, size_t maxLength) const
+        {
+            return length >= minLength && length <= maxLength && std::all_of(begin, begin + length, IsAsciiAlphanum);
+        }
+    };
+
+    // Grandfathered tags that don't follow the langtag production
+    bool IsIrregularGrandfatheredTag(const std::string& value)
+    {
+        static const char* const irregularTags[] = {"en-gb-oed", "i-ami", "i-bnn", "i-default", "i-enochian", "i-hak",
+                                                    "i-klingon", "i-lux", "i-mingo", "i-navajo", "i-pwn", "i-tao",
+                                                    "i-tay", "i-tsu", "sgn-be-fr", "sgn-be-nl", "sgn-ch-de"};
+        for (const char* tag : irregularTags)
+        {
+            size_t i = 0;
+            while (i < value.size() && tag[i] != '\0' && ToAsciiLowercase(value[i]) == tag[i])
+            {
+                ++i;
+            }
+            if (i == value.size() && tag[i] == '\0')
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reads the subtags of a language tag in place, one at a time
+    class SubtagReader
+    {
+    public:
+        explicit SubtagReader(const std::string& value) : m_next(value.data()), m_end(value.data() + value.size())
+        {
+            Advance();
+        }
+
+        bool AtEnd() const { return m_atEnd; }
+        const Subtag& Current() const { return m_current; }
+        bool IsPrivateUse() const
+        {
+            return !m_atEnd && m_current.length == 1 && ToAsciiLowercase(*m_current.begin) == 'x';
+        }
+
+        // Is at a subtag satisfying the predicate, and moves past it if so
+        template<typename TPredicate> bool Skip(TPredicate&& predicate)
+        {
+            if (m_atEnd || !predicate(m_current))
+            {
+                return false;
+            }
+            Advance();
+            return true;
+        }
+
+        void Advance()
+        {
+            if (m_next == nullptr)
+            {
+                m_atEnd = true;
+                return;
+            }
+
+            const char* hyphen = std::find(m_next, m_end, '-');
+            m_current = {m_next, static_cast<size_t>(hyphen - m_next)};
+            m_next = (hyphen == m_end) ? nullptr : hyphen + 1;
+        }
+
+    private:
+        const char* m_next;
+        const char* m_end;
+        Subtag m_current{};
+        bool m_atEnd = false;
+    };
+
+    // langtag    = language ["-" script] ["-" region] *("-" variant) *("-" extension) ["-" privateuse]
+    // language   = 2*3ALPHA ["-" extlang] / 4ALPHA / 5*8ALPHA, where extlang = 3ALPHA *2("-" 3ALPHA)
+    // script     = 4ALPHA
+    // region     = 2ALPHA / 3DIGIT
+    // variant    = 5*8alphanum / (DIGIT 3alphanum)
+    // extension  = singleton 1*("-" (2*8alphanum)), where singleton is any alphanum but "x"
+    // privateuse = "x" 1*("-" (1*8alphanum))
+    bool IsWellFormedLanguageTag(const std::string& value)
+    {
+        SubtagReader subtags(value);
+
+        // A private use tag on its own
+        if (!subtags.IsPrivateUse())
+        {
+            if (!subtags.Current().IsAlpha(2, 8))
+            {
+                return false;
+            }
+
+            const bool isShortLanguage = subtags.Current().length <= 3;
+            subtags.Advance();
+            if (isShortLanguage)
+            {
+                const auto isExtlang = [](const Subtag& s) { return s.IsAlpha(3, 3); };
+                for (size_t extlangs = 0; extlangs < 3 && subtags.Skip(isExtlang); ++extlangs)
+                {
+                }
+            }
+
+            subtags.Skip([](const Subtag& s) { return s.IsAlpha(4, 4); });
+            subtags.Skip([](const Subtag& s) { return s.IsAlpha(2, 2) || s.IsDigit(3, 3); });
+
+            while (subtags.Skip([](const Subtag& s) {
+                return s.IsAlphanum(5, 8) || (s.length == 4 && IsAsciiDigit(*s.begin) && s.IsAlphanum(4, 4));
+            }))
+            {
+            }
+
+            while (!subtags.AtEnd() && subtags.Current().IsAlphanum(1, 1) && !subtags.IsPrivateUse())
+            {
+                subtags.Advance();
+                if (!subtags.Skip([](const Subtag& s) { return s.IsAlphanum(2, 8); }))
+                {
+                    return false;
+                }
+                while (subtags.Skip([](const Subtag& s) { return s.IsAlphanum(2, 8); }))
+                {
+                }
+            }
+
+            if (subtags.AtEnd())
+            {
+                return true;
+            }
+
+            if (!subtags.IsPrivateUse())
+            {
+                return false;
+            }
+        }
+
+        subtags.Advance();
+        if (!subtags.Skip([](const Subtag& s) { return s.IsAlphanum(1, 8); }))
+        {
+            return false;
+        }
+        while (subtags.Skip([](const Subtag& s) { return s.IsAlphanum(1, 8); }))
+        {
+        }
+        return subtags.AtEnd();
+    }
+}
+
 namespace AdaptiveSharedNamespace
 {
     std::string ParseUtil::JsonToString(const Json::Value& json)
@@ -35,13 +275,19 @@ namespace AdaptiveSharedNamespace
     std::string ParseUtil::GetTypeAsString(const Json::Value& json)
     {
         std::string typeKey = "type";
-        if (!json.isMember(typeKey))
+        if (!json.isObject() || !json.isMember(typeKey))
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
                                              "The JSON element is missing the following value: " + typeKey);
         }
 
-        return json.get(typeKey, Json::Value()).asString();
+        const auto& typeValue = FindMember(json, typeKey);
+        if (!typeValue.isConvertibleTo(Json::stringValue))
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "The JSON element's type is not a string");
+        }
+
+        return typeValue.asString();
     }
 
     std::string ParseUtil::TryGetTypeAsString(const Json::Value& json)
@@ -56,10 +302,23 @@ namespace AdaptiveSharedNamespace
         }
     }
 
+    bool ParseUtil::TakesImpliedType(const Json::Value& item)
+    {
+        if (!item.isObject())
+        {
+            return item.isNull();
+        }
+
+        const auto& typeValue = FindMember(item, AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type));
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        return !typeValue.isString() || !typeValue.getString(&begin, &end) || begin == end;
+    }
+
     std::string ParseUtil::TryGetString(const Json::Value& json, AdaptiveCardSchemaKey key)
     {
         std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
+        const auto& propertyValue = FindMember(json, propertyName);
         if (propertyValue.empty() || !propertyValue.isString())
         {
             return "";
@@ -72,28 +331,8 @@ namespace AdaptiveSharedNamespace
 
     std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            if (isRequired)
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
-            }
-            else
-            {
-                return "";
-            }
-        }
-
-        if (!propertyValue.isString())
-        {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type string.");
-        }
-
-        return propertyValue.asString();
+        // a null value's string is empty
+        return ValidateString(json, key, isRequired).asString();
     }
 
     std::string ParseUtil::GetString(const Json::Value& json, AdaptiveCardSchemaKey key, const std::string& defaultValue, bool isRequired)
@@ -111,7 +350,7 @@ namespace AdaptiveSharedNamespace
     std::string ParseUtil::GetJsonString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
         std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
+        const auto& propertyValue = FindMember(json, propertyName);
         if (propertyValue.empty())
         {
             if (isRequired)
@@ -130,22 +369,7 @@ namespace AdaptiveSharedNamespace
 
     std::string ParseUtil::GetValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            if (isRequired)
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
-            }
-            else
-            {
-                return "";
-            }
-        }
-
-        return propertyValue.asString();
+        return ValidateValueAsString(json, key, isRequired).asString();
     }
 
     std::shared_ptr<BackgroundImage> ParseUtil::GetBackgroundImage(const Json::Value& json)
@@ -156,101 +380,40 @@ namespace AdaptiveSharedNamespace
             std::string backgroundImageUrl = ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundImage, false);
             if (backgroundImageUrl != "")
             {
-                return std::make_shared<BackgroundImage>(backgroundImageUrl);
+                return std::make_shared<BackgroundImage>(std::move(backgroundImageUrl));
             }
 
             // handle "backgroundImageUrl": <string>
             backgroundImageUrl = ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundImageUrl, false);
             if (backgroundImageUrl != "")
             {
-                return std::make_shared<BackgroundImage>(backgroundImageUrl);
+                return std::make_shared<BackgroundImage>(std::move(backgroundImageUrl));
             }
             return nullptr;
         }
         catch (AdaptiveCardParseException)
         {
             // handle "backgroundImage": { <content> }
-            auto jsonValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::BackgroundImage, false);
-            return BackgroundImage::Deserialize(jsonValue);
+            return BackgroundImage::Deserialize(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::BackgroundImage, false));
         }
     }
 
     bool ParseUtil::GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool defaultValue, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            if (isRequired)
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
-            }
-            else
-            {
-                return defaultValue;
-            }
-        }
-
-        if (!propertyValue.isBool())
-        {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type bool.");
-        }
-
-        return propertyValue.asBool();
+        const auto& propertyValue = GetMemberOfType(json, key, isRequired, IsBool, InvalidBoolMessage);
+        return propertyValue.isNull() ? defaultValue : propertyValue.asBool();
     }
 
     unsigned int ParseUtil::GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            if (isRequired)
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
-            }
-            else
-            {
-                return defaultValue;
-            }
-        }
-
-        if (!propertyValue.isUInt())
-        {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type uInt.");
-        }
-
-        return propertyValue.asUInt();
+        const auto& propertyValue = GetMemberOfType(json, key, isRequired, IsUInt, InvalidUIntMessage);
+        return propertyValue.isNull() ? defaultValue : propertyValue.asUInt();
     }
 
     int ParseUtil::GetInt(const Json::Value& json, AdaptiveCardSchemaKey key, int defaultValue, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (propertyValue.empty())
-        {
-            if (isRequired)
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                 "Property is required but was found empty: " + propertyName);
-            }
-            else
-            {
-                return defaultValue;
-            }
-        }
-
-        if (!propertyValue.isInt())
-        {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                             "Value for property " + propertyName + " was invalid. Expected type int.");
-        }
-
-        return propertyValue.asInt();
+        const auto& propertyValue = GetMemberOfType(json, key, isRequired, IsInt, InvalidIntMessage);
+        return propertyValue.isNull() ? defaultValue : propertyValue.asInt();
     }
 
     void ParseUtil::ExpectTypeString(const Json::Value& json, const std::string& expectedTypeStr)
@@ -280,13 +443,13 @@ namespace AdaptiveSharedNamespace
             throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "null expectedKey");
         }
 
-        if (!json.isMember(expectedKey))
+        if (!json.isObject() || !json.isMember(expectedKey))
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
                                              "The JSON element is missing the following key: " + std::string(expectedKey));
         }
 
-        auto value = json.get(expectedKey, Json::Value());
+        const auto& value = json[expectedKey];
         throwIfWrongType(value);
     }
 
@@ -321,10 +484,10 @@ namespace AdaptiveSharedNamespace
         }
     }
 
-    Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    const Json::Value& ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto elementArray = json.get(propertyName, Json::Value());
+        const std::string& propertyName = GetKeyName(key);
+        const auto& elementArray = FindMember(json, propertyName);
 
         if (!elementArray.isNull() && !elementArray.isArray())
         {
@@ -343,24 +506,29 @@ namespace AdaptiveSharedNamespace
 
     Json::Value ParseUtil::GetJsonValueFromString(const std::string& jsonString)
     {
-        std::istringstream jsonStream(jsonString);
+        // Parse the string in place rather than through a stream, which would copy it into the stream's buffer
+        const Json::CharReaderBuilder builder;
+        const std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
         Json::Value jsonValue;
-
         try
         {
-            jsonStream >> jsonValue;
+            if (!reader->parse(jsonString.data(), jsonString.data() + jsonString.size(), &jsonValue, nullptr))
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object");
+            }
         }
-        catch (const Json::RuntimeError&)
+        catch (const Json::Exception& e)
         {
-            throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, "Expected JSON Object");
+            // such as json nested deeper than the reader's stack limit
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidJson, e.what());
         }
         return jsonValue;
     }
 
-    Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    const Json::Value& ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
+        const std::string& propertyName = GetKeyName(key);
+        const auto& propertyValue = FindMember(json, propertyName);
         if (isRequired && propertyValue.empty())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
@@ -373,12 +541,16 @@ namespace AdaptiveSharedNamespace
     {
         std::string new_value;
         new_value.resize(value.size());
-        std::transform(value.begin(), value.end(), new_value.begin(), [](char c) {
-            return std::tolower(c, std::locale());
-        });
+        std::transform(value.begin(), value.end(), new_value.begin(), ToAsciiLowercase);
         return new_value;
     }
 
+    bool ParseUtil::IsValidLanguageTag(const std::string& value)
+    {
+        // Validates in place, without allocating or sharing state between threads
+        return !value.empty() && (IsWellFormedLanguageTag(value) || IsIrregularGrandfatheredTag(value));
+    }
+
     std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContext& context, const Json::Value& json)
     {
         if (json.empty() || !json.isObject())
@@ -410,7 +582,7 @@ namespace AdaptiveSharedNamespace
                                                                                    AdaptiveCardSchemaKey key,
                                                                                    bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArray(json, key, isRequired);
 
         std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -435,7 +607,7 @@ namespace AdaptiveSharedNamespace
 
     std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+        const auto& selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
 
         if (!selectAction.empty())
         {
@@ -444,4 +616,116 @@ namespace AdaptiveSharedNamespace
 
         return nullptr;
     }
+
+    const Json::Value& ParseUtil::ValidateString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        return GetMemberOfType(json, key, isRequired, IsString, InvalidStringMessage);
+    }
+
+    const Json::Value& ParseUtil::ValidateValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        return GetMemberOfType(json, key, isRequired, IsConvertibleToString, InvalidValueAsStringMessage);
+    }
+
+    void ParseUtil::ValidateBackgroundImage(const Json::Value& json)
+    {
+        try
+        {
+            // handle "backgroundImage": <string>, then "backgroundImageUrl": <string>
+            if (!IsNonEmptyString(ValidateString(json, AdaptiveCardSchemaKey::BackgroundImage)))
+            {
+                ValidateString(json, AdaptiveCardSchemaKey::BackgroundImageUrl);
+            }
+        }
+        catch (const AdaptiveCardParseException&)
+        {
+            // handle "backgroundImage": { <content> }
+            BackgroundImage::Validate(ExtractJsonValue(json, AdaptiveCardSchemaKey::BackgroundImage, false));
+        }
+    }
+
+    void ParseUtil::ValidateBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        GetMemberOfType(json, key, isRequired, IsBool, InvalidBoolMessage);
+    }
+
+    void ParseUtil::ValidateUInt(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        GetMemberOfType(json, key, isRequired, IsUInt, InvalidUIntMessage);
+    }
+
+    void ParseUtil::ValidateInt(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        GetMemberOfType(json, key, isRequired, IsInt, InvalidIntMessage);
+    }
+
+    const Json::Value& ParseUtil::ValidateEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        const std::string& propertyName = GetKeyName(key);
+        const auto& propertyValue = FindMember(json, propertyName);
+        if (propertyValue.empty())
+        {
+            if (isRequired)
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
+                                                 "Property is required but was found empty: " + propertyName);
+            }
+            return Json::Value::nullSingleton();
+        }
+
+        if (!propertyValue.isString())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
+        }
+
+        return propertyValue;
+    }
+
+    void ParseUtil::ValidateElementCollectionOfSingleType(ParseContext& context,
+                                                          const Json::Value& json,
+                                                          AdaptiveCardSchemaKey key,
+                                                          const std::function<void(ParseContext& context, const Json::Value&)>& validator,
+                                                          bool isRequired)
+    {
+        for (const auto& curJsonValue : GetArray(json, key, isRequired))
+        {
+            validator(context, curJsonValue);
+        }
+    }
+
+    bool ParseUtil::ValidateActionFromJsonValue(ParseContext& context, const Json::Value& json)
+    {
+        if (json.empty() || !json.isObject())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Expected a Json object to extract Action element");
+        }
+
+        const std::string typeString = GetTypeAsString(json);
+
+        auto parser = context.actionParserRegistration->FindParser(typeString);
+        if (parser == nullptr)
+        {
+            parser = context.actionParserRegistration->FindParser("UnknownAction");
+        }
+
+        // The parser is wrapped on the stack rather than by GetParser, which allocates the wrapper
+        return parser != nullptr && ActionElementParserWrapper(std::move(parser)).Validate(context, json);
+    }
+
+    void ParseUtil::ValidateActionCollection(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        for (const auto& curJsonValue : GetArray(json, key, isRequired))
+        {
+            ValidateActionFromJsonValue(context, curJsonValue);
+        }
+    }
+
+    void ParseUtil::ValidateAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        const auto& selectAction = ExtractJsonValue(json, key, isRequired);
+        if (!selectAction.empty())
+        {
+            ValidateActionFromJsonValue(context, selectAction);
+        }
+    }
 }
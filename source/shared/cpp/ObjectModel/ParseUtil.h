@@ -22,6 +22,11 @@ namespace AdaptiveSharedNamespace
 
         std::string TryGetTypeAsString(const Json::Value& json);
 
+        // Whether an item of a collection whose items have an implied type (such as the columns of a ColumnSet) gets
+        // that type: an object whose type is missing or isn't a non-empty string, or null, which is parsed as an
+        // object with only the implied type
+        bool TakesImpliedType(const Json::Value& item);
+
         std::string GetString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         std::string GetString(const Json::Value& json, AdaptiveCardSchemaKey key, const std::string& defaultValue, bool isRequired = false);
@@ -49,11 +54,13 @@ namespace AdaptiveSharedNamespace
 
         ActionType TryGetActionType(const Json::Value& json);
 
-        Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+        // Returns a reference into json, or to a null value if the key isn't present
+        const Json::Value& GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         Json::Value GetJsonValueFromString(const std::string& jsonString);
 
-        Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+        // Returns a reference into jsonRoot, or to a null value if the key isn't present
+        const Json::Value& ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         template<typename T>
         T GetEnumValue(const Json::Value& json,
@@ -100,7 +107,49 @@ namespace AdaptiveSharedNamespace
         // throws if the key is missing or the value mapped to the key is the wrong type
         void ExpectKeyAndValueType(const Json::Value& json, const char* expectedKey, std::function<void(const Json::Value&)> throwIfWrongType);
 
+        // Validation counterparts of the getters above, for parsers that check json without building elements. Each
+        // throws what its getter throws for the same json, and the string and enum ones return the member (null if
+        // it's absent) rather than a copy of its value.
+        const Json::Value& ValidateString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        const Json::Value& ValidateValueAsString(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        void ValidateBackgroundImage(const Json::Value& json);
+
+        void ValidateBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        void ValidateUInt(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        void ValidateInt(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        const Json::Value& ValidateEnumValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        template<typename T>
+        void ValidateElementCollection(ParseContext& context,
+                                       const Json::Value& json,
+                                       AdaptiveCardSchemaKey key,
+                                       bool isRequired = false,
+                                       const std::string& impliedType = std::string());
+
+        void ValidateElementCollectionOfSingleType(ParseContext& context,
+                                                   const Json::Value& json,
+                                                   AdaptiveCardSchemaKey key,
+                                                   const std::function<void(ParseContext& context, const Json::Value&)>& validator,
+                                                   bool isRequired = false);
+
+        void ValidateActionCollection(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        void ValidateAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+
+        // Returns whether GetActionFromJsonValue would return an action
+        bool ValidateActionFromJsonValue(ParseContext& context, const Json::Value& json);
+
+        // Lowercases ASCII letters only; other bytes (including UTF-8 sequences) are copied unchanged
         std::string ToLowercase(const std::string& value);
+
+        // Checks that the value is a well-formed BCP-47 language tag (RFC 5646 section 2.1). This is purely syntactic,
+        // so the result doesn't depend on the locales installed on the machine.
+        bool IsValidLanguageTag(const std::string& value);
     };
 
     template<typename T>
@@ -113,24 +162,10 @@ namespace AdaptiveSharedNamespace
         std::string propertyValueStr = "";
         try
         {
-            const std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-            auto const& propertyValue = json.get(propertyName, Json::Value());
-            if (propertyValue.empty())
+            const auto& propertyValue = ValidateEnumValue(json, key, isRequired);
+            if (propertyValue.isNull())
             {
-                if (isRequired)
-                {
-                    throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
-                                                     "Property is required but was found empty: " + propertyName);
-                }
-                else
-                {
-                    return defaultEnumValue;
-                }
-            }
-
-            if (!propertyValue.isString())
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Enum type was invalid. Expected type string.");
+                return defaultEnumValue;
             }
 
             propertyValueStr = propertyValue.asString();
@@ -152,7 +187,7 @@ namespace AdaptiveSharedNamespace
         const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
         bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArray(json, key, isRequired);
 
         std::vector<std::shared_ptr<T>> elements;
         if (elementArray.empty())
@@ -182,7 +217,7 @@ namespace AdaptiveSharedNamespace
                                                      const T& defaultValue,
                                                      const std::function<T(const Json::Value&, const T&)>& deserializer)
     {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+        const auto& jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
         T result = jsonObject.empty() ? defaultValue : deserializer(jsonObject, defaultValue);
         return result;
     }
@@ -207,12 +242,12 @@ namespace AdaptiveSharedNamespace
                                                                     bool isRequired,
                                                                     const std::string& impliedType)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArray(json, key, isRequired);
 
         std::vector<std::shared_ptr<T>> elements;
         if (elementArray.empty())
         {
-            return std::move(elements);
+            return elements;
         }
 
         const size_t elemSize = elementArray.size();
@@ -221,7 +256,7 @@ namespace AdaptiveSharedNamespace
         const ContainerBleedDirection previousBleedState = context.GetBleedDirection();
 
         size_t currentIndex = 0;
-        for (auto& curJsonValue : elementArray)
+        for (const auto& curJsonValue : elementArray)
         {
             ContainerBleedDirection currentBleedState = previousBleedState;
 
@@ -244,9 +279,12 @@ namespace AdaptiveSharedNamespace
 
             context.PushBleedDirection(currentBleedState);
 
+            std::shared_ptr<BaseElement> curElement;
+
             // If all items in this collection have the same implied type (i.e. Columns), verify
-            // that if set it is set correctly and set it if it isn't
-            if (!impliedType.empty())
+            // that if set it is set correctly and set it if it isn't. Only items without a type string are copied.
+            const bool takesImpliedType = !impliedType.empty() && TakesImpliedType(curJsonValue);
+            if (!impliedType.empty() && !takesImpliedType)
             {
                 const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
                 if (typeString.compare(impliedType) != 0)
@@ -254,13 +292,19 @@ namespace AdaptiveSharedNamespace
                     throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
                                                      "Unable to parse element of type " + typeString);
                 }
-
-                curJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = typeString;
             }
 
-            std::shared_ptr<BaseElement> curElement;
-            ParseJsonObject<T>(context, curJsonValue, curElement);
-            elements.push_back(std::static_pointer_cast<T>(curElement));
+            if (takesImpliedType)
+            {
+                Json::Value typedJsonValue = curJsonValue;
+                typedJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = impliedType;
+                ParseJsonObject<T>(context, typedJsonValue, curElement);
+            }
+            else
+            {
+                ParseJsonObject<T>(context, curJsonValue, curElement);
+            }
+            elements.push_back(std::static_pointer_cast<T>(std::move(curElement)));
 
             // restores the parent's bleed state
             context.PopBleedDirection();
@@ -268,6 +312,46 @@ namespace AdaptiveSharedNamespace
             currentIndex++;
         }
 
-        return std::move(elements);
+        return elements;
+    }
+
+    template<typename T>
+    void ParseUtil::ValidateElementCollection(ParseContext& context,
+                                              const Json::Value& json,
+                                              AdaptiveCardSchemaKey key,
+                                              bool isRequired,
+                                              const std::string& impliedType)
+    {
+        for (const auto& curJsonValue : GetArray(json, key, isRequired))
+        {
+            const bool takesImpliedType = !impliedType.empty() && TakesImpliedType(curJsonValue);
+            if (!impliedType.empty() && !takesImpliedType)
+            {
+                const std::string typeString = ParseUtil::GetString(curJsonValue, AdaptiveCardSchemaKey::Type, impliedType, false);
+                if (typeString.compare(impliedType) != 0)
+                {
+                    throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                                     "Unable to parse element of type " + typeString);
+                }
+            }
+
+            // An item without a type is validated as one of the implied type, rather than copied to add the type. A null
+            // item, or one whose type isn't a non-empty string, is copied with the implied type, as building it does.
+            if (takesImpliedType && curJsonValue.isObject() &&
+                !curJsonValue.isMember(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)))
+            {
+                T::ValidateJsonObject(context, curJsonValue, impliedType);
+            }
+            else if (takesImpliedType)
+            {
+                Json::Value typedJsonValue = curJsonValue;
+                typedJsonValue[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = impliedType;
+                T::ValidateJsonObject(context, typedJsonValue);
+            }
+            else
+            {
+                T::ValidateJsonObject(context, curJsonValue);
+            }
+        }
     }
 }
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "ParseWarningSink.h"
+#include "AdaptiveCardParseWarning.h"
+
+using namespace AdaptiveSharedNamespace;
+
+ParseWarningSink::ParseWarningSink() :
+    m_pendingWarnings{}, m_countsByStatusCode{}, m_maxWarnings(DefaultMaxWarnings), m_keptCount(0), m_totalCount(0),
+    m_droppedCount(0)
+{
+}
+
+void ParseWarningSink::AddWarning(WarningStatusCode statusCode, const char* message, const std::string& payload)
+{
+    ++m_totalCount;
+    ++m_countsByStatusCode[statusCode];
+
+    // The number of pending warnings is bounded by the cap, so a linear search stays cheap
+    for (auto& pending : m_pendingWarnings)
+    {
+        if (pending.statusCode == statusCode && pending.message == message && pending.payload == payload)
+        {
+            ++pending.count;
+            return;
+        }
+    }
+
+    if (m_keptCount >= m_maxWarnings)
+    {
+        ++m_droppedCount;
+        return;
+    }
+
+    ++m_keptCount;
+    m_pendingWarnings.push_back({statusCode, message, payload, 1});
+}
+
+void ParseWarningSink::Flush(std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+{
+    warnings.reserve(warnings.size() + m_pendingWarnings.size() + (m_droppedCount != 0 ? 1 : 0));
+    for (const auto& pending : m_pendingWarnings)
+    {
+        std::string reason = pending.message;
+        reason += pending.payload;
+        if (pending.count > 1)
+        {
+            reason += " (" + std::to_string(pending.count) + " occurrences)";
+        }
+
+        warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(pending.statusCode, reason));
+    }
+
+    if (m_droppedCount != 0)
+    {
+        warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(
+            WarningStatusCode::CustomWarning, std::to_string(m_droppedCount) + " more warnings dropped"));
+    }
+
+    Clear();
+}
+
+void ParseWarningSink::Clear() noexcept
+{
+    m_pendingWarnings.clear();
+    m_countsByStatusCode.clear();
+    m_keptCount = 0;
+    m_totalCount = 0;
+    m_droppedCount = 0;
+}
+
+unsigned int ParseWarningSink::GetWarningCount(WarningStatusCode statusCode) const
+{
+    const auto count = m_countsByStatusCode.find(statusCode);
+    return (count != m_countsByStatusCode.end()) ? count->second : 0;
+}
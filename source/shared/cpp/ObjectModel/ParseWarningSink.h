@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCardParseWarning;
+
+    // Collects the warnings raised while a card is parsed without allocating a warning object per occurrence. A warning
+    // is recorded as its status code, a message with static storage duration and an optional payload (typically the
+    // offending value), and is only formatted into an AdaptiveCardParseWarning when the sink is flushed.
+    //
+    // Repeats of a warning (same status code, message and payload) are aggregated into a single warning that carries
+    // the number of occurrences. At most GetMaxWarnings() distinct warnings are kept between flushes; further ones are
+    // only counted, and reported by a single CustomWarning when the sink is flushed.
+    class ParseWarningSink
+    {
+    public:
+        static constexpr unsigned int DefaultMaxWarnings = 100;
+
+        ParseWarningSink();
+
+        void AddWarning(WarningStatusCode statusCode, const char* message, const std::string& payload = "");
+
+        // Formats the pending warnings, appending them to warnings in the order they were first raised, and starts the
+        // counts and the cap over
+        void Flush(std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
+        bool HasPendingWarnings() const { return !m_pendingWarnings.empty(); }
+        // Drops the pending warnings and starts the counts and the cap over
+        void Clear() noexcept;
+
+        unsigned int GetMaxWarnings() const { return m_maxWarnings; }
+        void SetMaxWarnings(unsigned int value) { m_maxWarnings = value; }
+
+        // Counts since the last flush, including aggregated and dropped occurrences
+        unsigned int GetWarningCount(WarningStatusCode statusCode) const;
+        unsigned int GetTotalWarningCount() const { return m_totalCount; }
+        unsigned int GetDroppedWarningCount() const { return m_droppedCount; }
+
+    private:
+        struct PendingWarning
+        {
+            WarningStatusCode statusCode;
+            const char* message;
+            std::string payload;
+            unsigned int count;
+        };
+
+        std::vector<PendingWarning> m_pendingWarnings;
+        std::unordered_map<WarningStatusCode, unsigned int, EnumHash> m_countsByStatusCode;
+        unsigned int m_maxWarnings;
+        unsigned int m_keptCount;
+        unsigned int m_totalCount;
+        unsigned int m_droppedCount;
+    };
+}
@@ -0,0 +1,325 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "PrefetchPlan.h"
+#include "ActionSet.h"
+#include "BackgroundImage.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FactSet.h"
+#include "HostConfig.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    // Walks a card in render order, estimating the vertical offset of each element so resources can be classified
+    // relative to the fold. Every Add* method returns the estimated height of what it visited.
+    class PrefetchPlanBuilder
+    {
+    public:
+        PrefetchPlanBuilder(const HostConfig& hostConfig, unsigned int foldHeight, std::vector<PrefetchResource>& plan) :
+            m_hostConfig(hostConfig), m_imageSizes(hostConfig.GetImageSizes()), m_spacing(hostConfig.GetSpacing()),
+            m_actionsConfig(hostConfig.GetActions()), m_foldHeight(foldHeight), m_plan(plan),
+            m_lineHeight(hostConfig.GetFontSize(FontType::Default, TextSize::Default))
+        {
+        }
+
+        unsigned int AddCard(const AdaptiveCard& card, unsigned int offset, PrefetchPriority priority)
+        {
+            const auto backgroundImage = card.GetBackgroundImage();
+            if (backgroundImage != nullptr)
+            {
+                AddResource(backgroundImage->GetUrl(), "image", PriorityAt(offset, priority), 0, 0, card.GetInternalId());
+            }
+
+            unsigned int height = AddElements(card.GetBody(), offset, priority);
+
+            const auto& actions = card.GetActions();
+            if (!actions.empty() && m_hostConfig.GetSupportsInteractivity())
+            {
+                const unsigned int spacing = height ? SpacingToPixels(m_actionsConfig.spacing) : 0;
+                height += spacing + AddActions(actions, offset + height + spacing, priority);
+            }
+
+            return height;
+        }
+
+    private:
+        unsigned int AddElements(const std::vector<std::shared_ptr<BaseCardElement>>& elements, unsigned int offset, PrefetchPriority priority)
+        {
+            unsigned int height = 0;
+            for (const auto& element : elements)
+            {
+                if (!element->GetIsVisible())
+                {
+                    // Hidden content takes no room until it's toggled, so it doesn't push its siblings down
+                    AddElement(*element, offset + height, PrefetchPriority::Hidden);
+                    continue;
+                }
+
+                if (height)
+                {
+                    height += SpacingToPixels(element->GetSpacing());
+                    if (element->GetSeparator())
+                    {
+                        height += m_hostConfig.GetSeparator().lineThickness;
+                    }
+                }
+                height += AddElement(*element, offset + height, priority);
+            }
+            return height;
+        }
+
+        unsigned int AddElement(BaseCardElement& element, unsigned int offset, PrefetchPriority priority)
+        {
+            switch (element.GetElementType())
+            {
+            case CardElementType::Image:
+                return AddImage(static_cast<Image&>(element), offset, priority);
+            case CardElementType::ImageSet:
+                return AddImageSet(static_cast<ImageSet&>(element), offset, priority);
+            case CardElementType::Media:
+                return AddMedia(static_cast<Media&>(element), offset, priority);
+            case CardElementType::Container:
+            {
+                auto& container = static_cast<Container&>(element);
+                AddBackgroundImage(container, offset, priority);
+                return AddElements(container.GetItems(), offset, priority);
+            }
+            case CardElementType::ColumnSet:
+            {
+                // Columns are laid out side by side, so each starts at the column set's offset
+                unsigned int height = 0;
+                for (const auto& column : static_cast<ColumnSet&>(element).GetColumns())
+                {
+                    const PrefetchPriority columnPriority = column->GetIsVisible() ? priority : PrefetchPriority::Hidden;
+                    AddBackgroundImage(*column, offset, columnPriority);
+                    const unsigned int columnHeight = AddElements(column->GetItems(), offset, columnPriority);
+                    if (columnPriority != PrefetchPriority::Hidden)
+                    {
+                        height = std::max(height, columnHeight);
+                    }
+                }
+                return height;
+            }
+            case CardElementType::ActionSet:
+                return m_hostConfig.GetSupportsInteractivity() ?
+                           AddActions(static_cast<ActionSet&>(element).GetActions(), offset, priority) :
+                           0;
+            case CardElementType::FactSet:
+                return m_lineHeight * static_cast<unsigned int>(static_cast<FactSet&>(element).GetFacts().size());
+            case CardElementType::TextBlock:
+            {
+                const auto& textBlock = static_cast<TextBlock&>(element);
+                return m_hostConfig.GetFontSize(textBlock.GetFontType(), textBlock.GetTextSize());
+            }
+            case CardElementType::Custom:
+            case CardElementType::Unknown:
+                return 0;
+            default:
+                return m_lineHeight;
+            }
+        }
+
+        unsigned int AddImage(const Image& image, unsigned int offset, PrefetchPriority priority)
+        {
+            unsigned int width = image.GetPixelWidth();
+            unsigned int height = image.GetPixelHeight();
+
+            if (!width && !height)
+            {
+                const ImageSize size = (image.GetImageSize() != ImageSize::None) ? image.GetImageSize() : m_hostConfig.GetImage().imageSize;
+                width = height = ImageSizeToPixels(size);
+            }
+
+            AddResource(image.GetUrl(), "image", PriorityAt(offset, priority), width, height, image.GetInternalId());
+
+            // Unconstrained images are assumed to be square, and as large as the largest configured size
+            if (height)
+            {
+                return height;
+            }
+            return width ? width : m_imageSizes.largeSize;
+        }
+
+        unsigned int AddImageSet(const ImageSet& imageSet, unsigned int offset, PrefetchPriority priority)
+        {
+            const auto imageSetConfig = m_hostConfig.GetImageSet();
+            const ImageSize size = (imageSet.GetImageSize() != ImageSize::None) ? imageSet.GetImageSize() : imageSetConfig.imageSize;
+            const unsigned int width = ImageSizeToPixels(size);
+            const unsigned int height = width ? std::min(width, imageSetConfig.maxImageHeight) : imageSetConfig.maxImageHeight;
+
+            // The set's size overrides the size of each image. The row count depends on the available width, which
+            // isn't known here, so only the first row is accounted for.
+            const PrefetchPriority setPriority = PriorityAt(offset, priority);
+            for (const auto& image : imageSet.GetImages())
+            {
+                AddResource(image->GetUrl(),
+                            "image",
+                            image->GetIsVisible() ? setPriority : PrefetchPriority::Hidden,
+                            width,
+                            height,
+                            image->GetInternalId());
+            }
+
+            return imageSet.GetImages().empty() ? 0 : height;
+        }
+
+        unsigned int AddMedia(Media& media, unsigned int offset, PrefetchPriority priority)
+        {
+            AddResource(media.GetPoster(), "image", PriorityAt(offset, priority), 0, 0, media.GetInternalId());
+
+            // Sources are only fetched once the user starts playback
+            const PrefetchPriority sourcePriority = std::max(priority, PrefetchPriority::OnDemand);
+            for (const auto& source : media.GetSources())
+            {
+                AddResource(source->GetUrl(), source->GetMimeType(), sourcePriority, 0, 0, media.GetInternalId());
+            }
+
+            return m_imageSizes.largeSize;
+        }
+
+        unsigned int AddActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, unsigned int offset, PrefetchPriority priority)
+        {
+            const bool isHorizontal = (m_actionsConfig.actionsOrientation == ActionsOrientation::Horizontal);
+            const size_t actionCount = std::min<size_t>(actions.size(), m_actionsConfig.maxActions);
+
+            unsigned int height = 0;
+            for (size_t i = 0; i < actionCount; ++i)
+            {
+                const auto& action = actions[i];
+                const unsigned int actionOffset = isHorizontal ? offset : offset + height;
+
+                const std::string iconUrl = action->GetIconUrl();
+                if (!iconUrl.empty())
+                {
+                    AddResource(iconUrl,
+                                "image",
+                                PriorityAt(actionOffset, priority),
+                                m_actionsConfig.iconSize,
+                                m_actionsConfig.iconSize,
+                                action->GetInternalId());
+                }
+
+                if (!isHorizontal || i == 0)
+                {
+                    height += (i ? m_actionsConfig.buttonSpacing : 0) + m_lineHeight;
+                }
+            }
+
+            // Show cards start out collapsed, so their content is only needed once the action is invoked
+            for (size_t i = 0; i < actionCount; ++i)
+            {
+                if (actions[i]->GetElementType() == ActionType::ShowCard)
+                {
+                    const auto card = std::static_pointer_cast<ShowCardAction>(actions[i])->GetCard();
+                    if (card != nullptr)
+                    {
+                        AddCard(*card,
+                                offset + height + m_actionsConfig.showCard.inlineTopMargin,
+                                std::max(priority, PrefetchPriority::OnDemand));
+                    }
+                }
+            }
+
+            return height;
+        }
+
+        void AddBackgroundImage(const CollectionTypeElement& collection, unsigned int offset, PrefetchPriority priority)
+        {
+            const auto backgroundImage = collection.GetBackgroundImage();
+            if (backgroundImage != nullptr)
+            {
+                AddResource(backgroundImage->GetUrl(), "image", PriorityAt(offset, priority), 0, 0, collection.GetInternalId());
+            }
+        }
+
+        void AddResource(const std::string& url,
+                         const std::string& mimeType,
+                         PrefetchPriority priority,
+                         unsigned int targetWidth,
+                         unsigned int targetHeight,
+                         InternalId owner)
+        {
+            if (url.empty())
+            {
+                return;
+            }
+
+            m_plan.push_back({url, mimeType, priority, targetWidth, targetHeight, owner});
+        }
+
+        PrefetchPriority PriorityAt(unsigned int offset, PrefetchPriority priority) const
+        {
+            if (priority != PrefetchPriority::AboveTheFold)
+            {
+                return priority;
+            }
+            return (offset < m_foldHeight) ? PrefetchPriority::AboveTheFold : PrefetchPriority::BelowTheFold;
+        }
+
+        unsigned int ImageSizeToPixels(ImageSize size) const
+        {
+            switch (size)
+            {
+            case ImageSize::Small:
+                return m_imageSizes.smallSize;
+            case ImageSize::Medium:
+                return m_imageSizes.mediumSize;
+            case ImageSize::Large:
+                return m_imageSizes.largeSize;
+            default:
+                return 0;
+            }
+        }
+
+        unsigned int SpacingToPixels(Spacing spacing) const
+        {
+            switch (spacing)
+            {
+            case Spacing::None:
+                return 0;
+            case Spacing::Small:
+                return m_spacing.smallSpacing;
+            case Spacing::Medium:
+                return m_spacing.mediumSpacing;
+            case Spacing::Large:
+                return m_spacing.largeSpacing;
+            case Spacing::ExtraLarge:
+                return m_spacing.extraLargeSpacing;
+            case Spacing::Padding:
+                return m_spacing.paddingSpacing;
+            default:
+                return m_spacing.defaultSpacing;
+            }
+        }
+
+        const HostConfig& m_hostConfig;
+        const ImageSizesConfig m_imageSizes;
+        const SpacingConfig m_spacing;
+        const ActionsConfig m_actionsConfig;
+        const unsigned int m_foldHeight;
+        std::vector<PrefetchResource>& m_plan;
+        const unsigned int m_lineHeight;
+    };
+}
+
+namespace AdaptiveSharedNamespace
+{
+    std::vector<PrefetchResource> BuildPrefetchPlan(const AdaptiveCard& card, const HostConfig& hostConfig, unsigned int foldHeight)
+    {
+        std::vector<PrefetchResource> plan;
+        PrefetchPlanBuilder builder(hostConfig, foldHeight, plan);
+        builder.AddCard(card, 0, PrefetchPriority::AboveTheFold);
+        return plan;
+    }
+}
@@ -0,0 +1,51 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include "BaseElement.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class HostConfig;
+
+    // Estimated vertical extent (in device independent pixels) treated as "above the fold" when the caller doesn't
+    // supply one.
+    constexpr unsigned int c_defaultPrefetchFoldHeight = 600;
+
+    enum class PrefetchPriority
+    {
+        // Rendered as soon as the card is shown, within the estimated fold
+        AboveTheFold = 0,
+        // Rendered as soon as the card is shown, but estimated to be beyond the fold
+        BelowTheFold,
+        // Only needed after user interaction (content of a collapsed Action.ShowCard, media playback sources)
+        OnDemand,
+        // Belongs to an element (or an ancestor of an element) with isVisible set to false
+        Hidden,
+    };
+
+    struct PrefetchResource
+    {
+        std::string url;
+        std::string mimeType;
+        PrefetchPriority priority;
+
+        // Bounding box the resource will be displayed in. A value of 0 means the dimension is not constrained by the
+        // card or host config (for example "auto" and "stretch" images), and the resource should be decoded at its
+        // natural size along that axis.
+        unsigned int targetWidth;
+        unsigned int targetHeight;
+
+        // Element (or card) the resource belongs to
+        InternalId owner;
+    };
+
+    // Enumerates the remote resources referenced by card in the order they will be rendered, classified by how soon
+    // the host will need them. Layout is estimated from hostConfig only (images, spacing and font sizes), so the
+    // above/below the fold split is a heuristic rather than a measurement.
+    std::vector<PrefetchResource> BuildPrefetchPlan(const AdaptiveCard& card,
+                                                    const HostConfig& hostConfig,
+                                                    unsigned int foldHeight = c_defaultPrefetchFoldHeight);
+}
@@ -15,7 +15,6 @@ using namespace AdaptiveSharedNamespace;
 
 RichTextBlock::RichTextBlock() : BaseCardElement(CardElementType::RichTextBlock), m_hAlignment(HorizontalAlignment::Left)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value RichTextBlock::SerializeToJsonValue() const
@@ -57,17 +56,32 @@ const std::vector<std::shared_ptr<Inline>>& RichTextBlock::GetInlines() const
     return m_inlines;
 }
 
-std::shared_ptr<BaseCardElement> RichTextBlockParser::Deserialize(ParseContext& context, const Json::Value& json)
+void RichTextBlock::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(RichTextBlock));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_inlines);
+}
+
+template<typename TPolicy>
+void RichTextBlockParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::RichTextBlock);
 
-    std::shared_ptr<RichTextBlock> richTextBlock = BaseCardElement::Deserialize<RichTextBlock>(context, json);
-    richTextBlock->SetHorizontalAlignment(ParseUtil::GetEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentFromString));
+    BaseCardElement::ParseProperties(policy, context, json);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::HorizontalAlignment,
+                HorizontalAlignment::Left,
+                HorizontalAlignmentFromString,
+                &RichTextBlock::SetHorizontalAlignment);
 
-    auto inlines =
-        ParseUtil::GetElementCollectionOfSingleType<Inline>(context, json, AdaptiveCardSchemaKey::Inlines, Inline::Deserialize, false);
-    richTextBlock->m_inlines = std::move(inlines);
+    policy.template Items<Inline>(context, json, AdaptiveCardSchemaKey::Inlines, &RichTextBlock::m_inlines, false);
+}
+
+std::shared_ptr<BaseCardElement> RichTextBlockParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto richTextBlock = std::make_shared<RichTextBlock>();
+    ParseProperties(BuildPolicy<RichTextBlock>(*richTextBlock), context, json);
 
     return richTextBlock;
 }
@@ -77,8 +91,9 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
     return RichTextBlockParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void RichTextBlock::PopulateKnownPropertiesSet()
+bool RichTextBlockParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Inlines)});
+    ParseProperties(ValidatePolicy<RichTextBlock>(), context, json);
+
+    return true;
 }
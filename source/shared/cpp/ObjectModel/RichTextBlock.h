@@ -23,6 +23,7 @@ namespace AdaptiveSharedNamespace
         ~RichTextBlock() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
         HorizontalAlignment GetHorizontalAlignment() const;
         void SetHorizontalAlignment(const HorizontalAlignment value);
@@ -32,7 +33,6 @@ namespace AdaptiveSharedNamespace
 
     private:
         HorizontalAlignment m_hAlignment;
-        void PopulateKnownPropertiesSet() override;
 
         std::vector<std::shared_ptr<Inline>> m_inlines;
     };
@@ -49,5 +49,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -3,8 +3,13 @@
 #include "pch.h"
 #include "ParseContext.h"
 #include "RichTextElementProperties.h"
+#include "Util.h"
 
 using namespace AdaptiveSharedNamespace;
+
+static_assert(sizeof(RichTextElementProperties) <=
+                  UnpaddedSize(sizeof(TextElementProperties) + 3 * sizeof(bool), alignof(RichTextElementProperties)),
+              "RichTextElementProperties is larger than its fields, keep them ordered by alignment");
 RichTextElementProperties::RichTextElementProperties() :
     TextElementProperties(), m_italic(false), m_strikethrough(false), m_underline(false)
 {
@@ -68,10 +73,7 @@ void RichTextElementProperties::SetUnderline(const bool value)
 
 void RichTextElementProperties::Deserialize(const ParseContext& context, const Json::Value& json)
 {
-    TextElementProperties::Deserialize(context, json);
-    SetItalic(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Italic, false));
-    SetStrikethrough(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Strikethrough, false));
-    SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
+    ParseProperties(BuildPolicy<RichTextElementProperties>(*this), context, json);
 }
 
 void RichTextElementProperties::PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties)
@@ -28,6 +28,8 @@ namespace AdaptiveSharedNamespace
 
         Json::Value SerializeToJsonValue(Json::Value& root) const override;
         void Deserialize(const ParseContext& context, const Json::Value& root) override;
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, const ParseContext& context, const Json::Value& json);
         void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties) override;
 
     private:
@@ -35,4 +37,15 @@ namespace AdaptiveSharedNamespace
         bool m_strikethrough;
         bool m_underline;
     };
+
+    template<typename TPolicy>
+    void RichTextElementProperties::ParseProperties(const TPolicy& policy,
+                                                    const ParseContext& context,
+                                                    const Json::Value& json)
+    {
+        TextElementProperties::ParseProperties(policy, context, json);
+        policy.Bool(json, AdaptiveCardSchemaKey::Italic, false, &RichTextElementProperties::SetItalic);
+        policy.Bool(json, AdaptiveCardSchemaKey::Strikethrough, false, &RichTextElementProperties::SetStrikethrough);
+        policy.Bool(json, AdaptiveCardSchemaKey::Underline, false, &RichTextElementProperties::SetUnderline);
+    }
 }
@@ -0,0 +1,253 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generated from schemas/src by AdaptiveCardsSharedModel/AdaptiveCardsSharedModelCodeGen/GenerateSchemaProperties.js,
+// do not edit.
+#include "pch.h"
+#include "SchemaProperties.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        struct SchemaProperty
+        {
+            const char* name;
+            std::size_t length;
+        };
+
+        // The properties in the order of their bits
+        constexpr SchemaProperty c_properties[] = {
+            {"$schema", 7},
+            {"actions", 7},
+            {"altText", 7},
+            {"backgroundColor", 15},
+            {"backgroundImage", 15},
+            {"bleed", 5},
+            {"body", 4},
+            {"card", 4},
+            {"choices", 7},
+            {"color", 5},
+            {"columns", 7},
+            {"data", 4},
+            {"errorMessage", 12},
+            {"facts", 5},
+            {"fallback", 8},
+            {"fallbackText", 12},
+            {"fontType", 8},
+            {"height", 6},
+            {"highlight", 9},
+            {"horizontalAlignment", 19},
+            {"iconUrl", 7},
+            {"id", 2},
+            {"ignoreInputValidation", 21},
+            {"imageSize", 9},
+            {"images", 6},
+            {"inlineAction", 12},
+            {"inlines", 7},
+            {"isMultiSelect", 13},
+            {"isMultiline", 11},
+            {"isRequired", 10},
+            {"isSubtle", 8},
+            {"isVisible", 9},
+            {"italic", 6},
+            {"items", 5},
+            {"lang", 4},
+            {"max", 3},
+            {"maxLength", 9},
+            {"maxLines", 8},
+            {"min", 3},
+            {"minHeight", 9},
+            {"placeholder", 11},
+            {"poster", 6},
+            {"requires", 8},
+            {"selectAction", 12},
+            {"separator", 9},
+            {"size", 4},
+            {"sources", 7},
+            {"spacing", 7},
+            {"speak", 5},
+            {"strikethrough", 13},
+            {"style", 5},
+            {"targetElements", 14},
+            {"text", 4},
+            {"title", 5},
+            {"type", 4},
+            {"underline", 9},
+            {"url", 3},
+            {"value", 5},
+            {"valueOff", 8},
+            {"valueOn", 7},
+            {"version", 7},
+            {"verticalContentAlignment", 24},
+            {"weight", 6},
+            {"width", 5},
+            {"wrap", 4},
+        };
+
+        // The property each hash of a name goes to, by the top bits of the hash, or c_none. The names hash with FNV-1a
+        // from a basis under which no two of the properties go to the same slot.
+        constexpr std::uint32_t c_hashBasis = 0x811C9DEAu;
+        constexpr unsigned int c_slotBits = 9;
+        constexpr std::uint8_t c_none = 255;
+        constexpr std::uint8_t c_propertiesByHash[] = {
+            255, 255, 255, 255, 8, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 34, 48, 255, 44, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 47, 255, 60, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 58, 255, 255, 255, 255, 30, 255, 255, 255, 255, 255, 255, 23, 32,
+            255, 255, 255, 255, 255, 255, 255, 53, 255, 255, 14, 4, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 63, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 13, 255, 255,
+            39, 255, 255, 55, 255, 255, 5, 255, 255, 255, 255, 255, 36, 255, 255, 255,
+            20, 255, 255, 255, 255, 255, 255, 255, 17, 255, 27, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 16, 255, 255, 59, 255, 255, 255, 255, 255, 15,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 3, 255, 255, 255, 6, 255,
+            255, 21, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 51, 255, 255,
+            255, 255, 255, 255, 255, 22, 255, 255, 255, 255, 255, 255, 255, 255, 255, 24,
+            255, 255, 255, 255, 57, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 62, 255, 255, 255, 50, 255,
+            41, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 28, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 46, 255, 255, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 61, 255, 255, 25,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 11, 255, 255, 255, 255, 38,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 26, 255, 255, 9, 255,
+            255, 49, 52, 255, 255, 255, 255, 255, 255, 54, 255, 1, 7, 255, 255, 255,
+            255, 255, 29, 35, 45, 255, 255, 255, 255, 255, 255, 255, 255, 37, 255, 255,
+            255, 43, 255, 18, 255, 255, 255, 64, 255, 255, 255, 255, 31, 40, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 2, 255, 255, 255, 255, 255, 42,
+            255, 12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+            255, 33, 255, 255, 255, 255, 255, 255, 56, 255, 255, 255, 19, 0, 255, 255,
+            255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 10,
+        };
+
+        std::uint32_t HashPropertyName(const char* name, const char* end)
+        {
+            std::uint32_t hash = c_hashBasis;
+            for (; name != end; ++name)
+            {
+                hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+            }
+            return hash;
+        }
+    }
+
+    SchemaPropertySet GetSchemaProperties(CardElementType type)
+    {
+        switch (type)
+        {
+        case CardElementType::ActionSet:
+            // actions, fallback, height, id, isVisible, requires, separator, spacing, type
+            return {0x0040940080224002ull, 0x0000000000000000ull};
+        case CardElementType::AdaptiveCard:
+            // $schema, actions, backgroundImage, body, fallbackText, lang, minHeight, selectAction, speak, style, type, version, verticalContentAlignment
+            return {0x3045088400008053ull, 0x0000000000000000ull};
+        case CardElementType::ChoiceInput:
+            // title, type, value
+            return {0x0260000000000000ull, 0x0000000000000000ull};
+        case CardElementType::ChoiceSetInput:
+            // choices, errorMessage, fallback, height, id, isMultiSelect, isRequired, isVisible, requires, separator, spacing, style, type, value, wrap
+            return {0x02449400A8225100ull, 0x0000000000000001ull};
+        case CardElementType::Column:
+            // backgroundImage, bleed, fallback, height, id, isVisible, items, minHeight, requires, selectAction, separator, spacing, style, type, verticalContentAlignment, width
+            return {0xA0449C8280224030ull, 0x0000000000000000ull};
+        case CardElementType::ColumnSet:
+            // bleed, columns, fallback, height, id, isVisible, minHeight, requires, selectAction, separator, spacing, style, type
+            return {0x00449C8080224420ull, 0x0000000000000000ull};
+        case CardElementType::Container:
+            // backgroundImage, bleed, fallback, height, id, isVisible, items, minHeight, requires, selectAction, separator, spacing, style, type, verticalContentAlignment
+            return {0x20449C8280224030ull, 0x0000000000000000ull};
+        case CardElementType::DateInput:
+            // errorMessage, fallback, height, id, isRequired, isVisible, max, min, placeholder, requires, separator, spacing, type, value
+            return {0x02409548A0225000ull, 0x0000000000000000ull};
+        case CardElementType::Fact:
+            // title, type, value
+            return {0x0260000000000000ull, 0x0000000000000000ull};
+        case CardElementType::FactSet:
+            // facts, fallback, height, id, isVisible, requires, separator, spacing, type
+            return {0x0040940080226000ull, 0x0000000000000000ull};
+        case CardElementType::Image:
+            // altText, backgroundColor, fallback, height, horizontalAlignment, id, isVisible, requires, selectAction, separator, size, spacing, style, type, url, width
+            return {0x8144BC00802A400Cull, 0x0000000000000000ull};
+        case CardElementType::ImageSet:
+            // fallback, height, id, imageSize, images, isVisible, requires, separator, spacing, type
+            return {0x0040940081A24000ull, 0x0000000000000000ull};
+        case CardElementType::Media:
+            // altText, fallback, height, id, isVisible, poster, requires, separator, sources, spacing, type
+            return {0x0040D60080224004ull, 0x0000000000000000ull};
+        case CardElementType::NumberInput:
+            // errorMessage, fallback, height, id, isRequired, isVisible, max, min, placeholder, requires, separator, spacing, type, value
+            return {0x02409548A0225000ull, 0x0000000000000000ull};
+        case CardElementType::RichTextBlock:
+            // fallback, height, horizontalAlignment, id, inlines, isVisible, requires, separator, spacing, type
+            return {0x00409400842A4000ull, 0x0000000000000000ull};
+        case CardElementType::TextBlock:
+            // color, fallback, fontType, height, horizontalAlignment, id, isSubtle, isVisible, maxLines, requires, separator, size, spacing, text, type, weight, wrap
+            return {0x4050B420C02B4200ull, 0x0000000000000001ull};
+        case CardElementType::TextInput:
+            // errorMessage, fallback, height, id, inlineAction, isMultiline, isRequired, isVisible, maxLength, placeholder, requires, separator, spacing, type, value
+            return {0x02409510B2225000ull, 0x0000000000000000ull};
+        case CardElementType::TimeInput:
+            // errorMessage, fallback, height, id, isRequired, isVisible, max, min, placeholder, requires, separator, spacing, type, value
+            return {0x02409548A0225000ull, 0x0000000000000000ull};
+        case CardElementType::ToggleInput:
+            // errorMessage, fallback, height, id, isRequired, isVisible, requires, separator, spacing, title, type, value, valueOff, valueOn, wrap
+            return {0x0E609400A0225000ull, 0x0000000000000001ull};
+        default:
+            // fallback, height, id, isVisible, requires, separator, spacing, type
+            return {0x0040940080224000ull, 0x0000000000000000ull};
+        }
+    }
+
+    SchemaPropertySet GetSchemaProperties(ActionType type)
+    {
+        switch (type)
+        {
+        case ActionType::ShowCard:
+            // card, fallback, iconUrl, id, requires, style, title, type
+            return {0x0064040000304080ull, 0x0000000000000000ull};
+        case ActionType::Submit:
+            // data, fallback, iconUrl, id, ignoreInputValidation, requires, style, title, type
+            return {0x0064040000704800ull, 0x0000000000000000ull};
+        case ActionType::OpenUrl:
+            // fallback, iconUrl, id, requires, style, title, type, url
+            return {0x0164040000304000ull, 0x0000000000000000ull};
+        case ActionType::ToggleVisibility:
+            // fallback, iconUrl, id, requires, style, targetElements, title, type
+            return {0x006C040000304000ull, 0x0000000000000000ull};
+        default:
+            // fallback, iconUrl, id, requires, style, title, type
+            return {0x0064040000304000ull, 0x0000000000000000ull};
+        }
+    }
+
+    SchemaPropertySet GetSchemaProperties(InlineElementType type)
+    {
+        switch (type)
+        {
+        case InlineElementType::TextRun:
+            // color, fontType, highlight, isSubtle, italic, selectAction, size, strikethrough, text, type, underline, weight
+            return {0x40D2280140050200ull, 0x0000000000000000ull};
+        default:
+            // type
+            return {0x0040000000000000ull, 0x0000000000000000ull};
+        }
+    }
+
+    bool IsSchemaProperty(SchemaPropertySet properties, const char* name, const char* end)
+    {
+        const auto slot = HashPropertyName(name, end) >> (32 - c_slotBits);
+        const auto property = c_propertiesByHash[slot];
+        if (property == c_none || !properties.Contains(property))
+        {
+            return false;
+        }
+
+        const auto length = static_cast<std::size_t>(end - name);
+        return c_properties[property].length == length && std::equal(name, end, c_properties[property].name);
+    }
+}
@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+// Generated from schemas/src by AdaptiveCardsSharedModel/AdaptiveCardsSharedModelCodeGen/GenerateSchemaProperties.js,
+// do not edit.
+#pragma once
+
+#include "pch.h"
+#include <cstdint>
+
+namespace AdaptiveSharedNamespace
+{
+    // A set of the properties of the schema, a bit for each
+    struct SchemaPropertySet
+    {
+        std::uint64_t words[2];
+
+        bool Contains(unsigned int property) const { return ((words[property / 64] >> (property % 64)) & 1) != 0; }
+    };
+
+    // The properties the schema describes for a type, including the ones it inherits. Custom and unknown types get the
+    // properties every element, action or inline has.
+    SchemaPropertySet GetSchemaProperties(CardElementType type);
+    SchemaPropertySet GetSchemaProperties(ActionType type);
+    SchemaPropertySet GetSchemaProperties(InlineElementType type);
+
+    // Whether the property named [name, end) is one of properties
+    bool IsSchemaProperty(SchemaPropertySet properties, const char* name, const char* end);
+}
@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "SemanticVersion.h"
 #include "AdaptiveCardParseException.h"
+#include <limits>
 
 using namespace AdaptiveSharedNamespace;
 
@@ -19,48 +20,37 @@ SemanticVersion::SemanticVersion(const std::string& version) : _major(0), _minor
     // "1."
     // "F"
 
-    bool versionValid = false;
-#pragma warning(push)
-#pragma warning(disable : 26426)
-    // disable spurious warning (Global initializer calls a non-constexpr function.) -- this isn't global
-    static const std::regex versionMatch(R"regex(^([\d]+)(?:\.([\d]+))?(?:\.([\d]+))?(?:\.([\d]+))?$)regex");
-#pragma warning(pop)
-    std::smatch subMatches;
-    if (std::regex_match(version, subMatches, versionMatch))
-    {
-        versionValid = true;
-        // subMatches[0] contains the entire string, so no need to refer to it here
+    // Equivalent to ^(\d+)(?:\.(\d+))?(?:\.(\d+))?(?:\.(\d+))?$, with each part fitting in an int
+    unsigned int* const parts[] = {&_major, &_minor, &_build, &_revision};
+    const size_t partCount = sizeof(parts) / sizeof(parts[0]);
 
-        try
+    bool versionValid = true;
+    size_t position = 0;
+    for (size_t part = 0; versionValid; ++part)
+    {
+        const size_t partStart = position;
+        long long value = 0;
+        while (position < version.length() && version[position] >= '0' && version[position] <= '9' && versionValid)
         {
-            // subMatches[1] contains the major version
-            if (subMatches[1].matched)
-            {
-                _major = std::stoi(subMatches[1]);
-            }
+            value = value * 10 + (version[position++] - '0');
+            versionValid = (value <= std::numeric_limits<int>::max());
+        }
 
-            if (subMatches[2].matched)
-            {
-                // subMatches[2] contains the minor version
-                _minor = std::stoi(subMatches[2]);
-            }
+        if (!versionValid || position == partStart)
+        {
+            versionValid = false;
+            break;
+        }
 
-            if (subMatches[3].matched)
-            {
-                // subMatches[3] contains the build version
-                _build = std::stoi(subMatches[3]);
-            }
+        *parts[part] = static_cast<unsigned int>(value);
 
-            if (subMatches[4].matched)
-            {
-                // subMatches[4] contains the revision
-                _revision = std::stoi(subMatches[4]);
-            }
-        }
-        catch (const std::out_of_range&)
+        if (position == version.length())
         {
-            versionValid = false;
+            break;
         }
+
+        // Parts are separated by a single dot, and there are at most four of them
+        versionValid = (version[position++] == '.' && part + 1 < partCount);
     }
 
     if (!versionValid)
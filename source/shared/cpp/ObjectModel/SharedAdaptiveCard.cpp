@@ -19,73 +19,73 @@ AdaptiveCard::AdaptiveCard() :
 {
 }
 
-AdaptiveCard::AdaptiveCard(std::string const& version,
-                           std::string const& fallbackText,
-                           std::string const& backgroundImageUrl,
+AdaptiveCard::AdaptiveCard(std::string version,
+                           std::string fallbackText,
+                           std::string backgroundImageUrl,
                            ContainerStyle style,
-                           std::string const& speak,
-                           std::string const& language,
+                           std::string speak,
+                           std::string language,
                            VerticalContentAlignment verticalContentAlignment,
                            HeightType height,
                            unsigned int minHeight) :
-    m_version(version),
-    m_fallbackText(fallbackText), m_speak(speak), m_style(style), m_language(language),
+    m_version(std::move(version)), m_fallbackText(std::move(fallbackText)), m_speak(std::move(speak)), m_style(style),
+    m_language(std::move(language)),
     m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight),
     m_inputNecessityIndicators(InputNecessityIndicators::None), m_internalId{InternalId::Next()}
 {
-    m_backgroundImage = std::make_shared<BackgroundImage>(backgroundImageUrl);
+    m_backgroundImage = std::make_shared<BackgroundImage>(std::move(backgroundImageUrl));
 }
 
-AdaptiveCard::AdaptiveCard(std::string const& version,
-                           std::string const& fallbackText,
-                           std::string const& backgroundImageUrl,
+AdaptiveCard::AdaptiveCard(std::string version,
+                           std::string fallbackText,
+                           std::string backgroundImageUrl,
                            ContainerStyle style,
-                           std::string const& speak,
-                           std::string const& language,
+                           std::string speak,
+                           std::string language,
                            VerticalContentAlignment verticalContentAlignment,
                            HeightType height,
                            unsigned int minHeight,
-                           std::vector<std::shared_ptr<BaseCardElement>>& body,
-                           std::vector<std::shared_ptr<BaseActionElement>>& actions) :
-    m_version(version),
-    m_fallbackText(fallbackText), m_speak(speak), m_style(style), m_language(language),
-    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight), m_body(body),
-    m_actions(actions), m_inputNecessityIndicators(InputNecessityIndicators::None), m_internalId{InternalId::Next()}
+                           std::vector<std::shared_ptr<BaseCardElement>> body,
+                           std::vector<std::shared_ptr<BaseActionElement>> actions) :
+    m_version(std::move(version)), m_fallbackText(std::move(fallbackText)), m_speak(std::move(speak)), m_style(style),
+    m_language(std::move(language)),
+    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight), m_body(std::move(body)),
+    m_actions(std::move(actions)), m_inputNecessityIndicators(InputNecessityIndicators::None), m_internalId{InternalId::Next()}
 {
-    m_backgroundImage = std::make_shared<BackgroundImage>(backgroundImageUrl);
+    m_backgroundImage = std::make_shared<BackgroundImage>(std::move(backgroundImageUrl));
 }
 
-AdaptiveCard::AdaptiveCard(std::string const& version,
-                           std::string const& fallbackText,
+AdaptiveCard::AdaptiveCard(std::string version,
+                           std::string fallbackText,
                            std::shared_ptr<BackgroundImage> backgroundImage,
                            ContainerStyle style,
-                           std::string const& speak,
-                           std::string const& language,
+                           std::string speak,
+                           std::string language,
                            VerticalContentAlignment verticalContentAlignment,
                            HeightType height,
                            unsigned int minHeight) :
-    m_version(version),
-    m_fallbackText(fallbackText), m_backgroundImage(backgroundImage), m_speak(speak), m_style(style),
-    m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight),
+    m_version(std::move(version)), m_fallbackText(std::move(fallbackText)), m_backgroundImage(std::move(backgroundImage)),
+    m_speak(std::move(speak)), m_style(style), m_language(std::move(language)),
+    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight),
     m_inputNecessityIndicators(InputNecessityIndicators::None), m_internalId{InternalId::Next()}
 {
 }
 
-AdaptiveCard::AdaptiveCard(std::string const& version,
-                           std::string const& fallbackText,
+AdaptiveCard::AdaptiveCard(std::string version,
+                           std::string fallbackText,
                            std::shared_ptr<BackgroundImage> backgroundImage,
                            ContainerStyle style,
-                           std::string const& speak,
-                           std::string const& language,
+                           std::string speak,
+                           std::string language,
                            VerticalContentAlignment verticalContentAlignment,
                            HeightType height,
                            unsigned int minHeight,
-                           std::vector<std::shared_ptr<BaseCardElement>>& body,
-                           std::vector<std::shared_ptr<BaseActionElement>>& actions) :
-    m_version(version),
-    m_fallbackText(fallbackText), m_backgroundImage(backgroundImage), m_speak(speak), m_style(style), m_language(language),
-    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight), m_body(body),
-    m_actions(actions), m_inputNecessityIndicators(InputNecessityIndicators::None), m_internalId{InternalId::Next()}
+                           std::vector<std::shared_ptr<BaseCardElement>> body,
+                           std::vector<std::shared_ptr<BaseActionElement>> actions) :
+    m_version(std::move(version)), m_fallbackText(std::move(fallbackText)), m_backgroundImage(std::move(backgroundImage)),
+    m_speak(std::move(speak)), m_style(style), m_language(std::move(language)),
+    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_minHeight(minHeight), m_body(std::move(body)),
+    m_actions(std::move(actions)), m_inputNecessityIndicators(InputNecessityIndicators::None), m_internalId{InternalId::Next()}
 {
 }
 
@@ -116,24 +116,11 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromFile(const std::string
     return AdaptiveCard::Deserialize(root, rendererVersion, context);
 }
 
-void AdaptiveCard::_ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+void AdaptiveCard::_ValidateLanguage(const std::string& language, ParseContext& context)
 {
-    try
+    if (!language.empty() && !ParseUtil::IsValidLanguageTag(language))
     {
-        if (language.empty() || language.length() == 2 || language.length() == 3)
-        {
-            auto locale = std::locale(language.c_str());
-        }
-        else
-        {
-            warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(AdaptiveSharedNamespace::WarningStatusCode::InvalidLanguage,
-                                                                          "Invalid language identifier: " + language));
-        }
-    }
-    catch (std::runtime_error)
-    {
-        warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(AdaptiveSharedNamespace::WarningStatusCode::InvalidLanguage,
-                                                                      "Invalid language identifier: " + language));
+        context.AddWarning(WarningStatusCode::InvalidLanguage, "Invalid language identifier: ", language);
     }
 }
 
@@ -158,16 +145,14 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     std::string speak = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Speak);
 
     // check if language is valid
-    _ValidateLanguage(language, context.warnings);
+    _ValidateLanguage(language, context);
 
+    // A card without a language has the language of the card it's nested in. The card and its elements share it.
     if (language.size())
     {
-        context.SetLanguage(language);
-    }
-    else
-    {
-        language = context.GetLanguage();
+        context.SetLanguage(std::move(language));
     }
+    const InternedString cardLanguage = context.GetInternedLanguage();
 
     // Perform version validation
     if (enforceVersion)
@@ -187,9 +172,8 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
                 speak = fallbackText;
             }
 
-            context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(AdaptiveSharedNamespace::WarningStatusCode::UnsupportedSchemaVersion,
-                                                                                  "Schema version not supported"));
-            return std::make_shared<ParseResult>(MakeFallbackTextCard(fallbackText, language, speak), context.warnings);
+            context.AddWarning(WarningStatusCode::UnsupportedSchemaVersion, "Schema version not supported");
+            return std::make_shared<ParseResult>(MakeFallbackTextCard(fallbackText, cardLanguage.Get(), speak), context.warnings);
         }
     }
 
@@ -208,7 +192,9 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString);
 
     unsigned int minHeight =
-        ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), &context.warnings);
+        ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), context);
+
+    ParseContext::CardScope cardScope(context);
 
     // Parse body
     auto body = ParseUtil::GetElementCollection<BaseCardElement>(true, context, json, AdaptiveCardSchemaKey::Body, false);
@@ -217,9 +203,19 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 
     EnsureShowCardVersions(actions, version);
 
-    auto result = std::make_shared<AdaptiveCard>(
-        version, fallbackText, backgroundImage, style, speak, language, verticalContentAlignment, height, minHeight, body, actions);
-    result->SetLanguage(language);
+    auto result = std::make_shared<AdaptiveCard>(std::move(version),
+                                                 std::move(fallbackText),
+                                                 std::move(backgroundImage),
+                                                 style,
+                                                 std::move(speak),
+                                                 "",
+                                                 verticalContentAlignment,
+                                                 height,
+                                                 minHeight,
+                                                 std::move(body),
+                                                 std::move(actions));
+
+    result->m_language = cardLanguage;
 
     // Parse optional selectAction
     result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
@@ -227,6 +223,8 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     result->SetInputNecessityIndicators(ParseUtil::GetEnumValue<InputNecessityIndicators>(
         json, AdaptiveCardSchemaKey::InputNecessityIndicators, InputNecessityIndicators::None, InputNecessityIndicatorsFromString));
 
+    result->m_elementIdIndex = cardScope.Pop();
+
     return std::make_shared<ParseResult>(result, context.warnings);
 }
 
@@ -249,7 +247,91 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::stri
 std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::string& jsonString, std::string rendererVersion, ParseContext& context)
 #endif // __ANDROID__
 {
-    return AdaptiveCard::Deserialize(ParseUtil::GetJsonValueFromString(jsonString), rendererVersion, context);
+    const auto json = context.Observe(ParseEventKind::JsonRead, jsonString.size(), [&]() {
+        return ParseUtil::GetJsonValueFromString(jsonString);
+    });
+    return AdaptiveCard::Deserialize(json, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::Validate(const Json::Value& json,
+                                                                             std::string rendererVersion,
+                                                                             ParseContext& context) throw(AdaptiveSharedNamespace::AdaptiveCardParseException)
+#else
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::Validate(const Json::Value& json, std::string rendererVersion, ParseContext& context)
+#endif // __ANDROID__
+{
+    ParseUtil::ThrowIfNotJsonObject(json);
+
+    const bool enforceVersion = !rendererVersion.empty();
+
+    // Verify this is an adaptive card
+    ParseUtil::ExpectTypeString(json, CardElementType::AdaptiveCard);
+
+    const std::string version = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Version, enforceVersion);
+    ParseUtil::ValidateString(json, AdaptiveCardSchemaKey::FallbackText);
+    const std::string language = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Language);
+    ParseUtil::ValidateString(json, AdaptiveCardSchemaKey::Speak);
+
+    // check if language is valid
+    _ValidateLanguage(language, context);
+
+    // Perform version validation
+    if (enforceVersion)
+    {
+        const SemanticVersion rendererMaxVersion(rendererVersion);
+        const SemanticVersion cardVersion(version);
+
+        if (rendererMaxVersion < cardVersion)
+        {
+            context.AddWarning(WarningStatusCode::UnsupportedSchemaVersion, "Schema version not supported");
+            return context.warnings;
+        }
+    }
+
+    ParseUtil::ValidateBackgroundImage(json);
+    ParseUtil::ValidateEnumValue(json, AdaptiveCardSchemaKey::Style);
+    ParseUtil::ValidateEnumValue(json, AdaptiveCardSchemaKey::VerticalContentAlignment);
+    ParseUtil::ValidateEnumValue(json, AdaptiveCardSchemaKey::Height);
+    ParseSizeForPixelSize(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MinHeight), context);
+
+    ParseContext::CardScope cardScope(context);
+
+    ParseUtil::ValidateElementCollection<BaseCardElement>(context, json, AdaptiveCardSchemaKey::Body, false);
+    ParseUtil::ValidateActionCollection(context, json, AdaptiveCardSchemaKey::Actions, false);
+    ParseUtil::ValidateAction(context, json, AdaptiveCardSchemaKey::SelectAction, false);
+    ParseUtil::ValidateEnumValue(json, AdaptiveCardSchemaKey::InputNecessityIndicators);
+
+    cardScope.Pop();
+
+    return context.warnings;
+}
+
+#ifdef __ANDROID__
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion) throw(AdaptiveSharedNamespace::AdaptiveCardParseException)
+#else
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::ValidateFromString(const std::string& jsonString, std::string rendererVersion)
+#endif // __ANDROID__
+{
+    ParseContext context;
+    return AdaptiveCard::ValidateFromString(jsonString, rendererVersion, context);
+}
+
+#ifdef __ANDROID__
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion,
+                                                                                       ParseContext& context) throw(AdaptiveSharedNamespace::AdaptiveCardParseException)
+#else
+std::vector<std::shared_ptr<AdaptiveCardParseWarning>> AdaptiveCard::ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion,
+                                                                                       ParseContext& context)
+#endif // __ANDROID__
+{
+    const auto json = context.Observe(ParseEventKind::JsonRead, jsonString.size(), [&]() {
+        return ParseUtil::GetJsonValueFromString(jsonString);
+    });
+    return AdaptiveCard::Validate(json, rendererVersion, context);
 }
 
 Json::Value AdaptiveCard::SerializeToJsonValue() const
@@ -280,7 +362,7 @@ Json::Value AdaptiveCard::SerializeToJsonValue() const
     }
     if (!m_language.empty())
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language)] = m_language;
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Language)] = m_language.Get();
     }
     if (m_style != ContainerStyle::None)
     {
@@ -353,24 +435,24 @@ std::string AdaptiveCard::Serialize() const
     return ParseUtil::JsonToString(SerializeToJsonValue());
 }
 
-std::string AdaptiveCard::GetVersion() const
+const std::string& AdaptiveCard::GetVersion() const
 {
     return m_version;
 }
 
-void AdaptiveCard::SetVersion(const std::string& value)
+void AdaptiveCard::SetVersion(std::string value)
 {
-    m_version = value;
+    m_version = std::move(value);
 }
 
-std::string AdaptiveCard::GetFallbackText() const
+const std::string& AdaptiveCard::GetFallbackText() const
 {
     return m_fallbackText;
 }
 
-void AdaptiveCard::SetFallbackText(const std::string& value)
+void AdaptiveCard::SetFallbackText(std::string value)
 {
-    m_fallbackText = value;
+    m_fallbackText = std::move(value);
 }
 
 std::shared_ptr<BackgroundImage> AdaptiveCard::GetBackgroundImage() const
@@ -383,14 +465,14 @@ void AdaptiveCard::SetBackgroundImage(const std::shared_ptr<BackgroundImage> val
     m_backgroundImage = value;
 }
 
-std::string AdaptiveCard::GetSpeak() const
+const std::string& AdaptiveCard::GetSpeak() const
 {
     return m_speak;
 }
 
-void AdaptiveCard::SetSpeak(const std::string& value)
+void AdaptiveCard::SetSpeak(std::string value)
 {
-    m_speak = value;
+    m_speak = std::move(value);
 }
 
 ContainerStyle AdaptiveCard::GetStyle() const
@@ -403,14 +485,14 @@ void AdaptiveCard::SetStyle(const ContainerStyle value)
     m_style = value;
 }
 
-std::string AdaptiveCard::GetLanguage() const
+const std::string& AdaptiveCard::GetLanguage() const
 {
-    return m_language;
+    return m_language.Get();
 }
 
-void AdaptiveCard::SetLanguage(const std::string& value)
+void AdaptiveCard::SetLanguage(std::string value)
 {
-    m_language = value;
+    m_language = InternedString(std::move(value));
 }
 
 HeightType AdaptiveCard::GetHeight() const
@@ -488,25 +570,55 @@ void AdaptiveCard::SetInputNecessityIndicators(const InputNecessityIndicators va
     m_inputNecessityIndicators = value;
 }
 
+std::shared_ptr<BaseElement> AdaptiveCard::GetElementById(const std::string& id) const
+{
+    const auto element = m_elementIdIndex.find(id);
+    return (element != m_elementIdIndex.end()) ? element->second : nullptr;
+}
+
+MemoryUsage AdaptiveCard::GetMemoryUsage() const
+{
+    MemoryUsage usage;
+    usage.AddObject(sizeof(AdaptiveCard));
+    usage.AddString(m_version);
+    usage.AddString(m_fallbackText);
+    usage.AddString(m_speak);
+    if (m_backgroundImage)
+    {
+        m_backgroundImage->AccumulateMemoryUsage(usage);
+    }
+
+    usage.AddObjects(m_body);
+    usage.AddObjects(m_actions);
+    if (m_selectAction)
+    {
+        m_selectAction->AccumulateMemoryUsage(usage);
+    }
+
+    // the index refers to elements of the card, which are already counted
+    usage.AddHashTable(m_elementIdIndex);
+    for (const auto& entry : m_elementIdIndex)
+    {
+        usage.AddString(entry.first);
+    }
+    return usage;
+}
+
 std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
 {
     auto resourceVector = std::vector<RemoteResourceInformation>();
 
-    auto backgroundImage = GetBackgroundImage();
-    if (backgroundImage != nullptr)
+    if (m_backgroundImage != nullptr)
     {
-        RemoteResourceInformation backgroundImageInfo;
-        backgroundImageInfo.url = backgroundImage->GetUrl();
-        backgroundImageInfo.mimeType = "image";
-        resourceVector.push_back(backgroundImageInfo);
+        resourceVector.push_back({m_backgroundImage->GetUrl(), "image"});
     }
 
-    for (auto item : m_body)
+    for (const auto& item : m_body)
     {
         item->GetResourceInformation(resourceVector);
     }
 
-    for (auto item : m_actions)
+    for (const auto& item : m_actions)
     {
         item->GetResourceInformation(resourceVector);
     }
@@ -17,62 +17,62 @@ namespace AdaptiveSharedNamespace
     public:
         AdaptiveCard();
 
-        AdaptiveCard(std::string const& version,
-                     std::string const& fallbackText,
-                     std::string const& backgroundImageUrl,
+        AdaptiveCard(std::string version,
+                     std::string fallbackText,
+                     std::string backgroundImageUrl,
                      ContainerStyle style,
-                     std::string const& speak,
-                     std::string const& language,
+                     std::string speak,
+                     std::string language,
                      VerticalContentAlignment verticalContentAlignment,
                      HeightType height,
                      unsigned int minHeight);
 
-        AdaptiveCard(std::string const& version,
-                     std::string const& fallbackText,
-                     std::string const& backgroundImageUrl,
+        AdaptiveCard(std::string version,
+                     std::string fallbackText,
+                     std::string backgroundImageUrl,
                      ContainerStyle style,
-                     std::string const& speak,
-                     std::string const& language,
+                     std::string speak,
+                     std::string language,
                      VerticalContentAlignment verticalContentAlignment,
                      HeightType height,
                      unsigned int minHeight,
-                     std::vector<std::shared_ptr<BaseCardElement>>& body,
-                     std::vector<std::shared_ptr<BaseActionElement>>& actions);
+                     std::vector<std::shared_ptr<BaseCardElement>> body,
+                     std::vector<std::shared_ptr<BaseActionElement>> actions);
 
-        AdaptiveCard(std::string const& version,
-                     std::string const& fallbackText,
+        AdaptiveCard(std::string version,
+                     std::string fallbackText,
                      std::shared_ptr<BackgroundImage> backgroundImage,
                      ContainerStyle style,
-                     std::string const& speak,
-                     std::string const& language,
+                     std::string speak,
+                     std::string language,
                      VerticalContentAlignment verticalContentAlignment,
                      HeightType height,
                      unsigned int minHeight);
 
-        AdaptiveCard(std::string const& version,
-                     std::string const& fallbackText,
+        AdaptiveCard(std::string version,
+                     std::string fallbackText,
                      std::shared_ptr<BackgroundImage> backgroundImage,
                      ContainerStyle style,
-                     std::string const& speak,
-                     std::string const& language,
+                     std::string speak,
+                     std::string language,
                      VerticalContentAlignment verticalContentAlignment,
                      HeightType height,
                      unsigned int minHeight,
-                     std::vector<std::shared_ptr<BaseCardElement>>& body,
-                     std::vector<std::shared_ptr<BaseActionElement>>& actions);
+                     std::vector<std::shared_ptr<BaseCardElement>> body,
+                     std::vector<std::shared_ptr<BaseActionElement>> actions);
 
-        std::string GetVersion() const;
-        void SetVersion(const std::string& value);
-        std::string GetFallbackText() const;
-        void SetFallbackText(const std::string& value);
+        const std::string& GetVersion() const;
+        void SetVersion(std::string value);
+        const std::string& GetFallbackText() const;
+        void SetFallbackText(std::string value);
         std::shared_ptr<BackgroundImage> GetBackgroundImage() const;
         void SetBackgroundImage(const std::shared_ptr<BackgroundImage> value);
-        std::string GetSpeak() const;
-        void SetSpeak(const std::string& value);
+        const std::string& GetSpeak() const;
+        void SetSpeak(std::string value);
         ContainerStyle GetStyle() const;
         void SetStyle(const ContainerStyle value);
-        std::string GetLanguage() const;
-        void SetLanguage(const std::string& value);
+        const std::string& GetLanguage() const;
+        void SetLanguage(std::string value);
         VerticalContentAlignment GetVerticalContentAlignment() const;
         void SetVerticalContentAlignment(const VerticalContentAlignment value);
         HeightType GetHeight() const;
@@ -92,6 +92,13 @@ namespace AdaptiveSharedNamespace
 
         std::vector<RemoteResourceInformation> GetResourceInformation();
 
+        // Looks up an element (including elements of nested Action.ShowCard cards) by its id. The index is built while
+        // the card is parsed, so it doesn't reflect elements added or removed afterwards.
+        std::shared_ptr<BaseElement> GetElementById(const std::string& id) const;
+
+        // Bytes the card takes, by category. It walks the card without allocating.
+        MemoryUsage GetMemoryUsage() const;
+
         const CardElementType GetElementType() const;
 #ifdef __ANDROID__
         static std::shared_ptr<ParseResult> DeserializeFromFile(const std::string& jsonFile,
@@ -109,6 +116,15 @@ namespace AdaptiveSharedNamespace
                                                                   ParseContext& context) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
         static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString,
                                                                   std::string rendererVersion) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
+
+        static std::vector<std::shared_ptr<AdaptiveCardParseWarning>> Validate(const Json::Value& json,
+                                                                             std::string rendererVersion,
+                                                                             ParseContext& context) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
+        static std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion,
+                                                                                       ParseContext& context) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
+        static std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
         static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(const std::string& fallbackText,
                                                                   const std::string& language,
                                                                   const std::string& speak) throw(AdaptiveSharedNamespace::AdaptiveCardParseException);
@@ -127,6 +143,17 @@ namespace AdaptiveSharedNamespace
         static std::shared_ptr<ParseResult> DeserializeFromString(const std::string& jsonString,
                                                                   std::string rendererVersion);
 
+        // Checks the card the way Deserialize does, throwing the same exceptions and returning the same warnings,
+        // without building the card, its elements or their markdown.
+        static std::vector<std::shared_ptr<AdaptiveCardParseWarning>> Validate(const Json::Value& json,
+                                                                             std::string rendererVersion,
+                                                                             ParseContext& context);
+        static std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion,
+                                                                                       ParseContext& context);
+        static std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ValidateFromString(const std::string& jsonString,
+                                                                                       std::string rendererVersion);
+
         static std::shared_ptr<AdaptiveCard> MakeFallbackTextCard(const std::string& fallbackText,
                                                                   const std::string& language,
                                                                   const std::string& speak);
@@ -138,14 +165,16 @@ namespace AdaptiveSharedNamespace
         const InternalId GetInternalId() const { return m_internalId; }
 
     private:
-        static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
+        friend class HostCardResolver;
+
+        static void _ValidateLanguage(const std::string& language, ParseContext& context);
 
         std::string m_version;
         std::string m_fallbackText;
         std::shared_ptr<BackgroundImage> m_backgroundImage;
         std::string m_speak;
         ContainerStyle m_style;
-        std::string m_language;
+        InternedString m_language;
         VerticalContentAlignment m_verticalContentAlignment;
         HeightType m_height;
         unsigned int m_minHeight;
@@ -157,5 +186,7 @@ namespace AdaptiveSharedNamespace
         std::vector<std::shared_ptr<BaseActionElement>> m_actions;
 
         std::shared_ptr<BaseActionElement> m_selectAction;
+
+        std::unordered_map<std::string, std::shared_ptr<BaseElement>> m_elementIdIndex;
     };
 }
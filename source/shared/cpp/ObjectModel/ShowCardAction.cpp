@@ -10,7 +10,6 @@ using namespace AdaptiveSharedNamespace;
 
 ShowCardAction::ShowCardAction() : BaseActionElement(ActionType::ShowCard)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value ShowCardAction::SerializeToJsonValue() const
@@ -32,27 +31,46 @@ void ShowCardAction::SetCard(const std::shared_ptr<AdaptiveCard> card)
     m_card = card;
 }
 
-void ShowCardAction::SetLanguage(const std::string& value)
+void ShowCardAction::SetLanguage(std::string value)
 {
     // If the card inside doesn't specify language, propagate
     if (m_card->GetLanguage().empty())
     {
-        m_card->SetLanguage(value);
+        m_card->SetLanguage(std::move(value));
     }
 }
 
-std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+void ShowCardAction::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    std::shared_ptr<ShowCardAction> showCardAction = BaseActionElement::Deserialize<ShowCardAction>(context, json);
-
-    std::string propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
+    usage.AddObject(sizeof(ShowCardAction));
+    BaseActionElement::AccumulateMemoryUsage(usage);
+    if (m_card)
+    {
+        usage.showCards += m_card->GetMemoryUsage().GetTotal();
+    }
+}
 
-    auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
+template<typename TPolicy>
+void ShowCardActionParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    BaseActionElement::ParseProperties(policy, context, json);
 
-    auto showCardWarnings = parseResult->GetWarnings();
-    auto warningsEnd = context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
+    // The nested card reports its warnings through the same context, so they're already attributed to the outer card
+    const auto& card = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Card);
+    if (ShowCardAction* showCardAction = policy.Object())
+    {
+        showCardAction->SetCard(AdaptiveCard::Deserialize(card, "", context)->GetAdaptiveCard());
+    }
+    else
+    {
+        AdaptiveCard::Validate(card, "", context);
+    }
+}
 
-    showCardAction->SetCard(parseResult->GetAdaptiveCard());
+std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto showCardAction = std::make_shared<ShowCardAction>();
+    ParseProperties(BuildPolicy<ShowCardAction>(*showCardAction), context, json);
 
     return showCardAction;
 }
@@ -63,15 +81,17 @@ ShowCardActionParser::DeserializeFromString(ParseContext& context, const std::st
     return ShowCardActionParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ShowCardAction::PopulateKnownPropertiesSet()
+bool ShowCardActionParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
+    ParseProperties(ValidatePolicy<ShowCardAction>(), context, json);
+
+    return true;
 }
 
 void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto card = GetCard();
-    auto showCardResources = card->GetResourceInformation();
-    auto resourceInfoEnd = resourceInfo.insert(resourceInfo.end(), showCardResources.begin(), showCardResources.end());
-    return;
+    auto showCardResources = m_card->GetResourceInformation();
+    resourceInfo.insert(resourceInfo.end(),
+                        std::make_move_iterator(showCardResources.begin()),
+                        std::make_move_iterator(showCardResources.end()));
 }
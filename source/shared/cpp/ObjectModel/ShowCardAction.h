@@ -24,13 +24,12 @@ namespace AdaptiveSharedNamespace
         std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCard> GetCard() const;
         void SetCard(const std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCard>);
 
-        void SetLanguage(const std::string& value);
+        void SetLanguage(std::string value);
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::shared_ptr<AdaptiveCard> m_card;
     };
 
@@ -46,5 +45,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) override;
         std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
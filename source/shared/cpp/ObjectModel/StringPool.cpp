@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "StringPool.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    constexpr size_t c_minimumTrimThreshold = 1024;
+}
+
+InternedString::InternedString(std::string value) :
+    m_value(value.empty() ? nullptr : std::make_shared<const std::string>(std::move(value)))
+{
+}
+
+StringPool::StringPool(bool enabled) :
+    m_enabled(enabled), m_trimThreshold(c_minimumTrimThreshold), m_hits(0), m_misses(0)
+{
+}
+
+StringPool& StringPool::GetDefault()
+{
+    static StringPool defaultPool(false);
+    return defaultPool;
+}
+
+bool StringPool::IsEnabled() const
+{
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+void StringPool::SetEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+InternedString StringPool::Intern(std::string value)
+{
+    // a disabled pool costs a single load
+    if (value.empty() || !IsEnabled())
+    {
+        return InternedString(std::move(value));
+    }
+
+    const size_t hash = std::hash<std::string>()(value);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto range = m_strings.equal_range(hash);
+    for (auto entry = range.first; entry != range.second; ++entry)
+    {
+        if (*entry->second == value)
+        {
+            ++m_hits;
+            return InternedString(entry->second);
+        }
+    }
+
+    ++m_misses;
+    if (m_strings.size() >= m_trimThreshold)
+    {
+        TrimUnlocked();
+    }
+    auto pooled = std::make_shared<const std::string>(std::move(value));
+    m_strings.emplace(hash, pooled);
+    return InternedString(std::move(pooled));
+}
+
+void StringPool::Trim()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TrimUnlocked();
+}
+
+// a string only the pool refers to can only be handed out again under the lock, so it can be dropped safely
+void StringPool::TrimUnlocked()
+{
+    for (auto entry = m_strings.begin(); entry != m_strings.end();)
+    {
+        entry = (entry->second.use_count() == 1) ? m_strings.erase(entry) : std::next(entry);
+    }
+
+    // trimming again once the pool has doubled keeps the cost of trimming constant per string
+    m_trimThreshold = std::max(c_minimumTrimThreshold, 2 * m_strings.size());
+}
+
+void StringPool::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_strings.clear();
+    m_trimThreshold = c_minimumTrimThreshold;
+}
+
+StringPoolStatistics StringPool::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t bytes = 0;
+    for (const auto& entry : m_strings)
+    {
+        bytes += entry.second->size();
+    }
+    return {m_hits, m_misses, m_strings.size(), bytes};
+}
+
+void StringPool::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_hits = 0;
+    m_misses = 0;
+}
@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <atomic>
+#include <mutex>
+
+namespace AdaptiveSharedNamespace
+{
+    // Immutable string whose storage may be shared. Strings made by a StringPool share storage with every other
+    // string of the same value the pool made; strings made from a std::string own theirs. An empty string has no
+    // storage at all.
+    class InternedString
+    {
+    public:
+        InternedString() = default;
+        explicit InternedString(std::string value);
+
+        const std::string& Get() const
+        {
+            static const std::string empty;
+            return m_value ? *m_value : empty;
+        }
+
+        bool empty() const { return !m_value; }
+        bool SharesStorageWith(const InternedString& other) const { return m_value == other.m_value; }
+
+    private:
+        friend class StringPool;
+        explicit InternedString(std::shared_ptr<const std::string> value) : m_value(std::move(value)) {}
+
+        std::shared_ptr<const std::string> m_value;
+    };
+
+    struct StringPoolStatistics
+    {
+        unsigned long long hits;
+        unsigned long long misses;
+        size_t entries;
+        // Length of the pooled strings
+        size_t bytes;
+    };
+
+    // Pool of the strings that repeat across the elements of a card and across the cards of a conversation, such as
+    // type names, languages, colors, icon urls and styles. Elements keep InternedStrings of them, so that equal
+    // strings share a single copy.
+    //
+    // Pooled strings are immutable and reference counted, so they outlive the pool and may be used on any thread.
+    // The pool drops the strings no element refers to anymore as it grows. A disabled pool doesn't share anything:
+    // each string it makes owns its storage.
+    class StringPool
+    {
+    public:
+        explicit StringPool(bool enabled);
+        StringPool(const StringPool&) = delete;
+        StringPool& operator=(const StringPool&) = delete;
+
+        // The process-wide pool parse contexts use unless they're given one. It's disabled until the host enables it.
+        static StringPool& GetDefault();
+
+        bool IsEnabled() const;
+        void SetEnabled(bool enabled);
+
+        InternedString Intern(std::string value);
+
+        // Drops the strings nothing but the pool refers to
+        void Trim();
+        void Clear();
+
+        StringPoolStatistics GetStatistics() const;
+        void ResetStatistics();
+
+    private:
+        void TrimUnlocked();
+
+        std::atomic<bool> m_enabled;
+        mutable std::mutex m_mutex;
+        std::unordered_multimap<size_t, std::shared_ptr<const std::string>> m_strings;
+        // size at which Intern trims the pool next
+        size_t m_trimThreshold;
+        unsigned long long m_hits;
+        unsigned long long m_misses;
+    };
+}
@@ -8,7 +8,6 @@ using namespace AdaptiveSharedNamespace;
 
 SubmitAction::SubmitAction() : BaseActionElement(ActionType::Submit), m_ignoreInputValidation(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::string SubmitAction::GetDataJson() const
@@ -26,9 +25,9 @@ void SubmitAction::SetDataJson(const std::string value)
     SetDataJson(ParseUtil::GetJsonValueFromString(value));
 }
 
-void SubmitAction::SetDataJson(const Json::Value& value)
+void SubmitAction::SetDataJson(Json::Value value)
 {
-    m_dataJson = value;
+    m_dataJson = std::move(value);
 }
 
 bool SubmitAction::GetIgnoreInputValidation() const
@@ -58,12 +57,27 @@ Json::Value SubmitAction::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<BaseActionElement> SubmitActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+void SubmitAction::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    std::shared_ptr<SubmitAction> submitAction = BaseActionElement::Deserialize<SubmitAction>(context, json);
+    usage.AddObject(sizeof(SubmitAction));
+    BaseActionElement::AccumulateMemoryUsage(usage);
+    usage.AddJson(m_dataJson);
+}
 
-    submitAction->SetDataJson(ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
-    submitAction->SetIgnoreInputValidation(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IgnoreInputValidation, false));
+template<typename TPolicy>
+void SubmitActionParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
+{
+    BaseActionElement::ParseProperties(policy, context, json);
+
+    policy.Set([](SubmitAction& submitAction, const Json::Value& data) { submitAction.SetDataJson(data); },
+               ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Data));
+    policy.Bool(json, AdaptiveCardSchemaKey::IgnoreInputValidation, false, &SubmitAction::SetIgnoreInputValidation);
+}
+
+std::shared_ptr<BaseActionElement> SubmitActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto submitAction = std::make_shared<SubmitAction>();
+    ParseProperties(BuildPolicy<SubmitAction>(*submitAction), context, json);
 
     return submitAction;
 }
@@ -73,8 +87,9 @@ std::shared_ptr<BaseActionElement> SubmitActionParser::DeserializeFromString(Par
     return SubmitActionParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void SubmitAction::PopulateKnownPropertiesSet()
+bool SubmitActionParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IgnoreInputValidation)});
+    ParseProperties(ValidatePolicy<SubmitAction>(), context, json);
+
+    return true;
 }
@@ -20,17 +20,16 @@ namespace AdaptiveSharedNamespace
 
         std::string GetDataJson() const;
         Json::Value GetDataJsonAsValue() const;
-        void SetDataJson(const Json::Value& value);
+        void SetDataJson(Json::Value value);
         void SetDataJson(const std::string value);
 
         virtual bool GetIgnoreInputValidation() const;
         virtual void SetIgnoreInputValidation(const bool value);
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         Json::Value m_dataJson;
         bool m_ignoreInputValidation;
     };
@@ -47,5 +46,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) override;
         std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -13,11 +13,14 @@
 
 using namespace AdaptiveSharedNamespace;
 
+static_assert(sizeof(TextBlock) <= UnpaddedSize(sizeof(BaseCardElement) + sizeof(TextElementProperties) + sizeof(unsigned int) +
+                                                    sizeof(HorizontalAlignment) + sizeof(bool),
+                                                alignof(TextBlock)),
+              "TextBlock is larger than its fields, keep them ordered by alignment");
+
 TextBlock::TextBlock() :
-    BaseCardElement(CardElementType::TextBlock), m_wrap(false), m_maxLines(0), m_hAlignment(HorizontalAlignment::Left),
-    m_textElementProperties(std::make_shared<TextElementProperties>())
+    BaseCardElement(CardElementType::TextBlock), m_maxLines(0), m_hAlignment(HorizontalAlignment::Left), m_wrap(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TextBlock::SerializeToJsonValue() const
@@ -25,7 +28,7 @@ Json::Value TextBlock::SerializeToJsonValue() const
     Json::Value root = BaseCardElement::SerializeToJsonValue();
 
     // ignore return -- properties are added directly to root
-    (void)m_textElementProperties->SerializeToJsonValue(root);
+    (void)m_textElementProperties.SerializeToJsonValue(root);
 
     if (m_hAlignment != HorizontalAlignment::Left)
     {
@@ -45,59 +48,59 @@ Json::Value TextBlock::SerializeToJsonValue() const
     return root;
 }
 
-std::string TextBlock::GetText() const
+const std::string& TextBlock::GetText() const
 {
-    return m_textElementProperties->GetText();
+    return m_textElementProperties.GetText();
 }
 
-void TextBlock::SetText(const std::string& value)
+void TextBlock::SetText(std::string value)
 {
-    m_textElementProperties->SetText(value);
+    m_textElementProperties.SetText(std::move(value));
 }
 
-DateTimePreparser TextBlock::GetTextForDateParsing() const
+const DateTimePreparser& TextBlock::GetTextForDateParsing() const
 {
-    return m_textElementProperties->GetTextForDateParsing();
+    return m_textElementProperties.GetTextForDateParsing();
 }
 
 TextSize TextBlock::GetTextSize() const
 {
-    return m_textElementProperties->GetTextSize();
+    return m_textElementProperties.GetTextSize();
 }
 
 void TextBlock::SetTextSize(const TextSize value)
 {
-    m_textElementProperties->SetTextSize(value);
+    m_textElementProperties.SetTextSize(value);
 }
 
 TextWeight TextBlock::GetTextWeight() const
 {
-    return m_textElementProperties->GetTextWeight();
+    return m_textElementProperties.GetTextWeight();
 }
 
 void TextBlock::SetTextWeight(const TextWeight value)
 {
-    m_textElementProperties->SetTextWeight(value);
+    m_textElementProperties.SetTextWeight(value);
 }
 
 FontType TextBlock::GetFontType() const
 {
-    return m_textElementProperties->GetFontType();
+    return m_textElementProperties.GetFontType();
 }
 
 void TextBlock::SetFontType(const FontType value)
 {
-    m_textElementProperties->SetFontType(value);
+    m_textElementProperties.SetFontType(value);
 }
 
 ForegroundColor TextBlock::GetTextColor() const
 {
-    return m_textElementProperties->GetTextColor();
+    return m_textElementProperties.GetTextColor();
 }
 
 void TextBlock::SetTextColor(const ForegroundColor value)
 {
-    m_textElementProperties->SetTextColor(value);
+    m_textElementProperties.SetTextColor(value);
 }
 
 bool TextBlock::GetWrap() const
@@ -112,12 +115,12 @@ void TextBlock::SetWrap(const bool value)
 
 bool TextBlock::GetIsSubtle() const
 {
-    return m_textElementProperties->GetIsSubtle();
+    return m_textElementProperties.GetIsSubtle();
 }
 
 void TextBlock::SetIsSubtle(const bool value)
 {
-    m_textElementProperties->SetIsSubtle(value);
+    m_textElementProperties.SetIsSubtle(value);
 }
 
 unsigned int TextBlock::GetMaxLines() const
@@ -140,27 +143,44 @@ void TextBlock::SetHorizontalAlignment(const HorizontalAlignment value)
     m_hAlignment = value;
 }
 
-std::string TextBlock::GetLanguage() const
+const std::string& TextBlock::GetLanguage() const
 {
-    return m_textElementProperties->GetLanguage();
+    return m_textElementProperties.GetLanguage();
 }
 
-void TextBlock::SetLanguage(const std::string& value)
+void TextBlock::SetLanguage(std::string value)
 {
-    m_textElementProperties->SetLanguage(value);
+    m_textElementProperties.SetLanguage(std::move(value));
 }
 
-std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& context, const Json::Value& json)
+void TextBlock::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(TextBlock));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+    m_textElementProperties.AccumulateMemoryUsage(usage);
+}
+
+template<typename TPolicy>
+void TextBlockParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::TextBlock);
 
-    std::shared_ptr<TextBlock> textBlock = BaseCardElement::Deserialize<TextBlock>(context, json);
-    textBlock->m_textElementProperties->Deserialize(context, json);
+    BaseCardElement::ParseProperties(policy, context, json);
+    TextElementProperties::ParseProperties(policy.Part(&TextBlock::m_textElementProperties), context, json);
 
-    textBlock->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false));
-    textBlock->SetMaxLines(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLines, 0));
-    textBlock->SetHorizontalAlignment(ParseUtil::GetEnumValue<HorizontalAlignment>(
-        json, AdaptiveCardSchemaKey::HorizontalAlignment, HorizontalAlignment::Left, HorizontalAlignmentFromString));
+    policy.Bool(json, AdaptiveCardSchemaKey::Wrap, false, &TextBlock::SetWrap);
+    policy.UInt(json, AdaptiveCardSchemaKey::MaxLines, 0, &TextBlock::SetMaxLines);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::HorizontalAlignment,
+                HorizontalAlignment::Left,
+                HorizontalAlignmentFromString,
+                &TextBlock::SetHorizontalAlignment);
+}
+
+std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    std::shared_ptr<TextBlock> textBlock = std::make_shared<TextBlock>();
+    ParseProperties(BuildPolicy<TextBlock>(*textBlock), context, json);
 
     return textBlock;
 }
@@ -170,11 +190,9 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
     return TextBlockParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void TextBlock::PopulateKnownPropertiesSet()
+bool TextBlockParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    ParseProperties(ValidatePolicy<TextBlock>(), context, json);
 
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
+    return true;
 }
@@ -24,10 +24,11 @@ namespace AdaptiveSharedNamespace
         ~TextBlock() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
-        std::string GetText() const;
-        void SetText(const std::string& value);
-        DateTimePreparser GetTextForDateParsing() const;
+        const std::string& GetText() const;
+        void SetText(std::string value);
+        const DateTimePreparser& GetTextForDateParsing() const;
 
         TextSize GetTextSize() const;
         void SetTextSize(const TextSize value);
@@ -53,15 +54,15 @@ namespace AdaptiveSharedNamespace
         HorizontalAlignment GetHorizontalAlignment() const;
         void SetHorizontalAlignment(const HorizontalAlignment value);
 
-        void SetLanguage(const std::string& value);
-        std::string GetLanguage() const;
+        void SetLanguage(std::string value);
+        const std::string& GetLanguage() const;
 
     private:
-        bool m_wrap;
+        // Text properties are held by value, so that a text block is a single allocation
+        TextElementProperties m_textElementProperties;
         unsigned int m_maxLines;
         HorizontalAlignment m_hAlignment;
-        std::shared_ptr<TextElementProperties> m_textElementProperties;
-        void PopulateKnownPropertiesSet() override;
+        bool m_wrap;
     };
 
     class TextBlockParser : public BaseCardElementParser
@@ -76,5 +77,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -8,19 +8,28 @@
 #include "ParseContext.h"
 #include "TextElementProperties.h"
 #include "DateTimePreparser.h"
+#include "TextProcessingCache.h"
 #include "ParseUtil.h"
+#include "Util.h"
 
 using namespace AdaptiveSharedNamespace;
 
+static_assert(sizeof(TextElementProperties) <=
+                  UnpaddedSize(sizeof(void*) + sizeof(std::string) + sizeof(InternedString) +
+                                   sizeof(std::shared_ptr<const DateTimePreparser>) + sizeof(TextSize) + sizeof(TextWeight) +
+                                   sizeof(FontType) + sizeof(ForegroundColor) + sizeof(bool),
+                               alignof(TextElementProperties)),
+              "TextElementProperties is larger than its fields, keep them ordered by alignment");
+
 TextElementProperties::TextElementProperties() :
     m_textSize(TextSize::Default), m_textWeight(TextWeight::Default), m_fontType(FontType::Default),
-    m_textColor(ForegroundColor::Default), m_isSubtle(false), m_language()
+    m_textColor(ForegroundColor::Default), m_isSubtle(false)
 {
 }
 
 TextElementProperties::TextElementProperties(const TextConfig& config, const std::string& text, const std::string& language) :
-    m_textSize(config.size), m_textWeight(config.weight), m_fontType(config.fontType), m_textColor(config.color),
-    m_isSubtle(config.isSubtle), m_text(text), m_language(language)
+    m_text(text), m_language(language), m_textSize(config.size), m_textWeight(config.weight),
+    m_fontType(config.fontType), m_textColor(config.color), m_isSubtle(config.isSubtle)
 {
 }
 
@@ -56,19 +65,20 @@ Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
     return root;
 }
 
-std::string TextElementProperties::GetText() const
+const std::string& TextElementProperties::GetText() const
 {
     return m_text;
 }
 
-void TextElementProperties::SetText(const std::string& value)
+void TextElementProperties::SetText(std::string value)
 {
-    m_text = value;
+    m_text = std::move(value);
+    m_textForDateParsing.reset();
 }
 
-DateTimePreparser TextElementProperties::GetTextForDateParsing() const
+const DateTimePreparser& TextElementProperties::GetTextForDateParsing() const
 {
-    return DateTimePreparser(m_text);
+    return TextProcessingCache::GetDateTimePreparser(m_textForDateParsing, m_text);
 }
 
 TextSize TextElementProperties::GetTextSize() const
@@ -121,25 +131,19 @@ void TextElementProperties::SetIsSubtle(const bool value)
     m_isSubtle = value;
 }
 
-std::string TextElementProperties::GetLanguage() const
+const std::string& TextElementProperties::GetLanguage() const
 {
-    return m_language;
+    return m_language.Get();
 }
 
-void TextElementProperties::SetLanguage(const std::string& value)
+void TextElementProperties::SetLanguage(std::string value)
 {
-    m_language = value;
+    m_language = InternedString(std::move(value));
 }
 
 void TextElementProperties::Deserialize(const ParseContext& context, const Json::Value& json)
 {
-    SetText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Text, true));
-    SetTextSize(ParseUtil::GetEnumValue<TextSize>(json, AdaptiveCardSchemaKey::Size, TextSize::Default, TextSizeFromString));
-    SetTextColor(ParseUtil::GetEnumValue<ForegroundColor>(json, AdaptiveCardSchemaKey::Color, ForegroundColor::Default, ForegroundColorFromString));
-    SetTextWeight(ParseUtil::GetEnumValue<TextWeight>(json, AdaptiveCardSchemaKey::TextWeight, TextWeight::Default, TextWeightFromString));
-    SetFontType(ParseUtil::GetEnumValue<FontType>(json, AdaptiveCardSchemaKey::FontType, FontType::Default, FontTypeFromString));
-    SetIsSubtle(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsSubtle, false));
-    SetLanguage(context.GetLanguage());
+    ParseProperties(BuildPolicy<TextElementProperties>(*this), context, json);
 }
 
 void TextElementProperties::PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties)
@@ -151,3 +155,8 @@ void TextElementProperties::PopulateKnownPropertiesSet(std::unordered_set<std::s
                             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FontType),
                             AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsSubtle)});
 }
+
+void TextElementProperties::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddString(m_text);
+}
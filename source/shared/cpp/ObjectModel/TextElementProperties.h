@@ -22,10 +22,14 @@ namespace AdaptiveSharedNamespace
         ~TextElementProperties() = default;
 
         virtual Json::Value SerializeToJsonValue(Json::Value& root) const;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
-        std::string GetText() const;
-        void SetText(const std::string& value);
-        DateTimePreparser GetTextForDateParsing() const;
+        const std::string& GetText() const;
+        void SetText(std::string value);
+        // The preparsed text is cached until the text changes, and shared through the default TextProcessingCache when
+        // it's enabled. It may be read on several threads at once. The reference is valid until the text changes, which
+        // must not happen while another thread reads it.
+        const DateTimePreparser& GetTextForDateParsing() const;
 
         TextSize GetTextSize() const;
         void SetTextSize(const TextSize value);
@@ -42,19 +46,58 @@ namespace AdaptiveSharedNamespace
         bool GetIsSubtle() const;
         void SetIsSubtle(const bool value);
 
-        void SetLanguage(const std::string& value);
-        std::string GetLanguage() const;
+        void SetLanguage(std::string value);
+        const std::string& GetLanguage() const;
 
         virtual void Deserialize(const ParseContext& context, const Json::Value& root);
+        // Walks the text properties with a ParsePolicy, for the parsers of the elements that have them
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, const ParseContext& context, const Json::Value& json);
         virtual void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties);
 
     private:
         std::string m_text;
+        InternedString m_language;
+        mutable std::shared_ptr<const DateTimePreparser> m_textForDateParsing;
         TextSize m_textSize;
         TextWeight m_textWeight;
         FontType m_fontType;
         ForegroundColor m_textColor;
         bool m_isSubtle;
-        std::string m_language;
     };
+
+    template<typename TPolicy>
+    void TextElementProperties::ParseProperties(const TPolicy& policy,
+                                                const ParseContext& context,
+                                                const Json::Value& json)
+    {
+        policy.String(json, AdaptiveCardSchemaKey::Text, &TextElementProperties::SetText, true);
+        policy.Enum(json,
+                    AdaptiveCardSchemaKey::Size,
+                    TextSize::Default,
+                    TextSizeFromString,
+                    &TextElementProperties::SetTextSize);
+        policy.Enum(json,
+                    AdaptiveCardSchemaKey::Color,
+                    ForegroundColor::Default,
+                    ForegroundColorFromString,
+                    &TextElementProperties::SetTextColor);
+        policy.Enum(json,
+                    AdaptiveCardSchemaKey::TextWeight,
+                    TextWeight::Default,
+                    TextWeightFromString,
+                    &TextElementProperties::SetTextWeight);
+        policy.Enum(json,
+                    AdaptiveCardSchemaKey::FontType,
+                    FontType::Default,
+                    FontTypeFromString,
+                    &TextElementProperties::SetFontType);
+        policy.Bool(json, AdaptiveCardSchemaKey::IsSubtle, false, &TextElementProperties::SetIsSubtle);
+
+        if (TextElementProperties* properties = policy.Object())
+        {
+            properties->m_language = context.GetInternedLanguage();
+            properties->m_textForDateParsing.reset();
+        }
+    }
 }
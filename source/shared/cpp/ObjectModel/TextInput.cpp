@@ -10,7 +10,6 @@ using namespace AdaptiveSharedNamespace;
 TextInput::TextInput() :
     BaseInputElement(CardElementType::TextInput), m_isMultiline(false), m_maxLength(0), m_style(TextInputStyle::Text)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TextInput::SerializeToJsonValue() const
@@ -56,24 +55,24 @@ Json::Value TextInput::SerializeToJsonValue() const
     return root;
 }
 
-std::string TextInput::GetPlaceholder() const
+const std::string& TextInput::GetPlaceholder() const
 {
     return m_placeholder;
 }
 
-void TextInput::SetPlaceholder(const std::string& value)
+void TextInput::SetPlaceholder(std::string value)
 {
-    m_placeholder = value;
+    m_placeholder = std::move(value);
 }
 
-std::string TextInput::GetValue() const
+const std::string& TextInput::GetValue() const
 {
     return m_value;
 }
 
-void TextInput::SetValue(const std::string& value)
+void TextInput::SetValue(std::string value)
 {
-    m_value = value;
+    m_value = std::move(value);
 }
 
 bool TextInput::GetIsMultiline() const
@@ -116,29 +115,52 @@ void TextInput::SetInlineAction(const std::shared_ptr<BaseActionElement> action)
     m_inlineAction = action;
 }
 
-std::string TextInput::GetRegex() const
+const std::string& TextInput::GetRegex() const
 {
     return m_regex;
 }
 
-void TextInput::SetRegex(const std::string& value)
+void TextInput::SetRegex(std::string value)
 {
-    m_regex = value;
+    m_regex = std::move(value);
 }
 
-std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+void TextInput::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(TextInput));
+    BaseInputElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_placeholder);
+    usage.AddString(m_value);
+    usage.AddString(m_regex);
+    if (m_inlineAction)
+    {
+        m_inlineAction->AccumulateMemoryUsage(usage);
+    }
+}
+
+template<typename TPolicy>
+void TextInputParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::TextInput);
 
-    std::shared_ptr<TextInput> textInput = BaseInputElement::Deserialize<TextInput>(context, json);
-    textInput->SetPlaceholder(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Placeholder));
-    textInput->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value));
-    textInput->SetIsMultiline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::IsMultiline, false));
-    textInput->SetMaxLength(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLength, 0));
-    textInput->SetTextInputStyle(
-        ParseUtil::GetEnumValue<TextInputStyle>(json, AdaptiveCardSchemaKey::Style, TextInputStyle::Text, TextInputStyleFromString));
-    textInput->SetInlineAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::InlineAction, false));
-    textInput->SetRegex(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Regex));
+    BaseInputElement::ParseProperties(policy, context, json);
+    policy.String(json, AdaptiveCardSchemaKey::Placeholder, &TextInput::SetPlaceholder);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &TextInput::SetValue);
+    policy.Bool(json, AdaptiveCardSchemaKey::IsMultiline, false, &TextInput::SetIsMultiline);
+    policy.UInt(json, AdaptiveCardSchemaKey::MaxLength, 0, &TextInput::SetMaxLength);
+    policy.Enum(json,
+                AdaptiveCardSchemaKey::Style,
+                TextInputStyle::Text,
+                TextInputStyleFromString,
+                &TextInput::SetTextInputStyle);
+    policy.Action(context, json, AdaptiveCardSchemaKey::InlineAction, &TextInput::SetInlineAction);
+    policy.String(json, AdaptiveCardSchemaKey::Regex, &TextInput::SetRegex);
+}
+
+std::shared_ptr<BaseCardElement> TextInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto textInput = std::make_shared<TextInput>();
+    ParseProperties(BuildPolicy<TextInput>(*textInput), context, json);
 
     return textInput;
 }
@@ -148,11 +170,9 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
     return TextInputParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void TextInput::PopulateKnownPropertiesSet()
+bool TextInputParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
+    ParseProperties(ValidatePolicy<TextInput>(), context, json);
+
+    return true;
 }
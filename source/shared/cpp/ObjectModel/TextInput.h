@@ -19,12 +19,13 @@ namespace AdaptiveSharedNamespace
         ~TextInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
-        std::string GetPlaceholder() const;
-        void SetPlaceholder(const std::string& value);
+        const std::string& GetPlaceholder() const;
+        void SetPlaceholder(std::string value);
 
-        std::string GetValue() const;
-        void SetValue(const std::string& value);
+        const std::string& GetValue() const;
+        void SetValue(std::string value);
 
         bool GetIsMultiline() const;
         void SetIsMultiline(const bool value);
@@ -38,12 +39,10 @@ namespace AdaptiveSharedNamespace
         std::shared_ptr<BaseActionElement> GetInlineAction() const;
         void SetInlineAction(const std::shared_ptr<BaseActionElement> action);
 
-        std::string GetRegex() const;
-        void SetRegex(const std::string& value);
+        const std::string& GetRegex() const;
+        void SetRegex(std::string value);
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::string m_placeholder;
         std::string m_value;
         std::string m_regex;
@@ -65,5 +64,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
@@ -0,0 +1,256 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#include "pch.h"
+#include "TextProcessingCache.h"
+#include "MarkDownParser.h"
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    size_t HashKey(const std::string& text, const std::string& language, unsigned int flags)
+    {
+        size_t hash = std::hash<std::string>()(text);
+        hash ^= std::hash<std::string>()(language) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= std::hash<unsigned int>()(flags) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+}
+
+ProcessedMarkDown::ProcessedMarkDown(const std::string& text, unsigned int outputs) :
+    m_hasHtmlTags(false), m_isEscaped(false)
+{
+    MarkDownParser parser(text);
+    if (outputs & Html)
+    {
+        m_html = parser.TransformToHtml();
+    }
+    if (outputs & InlineRuns)
+    {
+        m_inlineRuns = parser.TransformToInlineRuns();
+    }
+    m_hasHtmlTags = parser.HasHtmlTags();
+    m_isEscaped = parser.IsEscaped();
+}
+
+const std::string& ProcessedMarkDown::GetHtml() const
+{
+    return m_html;
+}
+
+const std::vector<MarkDownInlineRun>& ProcessedMarkDown::GetInlineRuns() const
+{
+    return m_inlineRuns;
+}
+
+bool ProcessedMarkDown::HasHtmlTags() const
+{
+    return m_hasHtmlTags;
+}
+
+bool ProcessedMarkDown::IsEscaped() const
+{
+    return m_isEscaped;
+}
+
+double TextProcessingCacheStatistics::GetHitRate() const
+{
+    const unsigned long long lookups = hits + misses;
+    return lookups ? static_cast<double>(hits) / lookups : 0.0;
+}
+
+template<typename T>
+typename TextProcessingCache::Shard<T>::EntryIterator
+TextProcessingCache::Shard<T>::Lookup(size_t hash, const std::string& text, const std::string& language, unsigned int flags)
+{
+    const auto range = m_index.equal_range(hash);
+    for (auto indexEntry = range.first; indexEntry != range.second; ++indexEntry)
+    {
+        const Entry& entry = *indexEntry->second;
+        if (entry.flags == flags && entry.text == text && entry.language == language)
+        {
+            return indexEntry->second;
+        }
+    }
+    return m_entries.end();
+}
+
+template<typename T>
+std::shared_ptr<const T> TextProcessingCache::Shard<T>::Find(size_t hash, const std::string& text, const std::string& language, unsigned int flags)
+{
+    const auto entry = Lookup(hash, text, language, flags);
+    if (entry == m_entries.end())
+    {
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+    return entry->value;
+}
+
+template<typename T>
+std::shared_ptr<const T> TextProcessingCache::Shard<T>::Insert(size_t hash,
+                                                               const std::string& text,
+                                                               const std::string& language,
+                                                               unsigned int flags,
+                                                               std::shared_ptr<const T>&& value,
+                                                               size_t capacity)
+{
+    const auto entry = Lookup(hash, text, language, flags);
+    if (entry != m_entries.end())
+    {
+        return entry->value;
+    }
+
+    Trim(capacity - 1);
+    m_entries.push_front(Entry{hash, text, language, flags, std::move(value)});
+    m_index.emplace(hash, m_entries.begin());
+    return m_entries.front().value;
+}
+
+template<typename T>
+void TextProcessingCache::Shard<T>::Trim(size_t capacity)
+{
+    while (m_entries.size() > capacity)
+    {
+        const auto leastRecentlyUsed = std::prev(m_entries.end());
+        const auto range = m_index.equal_range(leastRecentlyUsed->hash);
+        for (auto indexEntry = range.first; indexEntry != range.second; ++indexEntry)
+        {
+            if (indexEntry->second == leastRecentlyUsed)
+            {
+                m_index.erase(indexEntry);
+                break;
+            }
+        }
+        m_entries.erase(leastRecentlyUsed);
+    }
+}
+
+template<typename T>
+void TextProcessingCache::Shard<T>::Clear()
+{
+    m_index.clear();
+    m_entries.clear();
+}
+
+template<typename T>
+TextProcessingCacheStatistics TextProcessingCache::Shard<T>::GetStatistics() const
+{
+    return {m_hits, m_misses, m_entries.size()};
+}
+
+template<typename T>
+void TextProcessingCache::Shard<T>::ResetStatistics()
+{
+    m_hits = 0;
+    m_misses = 0;
+}
+
+TextProcessingCache::TextProcessingCache(size_t capacity) : m_capacity(capacity)
+{
+}
+
+TextProcessingCache& TextProcessingCache::GetDefault()
+{
+    static TextProcessingCache defaultCache(0);
+    return defaultCache;
+}
+
+size_t TextProcessingCache::GetCapacity() const
+{
+    return m_capacity;
+}
+
+void TextProcessingCache::SetCapacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = capacity;
+    m_markDown.Trim(capacity);
+    m_dateTime.Trim(capacity);
+}
+
+void TextProcessingCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_markDown.Clear();
+    m_dateTime.Clear();
+}
+
+// texts are processed without holding the lock, so a text that several threads miss at once is processed by each of
+// them, and they all get the result cached first
+template<typename T, typename TProcess>
+std::shared_ptr<const T> TextProcessingCache::GetOrProcess(
+    Shard<T>& shard, const std::string& text, const std::string& language, unsigned int flags, TProcess process)
+{
+    // a disabled cache costs a single load
+    if (m_capacity.load(std::memory_order_relaxed) == 0)
+    {
+        return process();
+    }
+
+    const size_t hash = HashKey(text, language, flags);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (auto value = shard.Find(hash, text, language, flags))
+        {
+            return value;
+        }
+    }
+
+    std::shared_ptr<const T> value = process();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t capacity = m_capacity;
+    return capacity ? shard.Insert(hash, text, language, flags, std::move(value), capacity) : value;
+}
+
+std::shared_ptr<const ProcessedMarkDown> TextProcessingCache::GetMarkDown(const std::string& text, const std::string& language, unsigned int outputs)
+{
+    return GetOrProcess(m_markDown, text, language, outputs, [&text, outputs]() {
+        return std::make_shared<const ProcessedMarkDown>(text, outputs);
+    });
+}
+
+std::shared_ptr<const DateTimePreparser> TextProcessingCache::GetDateTimePreparser(const std::string& text)
+{
+    static const std::string anyLanguage;
+    return GetOrProcess(m_dateTime, text, anyLanguage, 0, [&text]() { return std::make_shared<const DateTimePreparser>(text); });
+}
+
+const DateTimePreparser& TextProcessingCache::GetDateTimePreparser(std::shared_ptr<const DateTimePreparser>& preparsed,
+                                                                   const std::string& text)
+{
+    auto current = std::atomic_load(&preparsed);
+    if (current == nullptr)
+    {
+        auto processed = GetDefault().GetDateTimePreparser(text);
+        // on failure, current is set to the result another thread stored in the meantime
+        if (std::atomic_compare_exchange_strong(&preparsed, &current, processed))
+        {
+            current = std::move(processed);
+        }
+    }
+    return *current;
+}
+
+TextProcessingCacheStatistics TextProcessingCache::GetMarkDownStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_markDown.GetStatistics();
+}
+
+TextProcessingCacheStatistics TextProcessingCache::GetDateTimeStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_dateTime.GetStatistics();
+}
+
+void TextProcessingCache::ResetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_markDown.ResetStatistics();
+    m_dateTime.ResetStatistics();
+}
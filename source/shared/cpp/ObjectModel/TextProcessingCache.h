@@ -0,0 +1,136 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+#pragma once
+
+#include "pch.h"
+#include <atomic>
+#include <list>
+#include <mutex>
+#include "DateTimePreparser.h"
+#include "MarkDownInlineRun.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // MarkDown of a text, processed once and shared by everything that renders the same text
+    class ProcessedMarkDown
+    {
+    public:
+        enum Output : unsigned int
+        {
+            Html = 1,
+            InlineRuns = 2
+        };
+
+        // outputs is a combination of Output flags
+        ProcessedMarkDown(const std::string& text, unsigned int outputs);
+
+        // Empty unless Html output was requested
+        const std::string& GetHtml() const;
+        // Empty unless InlineRuns output was requested
+        const std::vector<MarkDownInlineRun>& GetInlineRuns() const;
+        bool HasHtmlTags() const;
+        bool IsEscaped() const;
+
+    private:
+        std::string m_html;
+        std::vector<MarkDownInlineRun> m_inlineRuns;
+        bool m_hasHtmlTags;
+        bool m_isEscaped;
+    };
+
+    struct TextProcessingCacheStatistics
+    {
+        unsigned long long hits;
+        unsigned long long misses;
+        size_t entries;
+
+        double GetHitRate() const;
+    };
+
+    // Cache of processed MarkDown and date/time text, keyed by text, language and flags. Chat messages and templated
+    // cards repeat the same strings, and each render would otherwise process them again.
+    //
+    // Date/time text is keyed by text alone, as preparsing doesn't depend on the language. It converts dates to the
+    // local time zone though, so hosts that change the time zone of the process must Clear() the cache, and preparse
+    // the text of their elements again, by setting it, for the change to show.
+    //
+    // Results are immutable and shared, so they may be used on any thread. The cache holds at most capacity results of
+    // each kind and drops the least recently used ones. A cache with capacity 0 is disabled and processes every text.
+    class TextProcessingCache
+    {
+    public:
+        explicit TextProcessingCache(size_t capacity);
+        TextProcessingCache(const TextProcessingCache&) = delete;
+        TextProcessingCache& operator=(const TextProcessingCache&) = delete;
+
+        // The process-wide cache used by text elements and facts. It's disabled until the host sets its capacity.
+        static TextProcessingCache& GetDefault();
+
+        size_t GetCapacity() const;
+        void SetCapacity(size_t capacity);
+        void Clear();
+
+        // outputs is a combination of ProcessedMarkDown::Output flags
+        std::shared_ptr<const ProcessedMarkDown> GetMarkDown(const std::string& text,
+                                                             const std::string& language,
+                                                             unsigned int outputs = ProcessedMarkDown::Html);
+        std::shared_ptr<const DateTimePreparser> GetDateTimePreparser(const std::string& text);
+
+        // The preparsed text held by preparsed, which is filled from the default cache on first use. Elements preparse
+        // their text lazily from const getters, which hosts may call on several threads: preparsed is read and filled
+        // atomically, and the first result stored is the one every caller gets.
+        static const DateTimePreparser& GetDateTimePreparser(std::shared_ptr<const DateTimePreparser>& preparsed,
+                                                             const std::string& text);
+
+        TextProcessingCacheStatistics GetMarkDownStatistics() const;
+        TextProcessingCacheStatistics GetDateTimeStatistics() const;
+        void ResetStatistics();
+
+    private:
+        // Least recently used results of one kind
+        template<typename T>
+        class Shard
+        {
+        public:
+            std::shared_ptr<const T> Find(size_t hash, const std::string& text, const std::string& language, unsigned int flags);
+            // Returns the result cached by another thread in the meantime, if any
+            std::shared_ptr<const T> Insert(size_t hash,
+                                            const std::string& text,
+                                            const std::string& language,
+                                            unsigned int flags,
+                                            std::shared_ptr<const T>&& value,
+                                            size_t capacity);
+            void Trim(size_t capacity);
+            void Clear();
+            TextProcessingCacheStatistics GetStatistics() const;
+            void ResetStatistics();
+
+        private:
+            struct Entry
+            {
+                size_t hash;
+                std::string text;
+                std::string language;
+                unsigned int flags;
+                std::shared_ptr<const T> value;
+            };
+            typedef typename std::list<Entry>::iterator EntryIterator;
+
+            EntryIterator Lookup(size_t hash, const std::string& text, const std::string& language, unsigned int flags);
+
+            // most recently used first
+            std::list<Entry> m_entries;
+            std::unordered_multimap<size_t, EntryIterator> m_index;
+            unsigned long long m_hits = 0;
+            unsigned long long m_misses = 0;
+        };
+
+        template<typename T, typename TProcess>
+        std::shared_ptr<const T> GetOrProcess(Shard<T>& shard, const std::string& text, const std::string& language, unsigned int flags, TProcess process);
+
+        std::atomic<size_t> m_capacity;
+        mutable std::mutex m_mutex;
+        Shard<ProcessedMarkDown> m_markDown;
+        Shard<DateTimePreparser> m_dateTime;
+    };
+}
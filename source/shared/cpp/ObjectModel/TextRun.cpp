@@ -2,25 +2,24 @@
 // Licensed under the MIT License.
 #include "pch.h"
 #include "TextRun.h"
+#include "Util.h"
 
 using namespace AdaptiveSharedNamespace;
 
-TextRun::TextRun() :
-    Inline(InlineElementType::TextRun), m_textElementProperties(std::make_shared<RichTextElementProperties>()),
-    m_highlight(false)
-{
-    PopulateKnownPropertiesSet();
-}
+static_assert(sizeof(TextRun) <= UnpaddedSize(sizeof(Inline) + sizeof(bool) + sizeof(RichTextElementProperties) +
+                                                  sizeof(std::shared_ptr<BaseActionElement>),
+                                              alignof(TextRun)),
+              "TextRun is larger than its fields, keep them ordered by alignment");
 
-void TextRun::PopulateKnownPropertiesSet()
+TextRun::TextRun() :
+    Inline(InlineElementType::TextRun), m_highlight(false)
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
 {
     Json::Value root{};
-    root = m_textElementProperties->SerializeToJsonValue(root);
+    root = m_textElementProperties.SerializeToJsonValue(root);
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = GetInlineTypeString();
 
     if (m_highlight)
@@ -36,89 +35,89 @@ Json::Value TextRun::SerializeToJsonValue() const
     return root;
 }
 
-std::string TextRun::GetText() const
+const std::string& TextRun::GetText() const
 {
-    return m_textElementProperties->GetText();
+    return m_textElementProperties.GetText();
 }
 
-void TextRun::SetText(const std::string& value)
+void TextRun::SetText(std::string value)
 {
-    m_textElementProperties->SetText(value);
+    m_textElementProperties.SetText(std::move(value));
 }
 
-DateTimePreparser TextRun::GetTextForDateParsing() const
+const DateTimePreparser& TextRun::GetTextForDateParsing() const
 {
-    return m_textElementProperties->GetTextForDateParsing();
+    return m_textElementProperties.GetTextForDateParsing();
 }
 
 TextSize TextRun::GetTextSize() const
 {
-    return m_textElementProperties->GetTextSize();
+    return m_textElementProperties.GetTextSize();
 }
 
 void TextRun::SetTextSize(const TextSize value)
 {
-    m_textElementProperties->SetTextSize(value);
+    m_textElementProperties.SetTextSize(value);
 }
 
 TextWeight TextRun::GetTextWeight() const
 {
-    return m_textElementProperties->GetTextWeight();
+    return m_textElementProperties.GetTextWeight();
 }
 
 void TextRun::SetTextWeight(const TextWeight value)
 {
-    m_textElementProperties->SetTextWeight(value);
+    m_textElementProperties.SetTextWeight(value);
 }
 
 FontType TextRun::GetFontType() const
 {
-    return m_textElementProperties->GetFontType();
+    return m_textElementProperties.GetFontType();
 }
 
 void TextRun::SetFontType(const FontType value)
 {
-    m_textElementProperties->SetFontType(value);
+    m_textElementProperties.SetFontType(value);
 }
 
 ForegroundColor TextRun::GetTextColor() const
 {
-    return m_textElementProperties->GetTextColor();
+    return m_textElementProperties.GetTextColor();
 }
 
 void TextRun::SetTextColor(const ForegroundColor value)
 {
-    m_textElementProperties->SetTextColor(value);
+    m_textElementProperties.SetTextColor(value);
 }
 
 bool TextRun::GetIsSubtle() const
 {
-    return m_textElementProperties->GetIsSubtle();
+    return m_textElementProperties.GetIsSubtle();
 }
 
 void TextRun::SetIsSubtle(const bool value)
 {
-    m_textElementProperties->SetIsSubtle(value);
+    m_textElementProperties.SetIsSubtle(value);
 }
 
 bool TextRun::GetItalic() const
 {
-    return m_textElementProperties->GetItalic();
+    return m_textElementProperties.GetItalic();
 }
 
 void TextRun::SetItalic(const bool value)
 {
-    m_textElementProperties->SetItalic(value);
+    m_textElementProperties.SetItalic(value);
 }
 
 bool TextRun::GetStrikethrough() const
 {
-    return m_textElementProperties->GetStrikethrough();
+    return m_textElementProperties.GetStrikethrough();
 }
 
 void TextRun::SetStrikethrough(const bool value)
 {
-    m_textElementProperties->SetStrikethrough(value);
+    m_textElementProperties.SetStrikethrough(value);
 }
 
 bool TextRun::GetHighlight() const
@@ -131,14 +130,14 @@ void TextRun::SetHighlight(const bool value)
     m_highlight = value;
 }
 
-std::string TextRun::GetLanguage() const
+const std::string& TextRun::GetLanguage() const
 {
-    return m_textElementProperties->GetLanguage();
+    return m_textElementProperties.GetLanguage();
 }
 
-void TextRun::SetLanguage(const std::string& value)
+void TextRun::SetLanguage(std::string value)
 {
-    m_textElementProperties->SetLanguage(value);
+    m_textElementProperties.SetLanguage(std::move(value));
 }
 
 std::shared_ptr<BaseActionElement> TextRun::GetSelectAction() const
@@ -153,33 +152,63 @@ void TextRun::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 
 bool TextRun::GetUnderline() const
 {
-    return m_textElementProperties->GetUnderline();
+    return m_textElementProperties.GetUnderline();
 }
 
 void TextRun::SetUnderline(const bool value)
 {
-    m_textElementProperties->SetUnderline(value);
+    m_textElementProperties.SetUnderline(value);
 }
 
-std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::Value& json)
+template<typename TPolicy>
+void TextRun::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
-    std::shared_ptr<TextRun> inlineTextRun = std::make_shared<TextRun>();
-
     if (json.isString())
     {
-        inlineTextRun->SetText(json.asString());
+        if (TextRun* textRun = policy.Object())
+        {
+            textRun->SetText(json.asString());
+        }
+        return;
     }
-    else
-    {
-        ParseUtil::ExpectTypeString(json, InlineElementTypeToString(InlineElementType::TextRun));
-        inlineTextRun->m_textElementProperties->Deserialize(context, json);
 
-        inlineTextRun->SetHighlight(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Highlight, false));
-        inlineTextRun->SetUnderline(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Underline, false));
-        inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
+    ParseUtil::ExpectTypeString(json, InlineElementTypeToString(InlineElementType::TextRun));
+    RichTextElementProperties::ParseProperties(policy.Part(&TextRun::m_textElementProperties), context, json);
+
+    policy.Bool(json, AdaptiveCardSchemaKey::Highlight, false, &TextRun::SetHighlight);
+    policy.Bool(json, AdaptiveCardSchemaKey::Underline, false, &TextRun::SetUnderline);
+    policy.Action(context, json, AdaptiveCardSchemaKey::SelectAction, &TextRun::SetSelectAction);
 
-        HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+    if (TextRun* textRun = policy.Object())
+    {
+        textRun->PopulateKnownPropertiesSet();
+        HandleUnknownProperties(json,
+                                GetSchemaProperties(InlineElementType::TextRun),
+                                textRun->m_knownProperties,
+                                textRun->m_additionalProperties);
     }
+}
+
+std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    std::shared_ptr<TextRun> inlineTextRun = std::make_shared<TextRun>();
+    ParseProperties(BuildPolicy<TextRun>(*inlineTextRun), context, json);
 
     return inlineTextRun;
 }
+
+void TextRun::Validate(ParseContext& context, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<TextRun>(), context, json);
+}
+
+void TextRun::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(TextRun));
+    Inline::AccumulateMemoryUsage(usage);
+    m_textElementProperties.AccumulateMemoryUsage(usage);
+    if (m_selectAction)
+    {
+        m_selectAction->AccumulateMemoryUsage(usage);
+    }
+}
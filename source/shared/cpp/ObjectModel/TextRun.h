@@ -20,12 +20,14 @@ namespace AdaptiveSharedNamespace
         ~TextRun() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
         static std::shared_ptr<Inline> Deserialize(ParseContext& context, const Json::Value& root);
+        static void Validate(ParseContext& context, const Json::Value& root);
 
-        std::string GetText() const;
-        void SetText(const std::string& value);
-        DateTimePreparser GetTextForDateParsing() const;
+        const std::string& GetText() const;
+        void SetText(std::string value);
+        const DateTimePreparser& GetTextForDateParsing() const;
 
         TextSize GetTextSize() const;
         void SetTextSize(const TextSize value);
@@ -51,8 +53,8 @@ namespace AdaptiveSharedNamespace
         bool GetHighlight() const;
         void SetHighlight(const bool value);
 
-        void SetLanguage(const std::string& value);
-        std::string GetLanguage() const;
+        void SetLanguage(std::string value);
+        const std::string& GetLanguage() const;
 
         bool GetUnderline() const;
         void SetUnderline(const bool value);
@@ -61,9 +63,13 @@ namespace AdaptiveSharedNamespace
         void SetSelectAction(const std::shared_ptr<BaseActionElement> action);
 
     protected:
-        std::shared_ptr<RichTextElementProperties> m_textElementProperties;
-        void PopulateKnownPropertiesSet() override;
-        std::shared_ptr<BaseActionElement> m_selectAction;
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
+
+        // Text properties are held by value, so that a run is a single allocation. The flag comes first, where some
+        // ABIs place it in the padding at the end of Inline.
         bool m_highlight;
+        RichTextElementProperties m_textElementProperties;
+        std::shared_ptr<BaseActionElement> m_selectAction;
     };
 }
@@ -9,7 +9,6 @@ using namespace AdaptiveSharedNamespace;
 
 TimeInput::TimeInput() : BaseInputElement(CardElementType::TimeInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TimeInput::SerializeToJsonValue() const
@@ -39,56 +38,73 @@ Json::Value TimeInput::SerializeToJsonValue() const
     return root;
 }
 
-std::string TimeInput::GetMax() const
+const std::string& TimeInput::GetMax() const
 {
     return m_max;
 }
 
-void TimeInput::SetMax(const std::string& value)
+void TimeInput::SetMax(std::string value)
 {
-    m_max = value;
+    m_max = std::move(value);
 }
 
-std::string TimeInput::GetMin() const
+const std::string& TimeInput::GetMin() const
 {
     return m_min;
 }
 
-void TimeInput::SetMin(const std::string& value)
+void TimeInput::SetMin(std::string value)
 {
-    m_min = value;
+    m_min = std::move(value);
 }
 
-std::string TimeInput::GetPlaceholder() const
+const std::string& TimeInput::GetPlaceholder() const
 {
     return m_placeholder;
 }
 
-void TimeInput::SetPlaceholder(const std::string& value)
+void TimeInput::SetPlaceholder(std::string value)
 {
-    m_placeholder = value;
+    m_placeholder = std::move(value);
 }
 
-std::string TimeInput::GetValue() const
+const std::string& TimeInput::GetValue() const
 {
     return m_value;
 }
 
-void TimeInput::SetValue(const std::string& value)
+void TimeInput::SetValue(std::string value)
 {
-    m_value = value;
+    m_value = std::move(value);
 }
 
-std::shared_ptr<BaseCardElement> TimeInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+void TimeInput::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(TimeInput));
+    BaseInputElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_max);
+    usage.AddString(m_min);
+    usage.AddString(m_placeholder);
+    usage.AddString(m_value);
+}
+
+template<typename TPolicy>
+void TimeInputParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::TimeInput);
 
-    std::shared_ptr<TimeInput> timeInput = BaseInputElement::Deserialize<TimeInput>(context, json);
+    BaseInputElement::ParseProperties(policy, context, json);
 
-    timeInput->SetMax(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Max));
-    timeInput->SetMin(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Min));
-    timeInput->SetPlaceholder(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Placeholder));
-    timeInput->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value));
+    policy.String(json, AdaptiveCardSchemaKey::Max, &TimeInput::SetMax);
+    policy.String(json, AdaptiveCardSchemaKey::Min, &TimeInput::SetMin);
+    policy.String(json, AdaptiveCardSchemaKey::Placeholder, &TimeInput::SetPlaceholder);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &TimeInput::SetValue);
+}
+
+std::shared_ptr<BaseCardElement> TimeInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto timeInput = std::make_shared<TimeInput>();
+    ParseProperties(BuildPolicy<TimeInput>(*timeInput), context, json);
 
     return timeInput;
 }
@@ -98,10 +114,9 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(ParseCon
     return TimeInputParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void TimeInput::PopulateKnownPropertiesSet()
+bool TimeInputParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)});
+    ParseProperties(ValidatePolicy<TimeInput>(), context, json);
+
+    return true;
 }
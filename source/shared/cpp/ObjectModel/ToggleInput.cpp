@@ -10,7 +10,6 @@ using namespace AdaptiveSharedNamespace;
 ToggleInput::ToggleInput() :
     BaseInputElement(CardElementType::ToggleInput), m_valueOff("false"), m_valueOn("true"), m_wrap(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value ToggleInput::SerializeToJsonValue() const
@@ -42,43 +41,43 @@ Json::Value ToggleInput::SerializeToJsonValue() const
     return root;
 }
 
-std::string ToggleInput::GetTitle() const
+const std::string& ToggleInput::GetTitle() const
 {
     return m_title;
 }
 
-void ToggleInput::SetTitle(const std::string& value)
+void ToggleInput::SetTitle(std::string value)
 {
-    m_title = value;
+    m_title = std::move(value);
 }
 
-std::string ToggleInput::GetValue() const
+const std::string& ToggleInput::GetValue() const
 {
     return m_value;
 }
 
-void ToggleInput::SetValue(const std::string& value)
+void ToggleInput::SetValue(std::string value)
 {
-    m_value = value;
+    m_value = std::move(value);
 }
-void ToggleInput::SetValueOff(const std::string& valueOff)
+void ToggleInput::SetValueOff(std::string valueOff)
 {
-    m_valueOff = valueOff;
+    m_valueOff = std::move(valueOff);
 }
 
-std::string ToggleInput::GetValueOff() const
+const std::string& ToggleInput::GetValueOff() const
 {
     return m_valueOff;
 }
 
-std::string ToggleInput::GetValueOn() const
+const std::string& ToggleInput::GetValueOn() const
 {
     return m_valueOn;
 }
 
-void ToggleInput::SetValueOn(const std::string& valueOn)
+void ToggleInput::SetValueOn(std::string valueOn)
 {
-    m_valueOn = valueOn;
+    m_valueOn = std::move(valueOn);
 }
 
 bool ToggleInput::GetWrap() const
@@ -91,17 +90,34 @@ void ToggleInput::SetWrap(bool value)
     m_wrap = value;
 }
 
-std::shared_ptr<BaseCardElement> ToggleInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+void ToggleInput::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(ToggleInput));
+    BaseInputElement::AccumulateMemoryUsage(usage);
+    usage.AddString(m_title);
+    usage.AddString(m_value);
+    usage.AddString(m_valueOff);
+    usage.AddString(m_valueOn);
+}
+
+template<typename TPolicy>
+void ToggleInputParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     ParseUtil::ExpectTypeString(json, CardElementType::ToggleInput);
 
-    std::shared_ptr<ToggleInput> toggleInput = BaseInputElement::Deserialize<ToggleInput>(context, json);
+    BaseInputElement::ParseProperties(policy, context, json);
 
-    toggleInput->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true));
-    toggleInput->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value));
-    toggleInput->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false, false));
-    toggleInput->SetValueOff(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ValueOff, std::string("false")));
-    toggleInput->SetValueOn(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ValueOn, std::string("true")));
+    policy.String(json, AdaptiveCardSchemaKey::Title, &ToggleInput::SetTitle, true);
+    policy.String(json, AdaptiveCardSchemaKey::Value, &ToggleInput::SetValue);
+    policy.Bool(json, AdaptiveCardSchemaKey::Wrap, false, &ToggleInput::SetWrap, false);
+    policy.String(json, AdaptiveCardSchemaKey::ValueOff, std::string("false"), &ToggleInput::SetValueOff);
+    policy.String(json, AdaptiveCardSchemaKey::ValueOn, std::string("true"), &ToggleInput::SetValueOn);
+}
+
+std::shared_ptr<BaseCardElement> ToggleInputParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto toggleInput = std::make_shared<ToggleInput>();
+    ParseProperties(BuildPolicy<ToggleInput>(*toggleInput), context, json);
 
     return toggleInput;
 }
@@ -112,11 +128,9 @@ ToggleInputParser::DeserializeFromString(ParseContext& context, const std::strin
     return ToggleInputParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ToggleInput::PopulateKnownPropertiesSet()
+bool ToggleInputParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff),
-                              AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
+    ParseProperties(ValidatePolicy<ToggleInput>(), context, json);
+
+    return true;
 }
@@ -19,25 +19,24 @@ namespace AdaptiveSharedNamespace
         ~ToggleInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
-        std::string GetTitle() const;
-        void SetTitle(const std::string& value);
+        const std::string& GetTitle() const;
+        void SetTitle(std::string value);
 
-        std::string GetValue() const;
-        void SetValue(const std::string& value);
+        const std::string& GetValue() const;
+        void SetValue(std::string value);
 
-        std::string GetValueOff() const;
-        void SetValueOff(const std::string& value);
+        const std::string& GetValueOff() const;
+        void SetValueOff(std::string value);
 
-        std::string GetValueOn() const;
-        void SetValueOn(const std::string& value);
+        const std::string& GetValueOn() const;
+        void SetValueOn(std::string value);
 
         bool GetWrap() const;
         void SetWrap(bool value);
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::string m_title;
         std::string m_value;
         std::string m_valueOff;
@@ -57,5 +56,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& root) override;
         std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
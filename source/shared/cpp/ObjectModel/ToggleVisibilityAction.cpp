@@ -8,7 +8,6 @@ using namespace AdaptiveSharedNamespace;
 
 ToggleVisibilityAction::ToggleVisibilityAction() : BaseActionElement(ActionType::ToggleVisibility)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<ToggleVisibilityTarget>>& ToggleVisibilityAction::GetTargetElements() const
@@ -34,13 +33,32 @@ Json::Value ToggleVisibilityAction::SerializeToJsonValue() const
     return root;
 }
 
-std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+void ToggleVisibilityAction::AccumulateMemoryUsage(MemoryUsage& usage) const
 {
-    std::shared_ptr<ToggleVisibilityAction> toggleVisibilityAction = BaseActionElement::Deserialize<ToggleVisibilityAction>(context, json);
+    usage.AddObject(sizeof(ToggleVisibilityAction));
+    BaseActionElement::AccumulateMemoryUsage(usage);
+    usage.AddObjects(m_targetElements);
+}
+
+template<typename TPolicy>
+void ToggleVisibilityActionParser::ParseProperties(const TPolicy& policy,
+                                                   ParseContext& context,
+                                                   const Json::Value& json)
+{
+    BaseActionElement::ParseProperties(policy, context, json);
+
+    policy.template Items<ToggleVisibilityTarget>(
+        context, json, AdaptiveCardSchemaKey::TargetElements, &ToggleVisibilityAction::m_targetElements, true);
+}
+
+std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::Deserialize(ParseContext& context,
+                                                                             const Json::Value& json)
+{
+    auto toggleVisibilityAction = std::make_shared<ToggleVisibilityAction>();
+    ParseProperties(BuildPolicy<ToggleVisibilityAction>(*toggleVisibilityAction), context, json);
 
-    auto targetElements = ParseUtil::GetElementCollectionOfSingleType<ToggleVisibilityTarget>(
-        context, json, AdaptiveCardSchemaKey::TargetElements, ToggleVisibilityTarget::Deserialize, true);
-    toggleVisibilityAction->m_targetElements = std::move(targetElements);
+    // targets are resolved once the whole card has been parsed, as they may refer to elements that follow the action
+    context.AddToggleVisibilityAction(toggleVisibilityAction);
 
     return toggleVisibilityAction;
 }
@@ -50,7 +68,9 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
     return ToggleVisibilityActionParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
-void ToggleVisibilityAction::PopulateKnownPropertiesSet()
+bool ToggleVisibilityActionParser::Validate(ParseContext& context, const Json::Value& json)
 {
-    m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
+    ParseProperties(ValidatePolicy<ToggleVisibilityAction>(), context, json);
+
+    return true;
 }
@@ -20,10 +20,9 @@ namespace AdaptiveSharedNamespace
         std::vector<std::shared_ptr<ToggleVisibilityTarget>>& GetTargetElements();
 
         Json::Value SerializeToJsonValue() const override;
+        void AccumulateMemoryUsage(MemoryUsage& usage) const override;
 
     private:
-        void PopulateKnownPropertiesSet() override;
-
         std::vector<std::shared_ptr<ToggleVisibilityTarget>> m_targetElements;
     };
 
@@ -39,5 +38,10 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BaseActionElement> Deserialize(ParseContext& context, const Json::Value& value) override;
         std::shared_ptr<BaseActionElement> DeserializeFromString(ParseContext& context, const std::string& jsonString) override;
+        bool Validate(ParseContext& context, const Json::Value& value) override;
+
+    private:
+        template<typename TPolicy>
+        static void ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json);
     };
 }
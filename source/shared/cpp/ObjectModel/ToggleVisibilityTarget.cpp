@@ -1,6 +1,7 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "pch.h"
+#include "ParsePolicy.h"
 #include "ParseUtil.h"
 #include "ToggleVisibilityTarget.h"
 
@@ -10,14 +11,15 @@ ToggleVisibilityTarget::ToggleVisibilityTarget() : m_visibilityToggle(IsVisibleT
 {
 }
 
-std::string ToggleVisibilityTarget::GetElementId() const
+const std::string& ToggleVisibilityTarget::GetElementId() const
 {
     return m_targetId;
 }
 
-void ToggleVisibilityTarget::SetElementId(const std::string& value)
+void ToggleVisibilityTarget::SetElementId(std::string value)
 {
-    m_targetId = value;
+    m_targetId = std::move(value);
+    m_targetElement.reset();
 }
 
 IsVisible ToggleVisibilityTarget::GetIsVisible() const
@@ -30,32 +32,45 @@ void ToggleVisibilityTarget::SetIsVisible(IsVisible value)
     m_visibilityToggle = value;
 }
 
-std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<BaseElement> ToggleVisibilityTarget::GetElement() const
 {
-    auto toggleVisibilityTargetElement = std::make_shared<ToggleVisibilityTarget>();
+    return m_targetElement.lock();
+}
+
+void ToggleVisibilityTarget::SetElement(const std::shared_ptr<BaseElement>& element)
+{
+    m_targetElement = element;
+}
 
+template<typename TPolicy> void ToggleVisibilityTarget::ParseProperties(const TPolicy& policy, const Json::Value& json)
+{
     if (json.isString())
     {
-        toggleVisibilityTargetElement->SetElementId(json.asString());
+        policy.Set(&ToggleVisibilityTarget::SetElementId, json.asString());
+        return;
     }
-    else
-    {
-        toggleVisibilityTargetElement->SetElementId(ParseUtil::GetString(json, AdaptiveCardSchemaKey::ElementId, true));
 
-        auto propertyValue = json.get(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible), Json::Value());
-        if (!propertyValue.empty())
+    policy.String(json, AdaptiveCardSchemaKey::ElementId, &ToggleVisibilityTarget::SetElementId, true);
+
+    const auto& propertyValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::IsVisible);
+    if (!propertyValue.empty())
+    {
+        if (!propertyValue.isBool())
         {
-            if (!propertyValue.isBool())
-            {
-                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
-                                                 "Value for property " +
-                                                     AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible) +
-                                                     " was invalid. Expected type bool.");
-            }
-
-            toggleVisibilityTargetElement->SetIsVisible(propertyValue.asBool() ? IsVisibleTrue : IsVisibleFalse);
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                             "Value for property " +
+                                                 AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible) +
+                                                 " was invalid. Expected type bool.");
         }
+
+        policy.Set(&ToggleVisibilityTarget::SetIsVisible, propertyValue.asBool() ? IsVisibleTrue : IsVisibleFalse);
     }
+}
+
+std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(ParseContext&, const Json::Value& json)
+{
+    auto toggleVisibilityTargetElement = std::make_shared<ToggleVisibilityTarget>();
+    ParseProperties(BuildPolicy<ToggleVisibilityTarget>(*toggleVisibilityTargetElement), json);
 
     return toggleVisibilityTargetElement;
 }
@@ -65,6 +80,11 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::DeserializeFromS
     return ToggleVisibilityTarget::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
+void ToggleVisibilityTarget::Validate(ParseContext&, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<ToggleVisibilityTarget>(), json);
+}
+
 std::string ToggleVisibilityTarget::Serialize()
 {
     return ParseUtil::JsonToString(SerializeToJsonValue());
@@ -87,3 +107,9 @@ Json::Value ToggleVisibilityTarget::SerializeToJsonValue()
         return root;
     }
 }
+
+void ToggleVisibilityTarget::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(ToggleVisibilityTarget));
+    usage.AddString(m_targetId);
+}
@@ -20,20 +20,31 @@ namespace AdaptiveSharedNamespace
     public:
         ToggleVisibilityTarget();
 
-        std::string GetElementId() const;
-        void SetElementId(const std::string& value);
+        const std::string& GetElementId() const;
+        void SetElementId(std::string value);
 
         IsVisible GetIsVisible() const;
         void SetIsVisible(IsVisible value);
 
+        // The element with the target id, resolved when the card containing the action was parsed. Null if the card
+        // has no such element, or if the target wasn't created by a parse. Changing the element id clears it.
+        std::shared_ptr<BaseElement> GetElement() const;
+        void SetElement(const std::shared_ptr<BaseElement>& element);
+
         std::string Serialize();
         Json::Value SerializeToJsonValue();
+        void AccumulateMemoryUsage(MemoryUsage& usage) const;
 
         static std::shared_ptr<ToggleVisibilityTarget> Deserialize(ParseContext& context, const Json::Value& root);
         static std::shared_ptr<ToggleVisibilityTarget> DeserializeFromString(ParseContext& context, const std::string& jsonString);
+        static void Validate(ParseContext& context, const Json::Value& root);
 
     private:
+        template<typename TPolicy> static void ParseProperties(const TPolicy& policy, const Json::Value& json);
+
         std::string m_targetId;
         IsVisible m_visibilityToggle;
+        // weak so that an element can toggle itself (e.g. through its selectAction) without an ownership cycle
+        std::weak_ptr<BaseElement> m_targetElement;
     };
 }
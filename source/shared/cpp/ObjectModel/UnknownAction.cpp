@@ -14,12 +14,30 @@ Json::Value AdaptiveSharedNamespace::UnknownAction::SerializeToJsonValue() const
     return GetAdditionalProperties();
 }
 
-std::shared_ptr<BaseActionElement> UnknownActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+void UnknownAction::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(UnknownAction));
+    BaseActionElement::AccumulateMemoryUsage(usage);
+}
+
+template<typename TPolicy>
+void UnknownActionParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     std::string actualType = ParseUtil::GetTypeAsString(json);
-    std::shared_ptr<UnknownAction> unknown = BaseActionElement::Deserialize<UnknownAction>(context, json);
-    unknown->SetAdditionalProperties(json);
-    unknown->SetElementTypeString(actualType);
+    BaseActionElement::ParseProperties(policy, context, json);
+
+    if (UnknownAction* unknown = policy.Object())
+    {
+        unknown->SetAdditionalProperties(json);
+        unknown->SetElementTypeString(context.Intern(std::move(actualType)));
+    }
+}
+
+std::shared_ptr<BaseActionElement> UnknownActionParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto unknown = std::make_shared<UnknownAction>();
+    ParseProperties(BuildPolicy<UnknownAction>(*unknown), context, json);
+
     return unknown;
 }
 
@@ -28,3 +46,10 @@ UnknownActionParser::DeserializeFromString(ParseContext& context, const std::str
 {
     return UnknownActionParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+bool UnknownActionParser::Validate(ParseContext& context, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<UnknownAction>(), context, json);
+
+    return true;
+}
@@ -13,17 +13,34 @@ UnknownElement::UnknownElement() : BaseCardElement(CardElementType::Unknown)
 {
 }
 
-std::shared_ptr<BaseCardElement> UnknownElementParser::Deserialize(ParseContext& context, const Json::Value& json)
+void UnknownElement::AccumulateMemoryUsage(MemoryUsage& usage) const
+{
+    usage.AddObject(sizeof(UnknownElement));
+    BaseCardElement::AccumulateMemoryUsage(usage);
+}
+
+template<typename TPolicy>
+void UnknownElementParser::ParseProperties(const TPolicy& policy, ParseContext& context, const Json::Value& json)
 {
     // A little tricky business -- We need to make sure that elements with unknown types [de]serialize with the same
     // type they came in with. e.g. "type": "MyCoolElement" yields an UnknownElement object, but still emits
     // "MyCoolElement" when serialized back to json. Here we get the real type string, let
-    // BaseCardElement::Deserialize() do its work, then put the real string back with SetElementTypeString (otherwise,
-    // the string will be initialized as "Unknown").
+    // BaseCardElement::ParseProperties() do its work, then put the real string back with SetElementTypeString
+    // (otherwise, the string will be initialized as "Unknown").
     std::string actualType = ParseUtil::GetTypeAsString(json);
-    std::shared_ptr<UnknownElement> unknown = BaseCardElement::Deserialize<UnknownElement>(context, json);
-    unknown->SetAdditionalProperties(json);
-    unknown->SetElementTypeString(actualType);
+    BaseCardElement::ParseProperties(policy, context, json);
+
+    if (UnknownElement* unknown = policy.Object())
+    {
+        unknown->SetAdditionalProperties(json);
+        unknown->SetElementTypeString(context.Intern(std::move(actualType)));
+    }
+}
+
+std::shared_ptr<BaseCardElement> UnknownElementParser::Deserialize(ParseContext& context, const Json::Value& json)
+{
+    auto unknown = std::make_shared<UnknownElement>();
+    ParseProperties(BuildPolicy<UnknownElement>(*unknown), context, json);
 
     return unknown;
 }
@@ -34,6 +51,13 @@ UnknownElementParser::DeserializeFromString(ParseContext& context, const std::st
     return UnknownElementParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
 
+bool UnknownElementParser::Validate(ParseContext& context, const Json::Value& json)
+{
+    ParseProperties(ValidatePolicy<UnknownElement>(), context, json);
+
+    return true;
+}
+
 Json::Value UnknownElement::SerializeToJsonValue() const
 {
     return GetAdditionalProperties();
@@ -9,127 +9,196 @@
 #include "ShowCardAction.h"
 #include "TextBlock.h"
 #include "Util.h"
+#include <cstring>
+#include <limits>
 
 using namespace AdaptiveSharedNamespace;
 
-std::string ValidateColor(const std::string& backgroundColor, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
+bool ShouldParseForExplicitDimension(const std::string& input)
 {
-    if (backgroundColor.empty())
+    if (input.empty())
     {
-        return backgroundColor;
+        return false;
     }
 
-    const size_t backgroundColorLength = backgroundColor.length();
-    bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
-    for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
-    {
-        isValidColor = isxdigit(backgroundColor.at(i));
-    }
+    char ch = input.at(0);
 
-    if (!isValidColor)
+    if ('-' == ch || '.' == ch)
     {
-        warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidColorFormat,
-                                                                         "Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format"));
-        return "#00000000";
+        return true;
     }
 
-    std::string validBackgroundColor;
-    // If format given was #RRGGBB
-    if (backgroundColorLength == 7)
+    size_t index = 0;
+    int hasDigit = 0;
+    while (index < input.length())
     {
-        validBackgroundColor = "#FF" + backgroundColor.substr(1, 6);
+        ch = input.at(index++);
+        hasDigit |= isdigit(ch);
+        if (hasDigit && (isalpha(ch) || '.' == ch))
+        {
+            return true;
+        }
     }
-    else
+    return false;
+}
+
+namespace
+{
+    // The warnings below are reported through a callable taking (WarningStatusCode, const char* message, payload), so
+    // they can be added to either a ParseContext or a plain vector of warnings
+    template<typename TReportWarning>
+    std::string ValidateColorImpl(const std::string& backgroundColor, TReportWarning&& reportWarning)
     {
-        validBackgroundColor = backgroundColor;
+        if (backgroundColor.empty())
+        {
+            return backgroundColor;
+        }
+
+        const size_t backgroundColorLength = backgroundColor.length();
+        bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
+        for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
+        {
+            isValidColor = isxdigit(backgroundColor.at(i));
+        }
+
+        if (!isValidColor)
+        {
+            reportWarning(WarningStatusCode::InvalidColorFormat,
+                          "Image background color specified, but doesn't follow #AARRGGBB or #RRGGBB format",
+                          std::string());
+            return "#00000000";
+        }
+
+        std::string validBackgroundColor;
+        // If format given was #RRGGBB
+        if (backgroundColorLength == 7)
+        {
+            validBackgroundColor = "#FF" + backgroundColor.substr(1, 6);
+        }
+        else
+        {
+            validBackgroundColor = backgroundColor;
+        }
+
+        return validBackgroundColor;
     }
 
-    return validBackgroundColor;
-}
+    bool IsDigit(char c) { return c >= '0' && c <= '9'; }
 
-void ValidateUserInputForDimensionWithUnit(const std::string& unit,
-                                           const std::string& requestedDimension,
-                                           int& parsedDimension,
-                                           std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
-{
-    const std::string warningMessage = "expected input arugment to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
-    parsedDimension = 0;
-    std::string stringPattern = "^([1-9]+\\d*)(\\.\\d+)?";
-    stringPattern += ("(" + unit + ")$");
-    std::regex pattern(stringPattern);
-    std::smatch matches;
-
-    if (std::regex_search(requestedDimension, matches, pattern))
+    // Matches the input against ^([1-9]+\d*)(\.\d+)?(<unit>)$ without building a regex, returning the length of
+    // the integral part if it matches or 0 otherwise
+    size_t MatchDimensionWithUnit(const std::string& requestedDimension, const char* unit)
     {
-        try
+        const size_t unitLength = std::strlen(unit);
+        if (requestedDimension.length() <= unitLength ||
+            requestedDimension.compare(requestedDimension.length() - unitLength, unitLength, unit) != 0)
         {
-            // stoi will get integral value upto non digit char indexed by idx
-            parsedDimension = std::stoi(matches[0]);
+            return 0;
         }
-        catch (const std::invalid_argument&)
+
+        const size_t numberLength = requestedDimension.length() - unitLength;
+        if (requestedDimension[0] < '1' || requestedDimension[0] > '9')
         {
-            if (warnings)
+            return 0;
+        }
+
+        size_t integralLength = 1;
+        while (integralLength < numberLength && IsDigit(requestedDimension[integralLength]))
+        {
+            ++integralLength;
+        }
+
+        if (integralLength < numberLength)
+        {
+            // The fraction needs at least one digit after the dot
+            if (requestedDimension[integralLength] != '.' || integralLength + 1 == numberLength)
             {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
-                                                                                  warningMessage + requestedDimension));
+                return 0;
             }
+
+            for (size_t i = integralLength + 1; i < numberLength; ++i)
+            {
+                if (!IsDigit(requestedDimension[i]))
+                {
+                    return 0;
+                }
+            }
+        }
+
+        return integralLength;
+    }
+
+    template<typename TReportWarning>
+    void ValidateUserInputForDimensionWithUnit(const char* unit,
+                                               const std::string& requestedDimension,
+                                               int& parsedDimension,
+                                               TReportWarning&& reportWarning)
+    {
+        const char* const warningMessage = "expected input arugment to be specified as \\d+(\\.\\d+)?px with no spaces, but received ";
+        parsedDimension = 0;
+
+        const size_t integralLength = MatchDimensionWithUnit(requestedDimension, unit);
+        if (!integralLength)
+        {
+            reportWarning(WarningStatusCode::InvalidDimensionSpecified, warningMessage, requestedDimension);
+            return;
         }
-        catch (const std::out_of_range&)
+
+        // Only the integral value is kept, and it has to fit in an int
+        long long value = 0;
+        for (size_t i = 0; i < integralLength; ++i)
         {
-            if (warnings)
+            value = value * 10 + (requestedDimension[i] - '0');
+            if (value > std::numeric_limits<int>::max())
             {
-                warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
-                                                                                  "out of range: " + requestedDimension));
+                reportWarning(WarningStatusCode::InvalidDimensionSpecified, "out of range: ", requestedDimension);
+                return;
             }
         }
+        parsedDimension = static_cast<int>(value);
     }
-    else
+
+    template<typename TReportWarning>
+    int ParseSizeForPixelSizeImpl(const std::string& sizeString, TReportWarning&& reportWarning)
     {
-        if (warnings)
+        int parsedDimension = 0;
+        if (ShouldParseForExplicitDimension(sizeString))
         {
-            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(WarningStatusCode::InvalidDimensionSpecified,
-                                                                              warningMessage + requestedDimension));
+            ValidateUserInputForDimensionWithUnit("px", sizeString, parsedDimension, reportWarning);
         }
+        return parsedDimension;
     }
 }
 
-bool ShouldParseForExplicitDimension(const std::string& input)
+std::string ValidateColor(const std::string& backgroundColor, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings)
 {
-    if (input.empty())
-    {
-        return false;
-    }
-
-    char ch = input.at(0);
+    return ValidateColorImpl(backgroundColor, [&warnings](WarningStatusCode statusCode, const char* message, const std::string& payload) {
+        warnings.emplace_back(std::make_shared<AdaptiveCardParseWarning>(statusCode, message + payload));
+    });
+}
 
-    if ('-' == ch || '.' == ch)
-    {
-        return true;
-    }
+std::string ValidateColor(const std::string& backgroundColor, ParseContext& context)
+{
+    return ValidateColorImpl(backgroundColor, [&context](WarningStatusCode statusCode, const char* message, const std::string& payload) {
+        context.AddWarning(statusCode, message, payload);
+    });
+}
 
-    size_t index = 0;
-    int hasDigit = 0;
-    while (index < input.length())
-    {
-        ch = input.at(index++);
-        hasDigit |= isdigit(ch);
-        if (hasDigit && (isalpha(ch) || '.' == ch))
+int ParseSizeForPixelSize(const std::string& sizeString, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
+{
+    return ParseSizeForPixelSizeImpl(sizeString, [warnings](WarningStatusCode statusCode, const char* message, const std::string& payload) {
+        if (warnings)
         {
-            return true;
+            warnings->emplace_back(std::make_shared<AdaptiveCardParseWarning>(statusCode, message + payload));
         }
-    }
-    return false;
+    });
 }
 
-int ParseSizeForPixelSize(const std::string& sizeString, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>* warnings)
+int ParseSizeForPixelSize(const std::string& sizeString, ParseContext& context)
 {
-    int parsedDimension = 0;
-    if (ShouldParseForExplicitDimension(sizeString))
-    {
-        const std::string unit = "px";
-        ValidateUserInputForDimensionWithUnit(unit, sizeString, parsedDimension, warnings);
-    }
-    return parsedDimension;
+    return ParseSizeForPixelSizeImpl(sizeString, [&context](WarningStatusCode statusCode, const char* message, const std::string& payload) {
+        context.AddWarning(statusCode, message, payload);
+    });
 }
 
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, const std::string& version)
@@ -138,10 +207,10 @@ void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>
     {
         if (action->GetElementType() == ActionType::ShowCard)
         {
-            auto showCardAction = std::static_pointer_cast<ShowCardAction>(action);
-            if (showCardAction->GetCard()->GetVersion().empty())
+            const auto& card = static_cast<ShowCardAction&>(*action).GetCard();
+            if (card->GetVersion().empty())
             {
-                showCardAction->GetCard()->SetVersion(version);
+                card->SetVersion(version);
             }
         }
     }
@@ -158,3 +227,25 @@ void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<s
         }
     }
 }
+
+void HandleUnknownProperties(const Json::Value& json,
+                             SchemaPropertySet schemaProperties,
+                             const std::unordered_set<std::string>& knownProperties,
+                             Json::Value& unknownProperties)
+{
+    for (auto it = json.begin(); it != json.end(); ++it)
+    {
+        const char* end;
+        const char* name = it.memberName(&end);
+        if (IsSchemaProperty(schemaProperties, name, end))
+        {
+            continue;
+        }
+
+        std::string key(name, end);
+        if (knownProperties.find(key) == knownProperties.end())
+        {
+            unknownProperties[key] = *it;
+        }
+    }
+}
@@ -4,14 +4,29 @@
 
 #include "BaseCardElement.h"
 #include "AdaptiveCardParseWarning.h"
+#include "SchemaProperties.h"
 
 std::string ValidateColor(const std::string& backgroundColor,
                           std::vector<std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCardParseWarning>>& warnings);
+std::string ValidateColor(const std::string& backgroundColor, AdaptiveSharedNamespace::ParseContext& context);
 
 int ParseSizeForPixelSize(const std::string& sizeString,
                           std::vector<std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCardParseWarning>>* warnings);
+int ParseSizeForPixelSize(const std::string& sizeString, AdaptiveSharedNamespace::ParseContext& context);
 
 void EnsureShowCardVersions(const std::vector<std::shared_ptr<AdaptiveSharedNamespace::BaseActionElement>>& actions,
                             const std::string& version);
 
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties);
+// Puts the properties of json that are neither schema properties of its type nor known properties in unknownProperties
+void HandleUnknownProperties(const Json::Value& json,
+                             AdaptiveSharedNamespace::SchemaPropertySet schemaProperties,
+                             const std::unordered_set<std::string>& knownProperties,
+                             Json::Value& unknownProperties);
+
+// Size of a type with fields of fieldsSize bytes and no padding but at its end. The element types, which cards keep
+// thousands of, are static_asserted to fit in it, so that new fields are added without padding.
+constexpr size_t UnpaddedSize(size_t fieldsSize, size_t alignment)
+{
+    return (fieldsSize + alignment - 1) / alignment * alignment;
+}
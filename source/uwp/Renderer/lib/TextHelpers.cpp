@@ -4,6 +4,7 @@
 #include "AdaptiveTextRun.h"
 #include "DateTimeParser.h"
 #include "MarkDownParser.h"
+#include "TextProcessingCache.h"
 #include "TextHelpers.h"
 #include "XamlBuilder.h"
 #include "XamlHelpers.h"
@@ -169,12 +170,12 @@ HRESULT SetXamlInlines(_In_ ABI::AdaptiveNamespace::IAdaptiveTextElement* adapti
     HString language;
     RETURN_IF_FAILED(adaptiveTextElement->get_Language(language.GetAddressOf()));
 
-    MarkDownParser markdownParser(HStringToUTF8(text.Get()));
-    auto htmlString = markdownParser.TransformToHtml();
+    const auto markdownParser = TextProcessingCache::GetDefault().GetMarkDown(HStringToUTF8(text.Get()), HStringToUTF8(language.Get()));
+    const auto& htmlString = markdownParser->GetHtml();
 
     bool handledAsHtml = false;
     UINT localCharacterLength = 0;
-    if (markdownParser.HasHtmlTags())
+    if (markdownParser->HasHtmlTags())
     {
         HString htmlHString;
         // wrap html in <root></root> in case there's more than one toplevel element.
@@ -673,15 +673,22 @@ namespace AdaptiveNamespace
             HString dataPath;
             THROW_IF_FAILED(imageUrl->get_Path(dataPath.GetAddressOf()));
 
-            std::string data = AdaptiveBase64Util::ExtractDataFromUri(HStringToUTF8(dataPath.Get()));
-            std::vector<char> decodedData = AdaptiveBase64Util::Decode(data);
+            ComPtr<IBitmapImage> bitmapImage = XamlHelpers::CreateXamlClass<IBitmapImage>(
+                HStringReference(RuntimeClass_Windows_UI_Xaml_Media_Imaging_BitmapImage));
+            m_imageLoadTracker.TrackBitmapImage(bitmapImage.Get());
+            THROW_IF_FAILED(bitmapImage->put_CreateOptions(BitmapCreateOptions::BitmapCreateOptions_IgnoreImageCache));
+            ComPtr<IBitmapSource> bitmapSource;
+            THROW_IF_FAILED(bitmapImage.As(&bitmapSource));
+
+            const std::string dataUri = HStringToUTF8(dataPath.Get());
+            const size_t decodedLength = AdaptiveBase64Util::DecodedDataUriLength(dataUri.data(), dataUri.size());
 
             ComPtr<IBufferFactory> bufferFactory;
             THROW_IF_FAILED(GetActivationFactory(HStringReference(RuntimeClass_Windows_Storage_Streams_Buffer).Get(),
                                                  bufferFactory.GetAddressOf()));
 
             ComPtr<IBuffer> buffer;
-            THROW_IF_FAILED(bufferFactory->Create(static_cast<UINT32>(decodedData.size()), buffer.GetAddressOf()));
+            THROW_IF_FAILED(bufferFactory->Create(static_cast<UINT32>(decodedLength), buffer.GetAddressOf()));
 
             ComPtr<::Windows::Storage::Streams::IBufferByteAccess> bufferByteAccess;
             THROW_IF_FAILED(buffer.As(&bufferByteAccess));
@@ -689,16 +696,15 @@ namespace AdaptiveNamespace
             BYTE* dataInternal{};
             THROW_IF_FAILED(bufferByteAccess->Buffer(&dataInternal));
 
-            memcpy_s(dataInternal, decodedData.size(), decodedData.data(), decodedData.size());
-
-            THROW_IF_FAILED(buffer->put_Length(static_cast<UINT32>(decodedData.size())));
+            // decode straight into the buffer rather than copying the decoded image
+            if (!AdaptiveBase64Util::DecodeDataUri(dataUri.data(), dataUri.size(), reinterpret_cast<char*>(dataInternal)))
+            {
+                // the data isn't base64, so the image fails to load like one the resolver has no stream for
+                m_imageLoadTracker.MarkFailedLoadBitmapImage(bitmapImage.Get());
+                return;
+            }
 
-            ComPtr<IBitmapImage> bitmapImage = XamlHelpers::CreateXamlClass<IBitmapImage>(
-                HStringReference(RuntimeClass_Windows_UI_Xaml_Media_Imaging_BitmapImage));
-            m_imageLoadTracker.TrackBitmapImage(bitmapImage.Get());
-            THROW_IF_FAILED(bitmapImage->put_CreateOptions(BitmapCreateOptions::BitmapCreateOptions_IgnoreImageCache));
-            ComPtr<IBitmapSource> bitmapSource;
-            THROW_IF_FAILED(bitmapImage.As(&bitmapSource));
+            THROW_IF_FAILED(buffer->put_Length(static_cast<UINT32>(decodedLength)));
 
             ComPtr<IRandomAccessStream> randomAccessStream = XamlHelpers::CreateXamlClass<IRandomAccessStream>(
                 HStringReference(RuntimeClass_Windows_Storage_Streams_InMemoryRandomAccessStream));